@@ -48,6 +48,9 @@ snapshot_get_global_flags (bool has_regex, /**< regex literal is present */
 #if ENABLED (JERRY_ES2015_CLASS)
   flags |= (has_class ? JERRY_SNAPSHOT_HAS_CLASS_LITERAL : 0);
 #endif /* ENABLED (JERRY_ES2015_CLASS) */
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+  flags |= JERRY_SNAPSHOT_EIGHT_BYTE_VALUE;
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
 
   return flags;
 } /* snapshot_get_global_flags */
@@ -64,6 +64,9 @@ JERRY_STATIC_ASSERT ((int) ECMA_INIT_EMPTY == (int) JERRY_INIT_EMPTY
                      && (int) ECMA_INIT_MEM_STATS == (int) JERRY_INIT_MEM_STATS,
                      ecma_init_flag_t_must_be_equal_to_jerry_init_flag_t);
 
+JERRY_STATIC_ASSERT ((int) ECMA_PARSE_STRICT_MODE == (int) JERRY_PARSE_STRICT_MODE,
+                     ecma_parse_strict_mode_must_be_equal_to_jerry_parse_strict_mode);
+
 #if ENABLED (JERRY_BUILTIN_REGEXP)
 JERRY_STATIC_ASSERT ((int) RE_FLAG_GLOBAL == (int) JERRY_REGEXP_FLAG_GLOBAL
                      && (int) RE_FLAG_MULTILINE == (int) JERRY_REGEXP_FLAG_MULTILINE
@@ -308,6 +311,31 @@ jerry_gc (jerry_gc_mode_t mode) /**< operational mode */
   ecma_free_unused_memory (JMEM_PRESSURE_HIGH);
 } /* jerry_gc */
 
+/**
+ * Perform a bounded amount of garbage collection work.
+ *
+ * When the incremental garbage collector is enabled, at most 'budget' objects are processed, and
+ * a new collection cycle is started if no cycle is in progress. Otherwise a full garbage collection
+ * is performed.
+ *
+ * @return true - if the current garbage collection cycle is not finished yet
+ *         false - otherwise
+ */
+bool
+jerry_gc_step (uint32_t budget) /**< maximum number of objects to process */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  return ecma_gc_step (budget);
+#else /* !ENABLED (JERRY_GC_INCREMENTAL) */
+  JERRY_UNUSED (budget);
+
+  ecma_gc_run ();
+  return false;
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+} /* jerry_gc_step */
+
 /**
  * Get heap memory stats.
  *
@@ -342,6 +370,48 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
 #endif /* ENABLED (JERRY_MEM_STATS) */
 } /* jerry_get_memory_stats */
 
+/**
+ * Get the statistics of the RegExp byte code cache.
+ *
+ * @return true - get the cache stats successful
+ *         false - otherwise. Usually it is because the RegExp builtin is not enabled.
+ */
+bool
+jerry_get_regexp_cache_stats (jerry_regexp_cache_stats_t *out_stats_p) /**< [out] RegExp cache stats */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  uint32_t used_entries = 0;
+
+  for (uint32_t i = 0; i < RE_CACHE_SIZE; i++)
+  {
+    if (JERRY_CONTEXT (re_cache)[i] != NULL)
+    {
+      used_entries++;
+    }
+  }
+
+  *out_stats_p = (jerry_regexp_cache_stats_t)
+  {
+    .size = RE_CACHE_SIZE,
+    .used_entries = used_entries,
+    .hits = JERRY_CONTEXT (re_cache_hits),
+    .misses = JERRY_CONTEXT (re_cache_misses)
+  };
+
+  return true;
+#else /* !ENABLED (JERRY_BUILTIN_REGEXP) */
+  JERRY_UNUSED (out_stats_p);
+  return false;
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+} /* jerry_get_regexp_cache_stats */
+
 /**
  * Simple Jerry runner
  *
@@ -377,6 +447,33 @@ jerry_run_simple (const jerry_char_t *script_source_p, /**< script source */
   return result;
 } /* jerry_run_simple */
 
+#if ENABLED (JERRY_PARSER)
+
+/**
+ * Convert jerry_parse_opts_t option bits to ecma_parse_opts_t option bits.
+ *
+ * @return ecma_parse_opts_t option bits
+ */
+static uint32_t
+jerry_get_ecma_parse_opts (uint32_t parse_opts) /**< jerry_parse_opts_t option bits */
+{
+  uint32_t ecma_parse_opts = parse_opts & JERRY_PARSE_STRICT_MODE;
+
+  if (parse_opts & JERRY_PARSE_LAZY_FUNCTIONS)
+  {
+    ecma_parse_opts |= ECMA_PARSE_LAZY_FUNCTIONS;
+
+    if (parse_opts & JERRY_PARSE_STATIC_SOURCE)
+    {
+      ecma_parse_opts |= ECMA_PARSE_STATIC_SOURCE;
+    }
+  }
+
+  return ecma_parse_opts;
+} /* jerry_get_ecma_parse_opts */
+
+#endif /* ENABLED (JERRY_PARSER) */
+
 /**
  * Parse script and construct an EcmaScript function. The lexical
  * environment is set to the global lexical environment.
@@ -427,7 +524,7 @@ jerry_parse (const jerry_char_t *resource_name_p, /**< resource name (usually a
                                       0,
                                       source_p,
                                       source_size,
-                                      parse_opts,
+                                      jerry_get_ecma_parse_opts (parse_opts),
                                       &bytecode_data_p);
 
   if (ECMA_IS_VALUE_ERROR (parse_status))
@@ -509,7 +606,7 @@ jerry_parse_function (const jerry_char_t *resource_name_p, /**< resource name (u
                                       arg_list_size,
                                       source_p,
                                       source_size,
-                                      parse_opts,
+                                      jerry_get_ecma_parse_opts (parse_opts),
                                       &bytecode_data_p);
 
   if (ECMA_IS_VALUE_ERROR (parse_status))
@@ -593,7 +690,7 @@ jerry_eval (const jerry_char_t *source_p, /**< source code */
 
   return jerry_return (ecma_op_eval_chars_buffer ((const lit_utf8_byte_t *) source_p,
                                                   source_size,
-                                                  parse_opts));
+                                                  parse_opts & JERRY_PARSE_STRICT_MODE));
 } /* jerry_eval */
 
 /**
@@ -2588,6 +2685,7 @@ jerry_set_prototype (const jerry_value_t obj_val, /**< object value */
   }
   else
   {
+    ECMA_GC_WRITE_BARRIER (obj_p);
     ECMA_SET_NON_NULL_POINTER (obj_p->u2.prototype_cp, ecma_get_object_from_value (proto_obj_val));
   }
 
@@ -2608,6 +2706,11 @@ jerry_objects_foreach (jerry_objects_foreach_t foreach_p, /**< function pointer
 
   JERRY_ASSERT (foreach_p != NULL);
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  /* Objects are not on the list while they are being swept. */
+  ecma_gc_finish_cycle ();
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -2647,6 +2750,11 @@ jerry_objects_foreach_by_native_info (const jerry_object_native_info_t *native_i
   ecma_native_pointer_t *native_pointer_p;
 
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  /* Objects are not on the list while they are being swept. */
+  ecma_gc_finish_cycle ();
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -2991,7 +3099,9 @@ jerry_create_context (uint32_t heap_size, /**< the size of heap */
     return NULL;
   }
 
-  memset (context_p, 0, total_size);
+  /* The heap is not cleared: jmem_heap_init only writes the header of the free region, and
+   * the pages of the heap which are never used by the engine are not touched at all. */
+  memset (context_p, 0, sizeof (jerry_context_t));
 
   uintptr_t context_ptr = ((uintptr_t) context_p) + sizeof (jerry_context_t);
   context_ptr = JERRY_ALIGNUP (context_ptr, (uintptr_t) JMEM_ALIGNMENT);
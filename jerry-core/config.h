@@ -216,6 +216,26 @@
 # define JERRY_GC_LIMIT 0
 #endif /* !defined (JERRY_GC_LIMIT) */
 
+/**
+ * Enable/Disable the incremental garbage collector.
+ *
+ * When enabled, the marking and sweeping work of the garbage collector is
+ * split into bounded steps, which are performed at backward jumps of the
+ * interpreter or by calling jerry_gc_step. A full garbage collection is
+ * still performed when the engine runs out of memory.
+ *
+ * Note: the maximum reference count of objects is halved in this mode.
+ *
+ * Allowed values:
+ *  0: Disable the incremental garbage collector.
+ *  1: Enable the incremental garbage collector.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_GC_INCREMENTAL
+# define JERRY_GC_INCREMENTAL 0
+#endif /* !defined (JERRY_GC_INCREMENTAL) */
+
 /**
  * Maximum stack usage size in kilobytes
  *
@@ -242,6 +262,32 @@
 # define JERRY_LCACHE 1
 #endif /* !defined (JERRY_LCACHE) */
 
+/**
+ * Enable/Disable the inline cache of named property accesses in the VM.
+ *
+ * Allowed values:
+ *  0: Disable inline cache.
+ *  1: Enable inline cache.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_ICACHE
+# define JERRY_ICACHE 1
+#endif /* !defined (JERRY_ICACHE) */
+
+/**
+ * Enable/Disable shared property layouts (shapes) of ordinary objects.
+ *
+ * Allowed values:
+ *  0: Disable property shapes.
+ *  1: Enable property shapes.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_PROPERTY_SHAPES
+# define JERRY_PROPERTY_SHAPES 1
+#endif /* !defined (JERRY_PROPERTY_SHAPES) */
+
 /**
  * Enable/Disable line-info management inside the engine.
  *
@@ -310,6 +356,25 @@
 # define JERRY_NUMBER_TYPE_FLOAT64 1
 #endif /* !defined (JERRY_NUMBER_TYPE_FLOAT64 */
 
+/**
+ * Enable/Disable NaN-boxed ecma values.
+ *
+ * When enabled, ecma values are 64 bit wide and floating point numbers are
+ * stored directly in the value instead of a heap allocated number. All other
+ * values keep their 32 bit representation in the low bits of the value.
+ * This option requires 64-bit floating point numbers and it is intended for
+ * 64-bit hosts, since it doubles the size of the stored values.
+ *
+ * Allowed values:
+ *  0: Use 32 bit ecma values.
+ *  1: Use 64 bit NaN-boxed ecma values.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_VALUE_NAN_BOXING
+# define JERRY_VALUE_NAN_BOXING 0
+#endif /* !defined (JERRY_VALUE_NAN_BOXING) */
+
 /**
  * Enable/Disable the JavaScript parser.
  *
@@ -376,6 +441,22 @@
 # define JERRY_REGEXP_STRICT_MODE 0
 #endif /* !defined (JERRY_REGEXP_STRICT_MODE) */
 
+/**
+ * Number of compiled RegExp byte codes kept in the RegExp cache.
+ *
+ * The cache is indexed by the hash of the pattern and the flags, and
+ * the least recently used entry of a cache set is evicted when a new
+ * byte code is inserted.
+ *
+ * Allowed values:
+ *  power of two between 1 and 1024
+ *
+ * Default value: 16
+ */
+#ifndef JERRY_REGEXP_CACHE_SIZE
+# define JERRY_REGEXP_CACHE_SIZE 16
+#endif /* !defined (JERRY_REGEXP_CACHE_SIZE) */
+
 /**
  * Enable/Disable the snapshot execution functions.
  *
@@ -443,6 +524,23 @@
 # define JERRY_VM_EXEC_STOP 0
 #endif /* !defined (JERRY_VM_EXEC_STOP) */
 
+/**
+ * Enable/Disable threaded opcode dispatch in the virtual machine.
+ *
+ * When enabled, the opcode handlers are selected with the labels-as-values
+ * extension of GCC and Clang instead of a switch statement. Other compilers
+ * always use the switch based dispatch.
+ *
+ * Allowed values:
+ *  0: Use switch based dispatch.
+ *  1: Use threaded dispatch if the compiler supports it.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_VM_THREADED_DISPATCH
+# define JERRY_VM_THREADED_DISPATCH 0
+#endif /* !defined (JERRY_VM_THREADED_DISPATCH) */
+
 /**
  * Advanced section configurations.
  */
@@ -625,6 +723,10 @@
 #if !defined (JERRY_GC_LIMIT) || (JERRY_GC_LIMIT < 0)
 # error "Invalid value for 'JERRY_GC_LIMIT' macro."
 #endif
+#if !defined (JERRY_GC_INCREMENTAL) \
+|| ((JERRY_GC_INCREMENTAL != 0) && (JERRY_GC_INCREMENTAL != 1))
+# error "Invalid value for 'JERRY_GC_INCREMENTAL' macro."
+#endif
 #if !defined (JERRY_STACK_LIMIT) || (JERRY_STACK_LIMIT < 0)
 # error "Invalid value for 'JERRY_STACK_LIMIT' macro."
 #endif
@@ -632,6 +734,14 @@
 || ((JERRY_LCACHE != 0) && (JERRY_LCACHE != 1))
 # error "Invalid value for 'JERRY_LCACHE' macro."
 #endif
+#if !defined (JERRY_ICACHE) \
+|| ((JERRY_ICACHE != 0) && (JERRY_ICACHE != 1))
+# error "Invalid value for 'JERRY_ICACHE' macro."
+#endif
+#if !defined (JERRY_PROPERTY_SHAPES) \
+|| ((JERRY_PROPERTY_SHAPES != 0) && (JERRY_PROPERTY_SHAPES != 1))
+# error "Invalid value for 'JERRY_PROPERTY_SHAPES' macro."
+#endif
 #if !defined (JERRY_LINE_INFO) \
 || ((JERRY_LINE_INFO != 0) && (JERRY_LINE_INFO != 1))
 # error "Invalid value for 'JERRY_LINE_INFO' macro."
@@ -652,6 +762,10 @@
 || ((JERRY_NUMBER_TYPE_FLOAT64 != 0) && (JERRY_NUMBER_TYPE_FLOAT64 != 1))
 # error "Invalid value for 'JERRY_NUMBER_TYPE_FLOAT64' macro."
 #endif
+#if !defined (JERRY_VALUE_NAN_BOXING) \
+|| ((JERRY_VALUE_NAN_BOXING != 0) && (JERRY_VALUE_NAN_BOXING != 1))
+# error "Invalid value for 'JERRY_VALUE_NAN_BOXING' macro."
+#endif
 #if !defined (JERRY_PARSER) \
 || ((JERRY_PARSER != 0) && (JERRY_PARSER != 1))
 # error "Invalid value for 'JERRY_PARSER' macro."
@@ -672,6 +786,11 @@
 || ((JERRY_REGEXP_STRICT_MODE != 0) && (JERRY_REGEXP_STRICT_MODE != 1))
 # error "Invalid value for 'JERRY_REGEXP_STRICT_MODE' macro."
 #endif
+#if !defined (JERRY_REGEXP_CACHE_SIZE) \
+|| (JERRY_REGEXP_CACHE_SIZE < 1) || (JERRY_REGEXP_CACHE_SIZE > 1024) \
+|| ((JERRY_REGEXP_CACHE_SIZE & (JERRY_REGEXP_CACHE_SIZE - 1)) != 0)
+# error "Invalid value for 'JERRY_REGEXP_CACHE_SIZE' macro."
+#endif
 #if !defined (JERRY_SNAPSHOT_EXEC) \
 || ((JERRY_SNAPSHOT_EXEC != 0) && (JERRY_SNAPSHOT_EXEC != 1))
 # error "Invalid value for 'JERRY_SNAPSHOT_EXEC' macro."
@@ -696,6 +815,10 @@
 || ((JERRY_VM_EXEC_STOP != 0) && (JERRY_VM_EXEC_STOP != 1))
 # error "Invalid value for 'JERRY_VM_EXEC_STOP' macro."
 #endif
+#if !defined (JERRY_VM_THREADED_DISPATCH) \
+|| ((JERRY_VM_THREADED_DISPATCH != 0) && (JERRY_VM_THREADED_DISPATCH != 1))
+# error "Invalid value for 'JERRY_VM_THREADED_DISPATCH' macro."
+#endif
 
 
 #define ENABLED(FEATURE) ((FEATURE) == 1)
@@ -712,4 +835,18 @@
 #  error "Date does not support float32"
 #endif
 
+/**
+ * NaN-boxed values store 64-bit floating point numbers.
+ */
+#if ENABLED (JERRY_VALUE_NAN_BOXING) && !ENABLED (JERRY_NUMBER_TYPE_FLOAT64)
+#  error "NaN-boxing requires float64 numbers"
+#endif
+
+/**
+ * The inline cache is filled from the LCache.
+ */
+#if ENABLED (JERRY_ICACHE) && !ENABLED (JERRY_LCACHE)
+#  error "The inline cache requires the LCache"
+#endif
+
 #endif /* !JERRYSCRIPT_CONFIG_H */
@@ -21,6 +21,7 @@
 #include "ecma-eval.h"
 #include "ecma-function-object.h"
 #include "ecma-objects.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "jerryscript-port.h"
 #include "lit-char-helpers.h"
@@ -467,6 +468,12 @@ jerry_debugger_send_scope_variables (const uint8_t *recv_buffer_p) /**< pointer
         ecma_fast_array_convert_to_normal (binding_obj_p);
       }
     }
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+    else if (ecma_shape_get_storage (binding_obj_p) != NULL)
+    {
+      ecma_shape_convert_to_dictionary (binding_obj_p);
+    }
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
 
     prop_iter_cp = binding_obj_p->u1.property_list_cp;
   }
@@ -24,8 +24,13 @@ JERRY_STATIC_ASSERT (sizeof (ecma_property_value_t) == sizeof (ecma_value_t),
 JERRY_STATIC_ASSERT (((sizeof (ecma_property_value_t) - 1) & sizeof (ecma_property_value_t)) == 0,
                      size_of_ecma_property_value_t_must_be_power_of_2);
 
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= 2 * sizeof (uint64_t),
+                     size_of_ecma_extended_object_part_must_be_less_than_or_equal_to_16_bytes);
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
 JERRY_STATIC_ASSERT (sizeof (ecma_extended_object_t) - sizeof (ecma_object_t) <= sizeof (uint64_t),
                      size_of_ecma_extended_object_part_must_be_less_than_or_equal_to_8_bytes);
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
 
 /** \addtogroup ecma ECMA
  * @{
@@ -23,6 +23,7 @@
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
@@ -51,6 +52,21 @@
  * The garbage collector uses the reference counter
  * of object: it increases the counter by one when
  * the object is marked at the first time.
+ *
+ * Newly marked objects are pushed onto a bounded
+ * mark stack, so each object is traversed only once.
+ * If the mark stack is full, the object is only
+ * marked, and the collector falls back to rescanning
+ * the list of unprocessed objects.
+ *
+ * When the incremental garbage collector is enabled,
+ * a separate mark flag is used instead, so marking can
+ * be interleaved with the execution of the program.
+ * Objects whose reference counter is not zero are the
+ * roots of the marking. A write barrier pushes marked
+ * objects onto the mark stack again, when a reference
+ * is stored into them, and the roots are checked again
+ * before the marking is finished.
  */
 
 /**
@@ -64,9 +80,51 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  return (object_p->type_flags_refs & ECMA_OBJECT_FLAG_GC_MARKED) != 0;
+#else /* !ENABLED (JERRY_GC_INCREMENTAL) */
   return (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
 } /* ecma_gc_is_object_visited */
 
+/**
+ * Push a newly marked object onto the mark stack.
+ *
+ * Note: when the mark stack is full, the overflow status flag is set instead
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_push_object (ecma_object_t *object_p) /**< object */
+{
+  uint32_t top = JERRY_CONTEXT (ecma_gc_mark_stack_top);
+
+  if (JERRY_LIKELY (top < CONFIG_ECMA_GC_MARK_STACK_SIZE))
+  {
+    ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_mark_stack_p)[top], object_p);
+    JERRY_CONTEXT (ecma_gc_mark_stack_top) = top + 1;
+    return;
+  }
+
+  JERRY_CONTEXT (status_flags) |= ECMA_STATUS_GC_MARK_OVERFLOW;
+} /* ecma_gc_push_object */
+
+#if ENABLED (JERRY_GC_INCREMENTAL)
+
+/**
+ * Set visited flag of the object.
+ * Note: This macro can be inlined for performance critical code paths
+ */
+#define ECMA_GC_SET_OBJECT_VISITED(object_p) \
+  do \
+  { \
+    if (!((object_p)->type_flags_refs & ECMA_OBJECT_FLAG_GC_MARKED)) \
+    { \
+      (object_p)->type_flags_refs |= ECMA_OBJECT_FLAG_GC_MARKED; \
+      ecma_gc_push_object (object_p); \
+    } \
+  } while (0)
+
+#else /* !ENABLED (JERRY_GC_INCREMENTAL) */
+
 /**
  * Set visited flag of the object.
  * Note: This macro can be inlined for performance critical code paths
@@ -77,16 +135,19 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
     if ((object_p)->type_flags_refs < ECMA_OBJECT_REF_ONE) \
     { \
       (object_p)->type_flags_refs |= ECMA_OBJECT_REF_ONE; \
+      ecma_gc_push_object (object_p); \
     } \
   } while (0)
 
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
 /**
  * Set visited flag of the object.
  */
 static void JERRY_ATTR_NOINLINE
 ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
 {
-  /* Set reference counter to one if it is zero. */
+  /* Set reference counter to one if it is zero (or the mark flag in incremental mode). */
   ECMA_GC_SET_OBJECT_VISITED (object_p);
 } /* ecma_gc_set_object_visited */
 
@@ -134,6 +195,42 @@ ecma_deref_object (ecma_object_t *object_p) /**< object */
   object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs - ECMA_OBJECT_REF_ONE);
 } /* ecma_deref_object */
 
+/**
+ * Mark referenced object from a named data or named accessor property
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_mark_property (ecma_property_t property, /**< property type */
+                       ecma_property_value_t *value_p) /**< property value */
+{
+  if (ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+  {
+    ecma_value_t value = value_p->value;
+
+    if (ecma_is_value_object (value))
+    {
+      ecma_object_t *value_obj_p = ecma_get_object_from_value (value);
+
+      ECMA_GC_SET_OBJECT_VISITED (value_obj_p);
+    }
+  }
+  else
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (property) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+
+    ecma_getter_setter_pointers_t *get_set_pair_p = ecma_get_named_accessor_property (value_p);
+
+    if (get_set_pair_p->getter_cp != JMEM_CP_NULL)
+    {
+      ecma_gc_set_object_visited (ECMA_GET_NON_NULL_POINTER (ecma_object_t, get_set_pair_p->getter_cp));
+    }
+
+    if (get_set_pair_p->setter_cp != JMEM_CP_NULL)
+    {
+      ecma_gc_set_object_visited (ECMA_GET_NON_NULL_POINTER (ecma_object_t, get_set_pair_p->setter_cp));
+    }
+  }
+} /* ecma_gc_mark_property */
+
 /**
  * Mark referenced object from property
  */
@@ -147,32 +244,9 @@ ecma_gc_mark_properties (ecma_property_pair_t *property_pair_p) /**< property pa
     switch (ECMA_PROPERTY_GET_TYPE (property))
     {
       case ECMA_PROPERTY_TYPE_NAMEDDATA:
-      {
-        ecma_value_t value = property_pair_p->values[index].value;
-
-        if (ecma_is_value_object (value))
-        {
-          ecma_object_t *value_obj_p = ecma_get_object_from_value (value);
-
-          ECMA_GC_SET_OBJECT_VISITED (value_obj_p);
-        }
-        break;
-      }
       case ECMA_PROPERTY_TYPE_NAMEDACCESSOR:
       {
-        ecma_property_value_t *accessor_objs_p = property_pair_p->values + index;
-
-        ecma_getter_setter_pointers_t *get_set_pair_p = ecma_get_named_accessor_property (accessor_objs_p);
-
-        if (get_set_pair_p->getter_cp != JMEM_CP_NULL)
-        {
-          ecma_gc_set_object_visited (ECMA_GET_NON_NULL_POINTER (ecma_object_t, get_set_pair_p->getter_cp));
-        }
-
-        if (get_set_pair_p->setter_cp != JMEM_CP_NULL)
-        {
-          ecma_gc_set_object_visited (ECMA_GET_NON_NULL_POINTER (ecma_object_t, get_set_pair_p->setter_cp));
-        }
+        ecma_gc_mark_property (property, property_pair_p->values + index);
         break;
       }
       case ECMA_PROPERTY_TYPE_INTERNAL:
@@ -193,6 +267,44 @@ ecma_gc_mark_properties (ecma_property_pair_t *property_pair_p) /**< property pa
   }
 } /* ecma_gc_mark_properties */
 
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+
+/**
+ * Mark referenced object from the properties of an object with a shape
+ */
+static void
+ecma_gc_mark_shape_properties (ecma_shape_storage_t *storage_p) /**< first storage block */
+{
+  while (true)
+  {
+    ecma_shape_property_pair_t *pair_p = ECMA_SHAPE_STORAGE_GET_PAIRS (storage_p);
+    ecma_shape_property_pair_t *pair_end_p = pair_p + storage_p->header.types[1];
+
+    do
+    {
+      for (uint32_t index = 0; index < ECMA_PROPERTY_PAIR_ITEM_COUNT; index++)
+      {
+        /* Unused properties are marked as deleted. */
+        if (pair_p->types[index] != ECMA_PROPERTY_TYPE_DELETED)
+        {
+          ecma_gc_mark_property (pair_p->types[index], pair_p->values + index);
+        }
+      }
+      pair_p++;
+    }
+    while (pair_p < pair_end_p);
+
+    if (storage_p->header.next_property_cp == JMEM_CP_NULL)
+    {
+      return;
+    }
+
+    storage_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_storage_t, storage_p->header.next_property_cp);
+  }
+} /* ecma_gc_mark_shape_properties */
+
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
 #if ENABLED (JERRY_ES2015_BUILTIN_PROMISE)
 
 /**
@@ -246,55 +358,21 @@ static void
 ecma_gc_mark_container_object (ecma_object_t *object_p) /**< object */
 {
   ecma_map_object_t *map_object_p = (ecma_map_object_t *) object_p;
-  ecma_object_t *internal_obj_p = ecma_get_object_from_value (map_object_p->header.u.class_prop.u.value);
+  ecma_container_table_t *table_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_container_table_t,
+                                                                     map_object_p->header.u.class_prop.u.value);
+  ecma_container_entry_t *entries_p = ECMA_CONTAINER_TABLE_ENTRIES (table_p);
 
-  ecma_gc_set_object_visited (internal_obj_p);
-
-  jmem_cpointer_t prop_iter_cp = internal_obj_p->u1.property_list_cp;
-
-#if ENABLED (JERRY_PROPRETY_HASHMAP)
-  if (prop_iter_cp != JMEM_CP_NULL)
+  for (uint32_t i = 0; i < table_p->count; i++)
   {
-    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
-                                                                     prop_iter_cp);
-    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+    if (ecma_is_value_object (entries_p[i].key))
     {
-      prop_iter_cp = prop_iter_p->next_property_cp;
+      ecma_gc_set_object_visited (ecma_get_object_from_value (entries_p[i].key));
     }
-  }
-#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
-
-  while (prop_iter_cp != JMEM_CP_NULL)
-  {
-    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
-    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
-
-    ecma_gc_mark_properties ((ecma_property_pair_t *) prop_iter_p);
 
-    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
-
-    for (uint32_t i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    if (ecma_is_value_object (entries_p[i].value))
     {
-      ecma_property_t *property_p = (ecma_property_t *) (prop_iter_p->types + i);
-
-      if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_PTR)
-      {
-        jmem_cpointer_t name_cp = prop_pair_p->names_cp[i];
-        ecma_string_t *prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp);
-
-        if (ECMA_STRING_GET_CONTAINER (prop_name_p) == ECMA_STRING_CONTAINER_MAP_KEY)
-        {
-          ecma_value_t key_arg = ((ecma_extended_string_t *) prop_name_p)->u.value;
-
-          if (ecma_is_value_object (key_arg))
-          {
-            ecma_gc_set_object_visited (ecma_get_object_from_value (key_arg));
-          }
-        }
-      }
+      ecma_gc_set_object_visited (ecma_get_object_from_value (entries_p[i].value));
     }
-
-    prop_iter_cp = prop_iter_p->next_property_cp;
   }
 } /* ecma_gc_mark_container_object */
 
@@ -520,6 +598,18 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
 
   jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
 
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+  if (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      ecma_gc_mark_shape_properties ((ecma_shape_storage_t *) prop_iter_p);
+      return;
+    }
+  }
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
   if (prop_iter_cp != JMEM_CP_NULL)
   {
@@ -542,6 +632,21 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
   }
 } /* ecma_gc_mark */
 
+/**
+ * Mark the objects stored on the mark stack until the stack becomes empty.
+ */
+static void
+ecma_gc_mark_stack_drain (void)
+{
+  while (JERRY_CONTEXT (ecma_gc_mark_stack_top) > 0)
+  {
+    uint32_t top = --JERRY_CONTEXT (ecma_gc_mark_stack_top);
+    jmem_cpointer_t object_cp = JERRY_CONTEXT (ecma_gc_mark_stack_p)[top];
+
+    ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, object_cp));
+  }
+} /* ecma_gc_mark_stack_drain */
+
 /**
  * Free the native handle/pointer by calling its free callback.
  */
@@ -643,6 +748,14 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
 
     jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
 
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+    if (obj_is_not_lex_env && ecma_shape_get_storage (object_p) != NULL)
+    {
+      ecma_shape_free_storage (object_p);
+      prop_iter_cp = JMEM_CP_NULL;
+    }
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
     if (prop_iter_cp != JMEM_CP_NULL)
     {
@@ -795,6 +908,7 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
 #if ENABLED (JERRY_ES2015_BUILTIN_SET)
         case LIT_MAGIC_STRING_SET_UL:
         {
+          ecma_op_container_free_table (object_p);
           ecma_dealloc_extended_object (object_p, sizeof (ecma_map_object_t));
           return;
         }
@@ -802,6 +916,7 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
 #if ENABLED (JERRY_ES2015_BUILTIN_MAP)
         case LIT_MAGIC_STRING_MAP_UL:
         {
+          ecma_op_container_free_table (object_p);
           ecma_dealloc_extended_object (object_p, sizeof (ecma_map_object_t));
           return;
         }
@@ -907,12 +1022,19 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_TYPEDARRAY) */
 #if ENABLED (JERRY_ES2015_BUILTIN_ITERATOR)
         case ECMA_PSEUDO_ARRAY_ITERATOR:
+        {
+          ecma_dealloc_extended_object (object_p, sizeof (ecma_extended_object_t));
+          return;
+        }
+#if ENABLED (JERRY_ES2015_BUILTIN_MAP) || ENABLED (JERRY_ES2015_BUILTIN_SET)
         case ECMA_PSEUDO_SET_ITERATOR:
         case ECMA_PSEUDO_MAP_ITERATOR:
         {
+          ecma_op_container_free_iterator (object_p);
           ecma_dealloc_extended_object (object_p, sizeof (ecma_extended_object_t));
           return;
         }
+#endif /* ENABLED (JERRY_ES2015_BUILTIN_MAP) || ENABLED (JERRY_ES2015_BUILTIN_SET) */
         case ECMA_PSEUDO_STRING_ITERATOR:
         {
           ecma_value_t iterated_value = ext_object_p->u.pseudo_array.u2.iterated_value;
@@ -978,12 +1100,278 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
   ecma_dealloc_object (object_p);
 } /* ecma_gc_free_object */
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+
+/**
+ * Start a new incremental garbage collection cycle.
+ *
+ * Note: no objects are marked by this function
+ */
+static void
+ecma_gc_start_cycle (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE);
+
+  JERRY_CONTEXT (ecma_gc_mark_stack_p) = JERRY_CONTEXT (ecma_gc_mark_stack);
+  JERRY_CONTEXT (ecma_gc_mark_stack_top) = 0;
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_GC_MARK_OVERFLOW;
+  JERRY_CONTEXT (ecma_gc_iter_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_MARK;
+} /* ecma_gc_start_cycle */
+
+/**
+ * Mark the object if it is referenced from outside of the object graph.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_mark_root (ecma_object_t *object_p) /**< object */
+{
+  if (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+  {
+    ECMA_GC_SET_OBJECT_VISITED (object_p);
+  }
+} /* ecma_gc_mark_root */
+
+/**
+ * Finish the marking phase of the current cycle in one step.
+ *
+ * The roots may have changed since the cycle was started, so all objects are checked again.
+ * Afterwards the list of objects is detached from the context to be swept.
+ */
+static void
+ecma_gc_finish_marking (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK);
+
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    ecma_gc_mark_root (obj_iter_p);
+    ecma_gc_mark_stack_drain ();
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  /* Trace marked objects again which were not pushed onto the mark stack because it was full. */
+  while (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARK_OVERFLOW)
+  {
+    JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_GC_MARK_OVERFLOW;
+
+    obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+    while (obj_iter_cp != JMEM_CP_NULL)
+    {
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+      if (ecma_gc_is_object_visited (obj_iter_p))
+      {
+        ecma_gc_mark (obj_iter_p);
+        ecma_gc_mark_stack_drain ();
+      }
+
+      obj_iter_cp = obj_iter_p->gc_next_cp;
+    }
+  }
+
+  /* Objects allocated from now on are not swept in this cycle. */
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+  JERRY_CONTEXT (ecma_gc_mark_stack_p) = NULL;
+  JERRY_CONTEXT (ecma_gc_iter_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+  JERRY_CONTEXT (ecma_gc_objects_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_SWEEP;
+} /* ecma_gc_finish_marking */
+
+/**
+ * Perform a bounded amount of marking work.
+ *
+ * @return unused part of the budget
+ */
+static uint32_t
+ecma_gc_mark_step (uint32_t budget) /**< maximum number of objects to process */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK);
+
+  while (budget > 0)
+  {
+    budget--;
+
+    uint32_t top = JERRY_CONTEXT (ecma_gc_mark_stack_top);
+
+    if (top > 0)
+    {
+      JERRY_CONTEXT (ecma_gc_mark_stack_top) = --top;
+      ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_mark_stack_p)[top]));
+      continue;
+    }
+
+    jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_iter_cp);
+
+    if (obj_iter_cp == JMEM_CP_NULL)
+    {
+      ecma_gc_finish_marking ();
+      return budget;
+    }
+
+    /* Objects allocated during the cycle are inserted before the first object of the
+     * list, so the remaining part of the list is not changed until the cycle is finished. */
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    JERRY_CONTEXT (ecma_gc_iter_cp) = obj_iter_p->gc_next_cp;
+    ecma_gc_mark_root (obj_iter_p);
+  }
+
+  return 0;
+} /* ecma_gc_mark_step */
+
+/**
+ * Perform a bounded amount of sweeping work.
+ *
+ * Marked objects are moved back to the list of alive objects, and unmarked objects are freed.
+ */
+static void
+ecma_gc_sweep_step (uint32_t budget) /**< maximum number of objects to process */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_SWEEP);
+
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_iter_cp);
+
+  while (obj_iter_cp != JMEM_CP_NULL && budget > 0)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+    if (ecma_gc_is_object_visited (obj_iter_p))
+    {
+      obj_iter_p->type_flags_refs = (uint16_t) (obj_iter_p->type_flags_refs & ~ECMA_OBJECT_FLAG_GC_MARKED);
+      obj_iter_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+      JERRY_CONTEXT (ecma_gc_objects_cp) = obj_iter_cp;
+    }
+    else
+    {
+      ecma_gc_free_object (obj_iter_p);
+    }
+
+    obj_iter_cp = obj_next_cp;
+    budget--;
+  }
+
+  JERRY_CONTEXT (ecma_gc_iter_cp) = obj_iter_cp;
+
+  if (obj_iter_cp == JMEM_CP_NULL)
+  {
+    JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_IDLE;
+  }
+} /* ecma_gc_sweep_step */
+
+/**
+ * Perform a bounded amount of incremental garbage collection work.
+ *
+ * A new cycle is started when no cycle is in progress.
+ *
+ * Note: must only be called when no object reference is being stored, because
+ *       marked objects are traced again after the write barrier is called
+ *
+ * @return true - if the current cycle is not finished yet
+ *         false - otherwise
+ */
+bool
+ecma_gc_step (uint32_t budget) /**< maximum number of objects to process */
+{
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE)
+  {
+    ecma_gc_start_cycle ();
+  }
+
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK)
+  {
+    budget = ecma_gc_mark_step (budget);
+  }
+
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_SWEEP)
+  {
+    ecma_gc_sweep_step (budget);
+  }
+
+  return JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE;
+} /* ecma_gc_step */
+
+/**
+ * Finish the current incremental garbage collection cycle (if any) in one step.
+ */
+void
+ecma_gc_finish_cycle (void)
+{
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK)
+  {
+    ecma_gc_finish_marking ();
+  }
+
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_SWEEP)
+  {
+    ecma_gc_sweep_step (UINT32_MAX);
+  }
+
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE);
+} /* ecma_gc_finish_cycle */
+
+/**
+ * Write barrier of the incremental garbage collector.
+ *
+ * If the object has already been marked in the current cycle, it is pushed onto the
+ * mark stack again, so the newly stored references are traced before the cycle ends.
+ */
+void
+ecma_gc_write_barrier (ecma_object_t *object_p) /**< object which is modified */
+{
+  if (JERRY_LIKELY (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_MARK)
+      || !ecma_gc_is_object_visited (object_p))
+  {
+    return;
+  }
+
+  uint32_t top = JERRY_CONTEXT (ecma_gc_mark_stack_top);
+
+  /* Repeated stores into the same object are common (e.g. filling an array). */
+  if (top > 0
+      && ECMA_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_mark_stack_p)[top - 1]) == object_p)
+  {
+    return;
+  }
+
+  ecma_gc_push_object (object_p);
+} /* ecma_gc_write_barrier */
+
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
 /**
  * Run garbage collection, freeing objects that are no longer referenced.
  */
 void
 ecma_gc_run (void)
 {
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK)
+  {
+    /* Objects which became unreachable during the current cycle might have been marked
+     * already, so the cycle is abandoned and a new one is performed instead. */
+    jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+    while (obj_iter_cp != JMEM_CP_NULL)
+    {
+      ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+      obj_iter_p->type_flags_refs = (uint16_t) (obj_iter_p->type_flags_refs & ~ECMA_OBJECT_FLAG_GC_MARKED);
+      obj_iter_cp = obj_iter_p->gc_next_cp;
+    }
+
+    JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_IDLE;
+  }
+  else
+  {
+    ecma_gc_finish_cycle ();
+  }
+
+  ecma_gc_start_cycle ();
+  ecma_gc_finish_cycle ();
+#else /* !ENABLED (JERRY_GC_INCREMENTAL) */
   JERRY_CONTEXT (ecma_gc_new_objects) = 0;
 
   ecma_object_t black_list_head;
@@ -1025,21 +1413,25 @@ ecma_gc_run (void)
   black_end_p->gc_next_cp = JMEM_CP_NULL;
   ecma_object_t *const last_root_object_p = black_end_p;
 
+  jmem_cpointer_t mark_stack[CONFIG_ECMA_GC_MARK_STACK_SIZE];
+  JERRY_CONTEXT (ecma_gc_mark_stack_p) = mark_stack;
+  JERRY_CONTEXT (ecma_gc_mark_stack_top) = 0;
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_GC_MARK_OVERFLOW;
+
   /* Mark root objects. */
   obj_iter_cp = black_list_head.gc_next_cp;
   while (obj_iter_cp != JMEM_CP_NULL)
   {
     obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
     ecma_gc_mark (obj_iter_p);
+    ecma_gc_mark_stack_drain ();
     obj_iter_cp = obj_iter_p->gc_next_cp;
   }
 
-  /* Mark non-root objects. */
-  bool marked_anything_during_current_iteration;
-
-  do
+  /* Mark non-root objects which were not pushed onto the mark stack because it was full. */
+  while (JERRY_CONTEXT (status_flags) & ECMA_STATUS_GC_MARK_OVERFLOW)
   {
-    marked_anything_during_current_iteration = false;
+    JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_GC_MARK_OVERFLOW;
 
     obj_prev_p = &white_gray_list_head;
     obj_iter_cp = obj_prev_p->gc_next_cp;
@@ -1061,7 +1453,7 @@ ecma_gc_run (void)
         black_end_p = obj_iter_p;
 
         ecma_gc_mark (obj_iter_p);
-        marked_anything_during_current_iteration = true;
+        ecma_gc_mark_stack_drain ();
       }
       else
       {
@@ -1071,7 +1463,32 @@ ecma_gc_run (void)
       obj_iter_cp = obj_next_cp;
     }
   }
-  while (marked_anything_during_current_iteration);
+
+  JERRY_CONTEXT (ecma_gc_mark_stack_p) = NULL;
+
+  /* Move the remaining marked objects to the black list. */
+  obj_prev_p = &white_gray_list_head;
+  obj_iter_cp = obj_prev_p->gc_next_cp;
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+    if (ecma_gc_is_object_visited (obj_iter_p))
+    {
+      obj_prev_p->gc_next_cp = obj_next_cp;
+
+      black_end_p->gc_next_cp = obj_iter_cp;
+      black_end_p = obj_iter_p;
+    }
+    else
+    {
+      obj_prev_p = obj_iter_p;
+    }
+
+    obj_iter_cp = obj_next_cp;
+  }
 
   black_end_p->gc_next_cp = JMEM_CP_NULL;
 
@@ -1103,11 +1520,7 @@ ecma_gc_run (void)
   }
 
   JERRY_CONTEXT (ecma_gc_objects_cp) = black_list_head.gc_next_cp;
-
-#if ENABLED (JERRY_BUILTIN_REGEXP)
-  /* Free RegExp bytecodes stored in cache */
-  re_cache_gc_run ();
-#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
 } /* ecma_gc_run */
 
 /**
@@ -1144,7 +1557,16 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
 
     if (JERRY_CONTEXT (ecma_gc_new_objects) * new_objects_fraction > JERRY_CONTEXT (ecma_gc_objects_number))
     {
+#if ENABLED (JERRY_GC_INCREMENTAL)
+      /* The work is done by the following steps of the interpreter, since the
+       * allocation might be requested while an object reference is being stored. */
+      if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE)
+      {
+        ecma_gc_start_cycle ();
+      }
+#else /* !ENABLED (JERRY_GC_INCREMENTAL) */
       ecma_gc_run ();
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
     }
 
     return;
@@ -1166,6 +1588,11 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
 
     ecma_gc_run ();
 
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+    /* Free RegExp bytecodes stored in cache */
+    re_cache_gc_run ();
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
     /* Free hashmaps of remaining objects. */
     jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
@@ -1204,6 +1631,7 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
     jmem_pools_collect_empty ();
+    jmem_heap_collect_bins ();
     return;
   }
   else if (JERRY_UNLIKELY (pressure == JMEM_PRESSURE_FULL))
@@ -26,10 +26,41 @@
  * @{
  */
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+
+/**
+ * Phases of an incremental garbage collection cycle.
+ */
+typedef enum
+{
+  ECMA_GC_PHASE_IDLE, /**< no garbage collection cycle is in progress */
+  ECMA_GC_PHASE_MARK, /**< reachable objects are being marked */
+  ECMA_GC_PHASE_SWEEP, /**< unmarked objects are being freed */
+} ecma_gc_phase_t;
+
+/**
+ * Notify the incremental garbage collector that an object reference is stored into the object.
+ */
+#define ECMA_GC_WRITE_BARRIER(object_p) ecma_gc_write_barrier (object_p)
+
+#else /* !ENABLED (JERRY_GC_INCREMENTAL) */
+
+/**
+ * Write barriers are not needed when the incremental garbage collector is disabled.
+ */
+#define ECMA_GC_WRITE_BARRIER(object_p) JERRY_UNUSED (object_p)
+
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
 void ecma_init_gc_info (ecma_object_t *object_p);
 void ecma_ref_object (ecma_object_t *object_p);
 void ecma_deref_object (ecma_object_t *object_p);
 void ecma_gc_run (void);
+#if ENABLED (JERRY_GC_INCREMENTAL)
+bool ecma_gc_step (uint32_t budget);
+void ecma_gc_finish_cycle (void);
+void ecma_gc_write_barrier (ecma_object_t *object_p);
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
 void ecma_free_unused_memory (jmem_pressure_t pressure);
 
 /**
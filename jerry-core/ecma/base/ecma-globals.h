@@ -62,6 +62,7 @@ typedef enum
   ECMA_STATUS_HIGH_PRESSURE_GC  = (1u << 2), /**< last gc was under high pressure */
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
   ECMA_STATUS_EXCEPTION         = (1u << 3), /**< last exception is a normal exception */
+  ECMA_STATUS_GC_MARK_OVERFLOW  = (1u << 4), /**< the mark stack of the gc has overflowed */
 } ecma_status_flag_t;
 
 /**
@@ -71,7 +72,8 @@ typedef enum
 {
   ECMA_TYPE_DIRECT = 0, /**< directly encoded value, a 28 bit signed integer or a simple value */
   ECMA_TYPE_STRING = 1, /**< pointer to description of a string */
-  ECMA_TYPE_FLOAT = 2, /**< pointer to a 64 or 32 bit floating point number */
+  ECMA_TYPE_FLOAT = 2, /**< pointer to a 64 or 32 bit floating point number (the number itself
+                        *   when JERRY_VALUE_NAN_BOXING is enabled) */
   ECMA_TYPE_OBJECT = 3, /**< pointer to description of an object */
   ECMA_TYPE_SYMBOL = 4, /**< pointer to description of a symbol */
   ECMA_TYPE_DIRECT_STRING = 5, /**< directly encoded string values */
@@ -105,8 +107,36 @@ typedef enum
   ECMA_PARSE_HAS_IMPL_SUPER = (1u << 4), /**< the current context has implicit parent class */
   ECMA_PARSE_HAS_STATIC_SUPER = (1u << 5), /**< the current context is a static class method */
   ECMA_PARSE_EVAL = (1u << 6), /**< eval is called */
+  ECMA_PARSE_LAZY_FUNCTIONS = (1u << 7), /**< compile the nested functions when they are called first */
+  ECMA_PARSE_STATIC_SOURCE = (1u << 8), /**< the source code is kept alive by the application */
 } ecma_parse_opts_t;
 
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+
+/**
+ * Description of an ecma value
+ *
+ * Floating point numbers: bit pattern of the number + ECMA_VALUE_FLOAT_OFFSET
+ * Other values: zero (32) | type (3) | value (29)
+ */
+typedef uint64_t ecma_value_t;
+
+/**
+ * Offset added to the bit pattern of floating point numbers
+ *
+ * Note:
+ *   NaN values are canonicalized, so the highest stored bit pattern is
+ *   negative infinity, and adding the offset to it cannot overflow.
+ */
+#define ECMA_VALUE_FLOAT_OFFSET (((ecma_value_t) 1) << 48)
+
+/**
+ * Mask of the bits which are only set for floating point numbers
+ */
+#define ECMA_VALUE_FLOAT_MASK (~(ECMA_VALUE_FLOAT_OFFSET - 1))
+
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
+
 /**
  * Description of an ecma value
  *
@@ -114,6 +144,8 @@ typedef enum
  */
 typedef uint32_t ecma_value_t;
 
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
+
 /**
  * Type for directly encoded integer numbers in JerryScript.
  */
@@ -416,6 +448,7 @@ typedef enum
    * ECMA_PROPERTY_IS_PROPERTY_PAIR must be updated as well. */
   ECMA_SPECIAL_PROPERTY_HASHMAP, /**< hashmap property */
   ECMA_SPECIAL_PROPERTY_DELETED, /**< deleted property */
+  ECMA_SPECIAL_PROPERTY_SHAPE, /**< property storage of an object with a shape */
 
   ECMA_SPECIAL_PROPERTY__COUNT /**< Number of special property types */
 } ecma_special_property_id_t;
@@ -436,6 +469,11 @@ typedef enum
  */
 #define ECMA_PROPERTY_TYPE_HASHMAP ECMA_SPECIAL_PROPERTY_VALUE (ECMA_SPECIAL_PROPERTY_HASHMAP)
 
+/**
+ * Type of the property storage of objects with a shape.
+ */
+#define ECMA_PROPERTY_TYPE_SHAPE ECMA_SPECIAL_PROPERTY_VALUE (ECMA_SPECIAL_PROPERTY_SHAPE)
+
 /**
  * Type of property not found.
  */
@@ -478,16 +516,19 @@ typedef uint8_t ecma_property_t; /**< ecma_property_types_t (3 bit) and ecma_pro
  */
 typedef struct
 {
-#if ENABLED (JERRY_CPOINTER_32_BIT)
+#if ENABLED (JERRY_CPOINTER_32_BIT) && !ENABLED (JERRY_VALUE_NAN_BOXING)
   jmem_cpointer_t next_property_cp; /**< next cpointer */
-#endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+#endif /* ENABLED (JERRY_CPOINTER_32_BIT) && !ENABLED (JERRY_VALUE_NAN_BOXING) */
   ecma_property_t types[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< two property type slot. The first represent
                                                          *   the type of this property (e.g. property pair) */
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   uint16_t padding; /**< an unused value */
-#else /* !ENABLED (JERRY_CPOINTER_32_BIT) */
-  jmem_cpointer_t next_property_cp; /**< next cpointer */
 #endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+#if !ENABLED (JERRY_CPOINTER_32_BIT) || ENABLED (JERRY_VALUE_NAN_BOXING)
+  /* The types must be at the start of the header when the values are 8 byte long,
+   * otherwise ECMA_PROPERTY_VALUE_PTR cannot compute the value address of a type. */
+  jmem_cpointer_t next_property_cp; /**< next cpointer */
+#endif /* !ENABLED (JERRY_CPOINTER_32_BIT) || ENABLED (JERRY_VALUE_NAN_BOXING) */
 } ecma_property_header_t;
 
 /**
@@ -522,6 +563,56 @@ typedef struct
   jmem_cpointer_t names_cp[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< property name slots */
 } ecma_property_pair_t;
 
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+
+/**
+ * Shape (hidden class) of ordinary objects.
+ *
+ * Objects which received the same properties in the same order share a shape. A
+ * shape describes its last property, the others are described by its parent shapes.
+ * The shapes derived from a shape by adding one more property form a transition list.
+ */
+typedef struct
+{
+  jmem_cpointer_t parent_cp; /**< shape without the last property */
+  jmem_cpointer_t first_child_cp; /**< first shape of the transition list */
+  jmem_cpointer_t next_sibling_cp; /**< next shape in the transition list of the parent */
+  jmem_cpointer_t name_cp; /**< name of the last property */
+  uint32_t refs; /**< number of objects and child shapes which refer to this shape */
+  uint32_t name_filter; /**< bloom filter of the property name hashes */
+  ecma_property_t name_type; /**< name type of the last property */
+  uint8_t count; /**< number of properties */
+  uint8_t max_count; /**< largest property count of the shapes derived from this shape */
+} ecma_shape_t;
+
+/**
+ * Header of a property storage block of an object with a shape.
+ *
+ * The block is followed by ecma_shape_property_pair_t items, which store the
+ * properties in the order described by the shape.
+ */
+typedef struct
+{
+  ecma_property_header_t header; /**< types[0] is ECMA_PROPERTY_TYPE_SHAPE, types[1] is the number of
+                                  *   property pairs in the block, next_property_cp is the next block */
+  jmem_cpointer_t shape_cp; /**< shape of the object (only used by the first block) */
+#if !ENABLED (JERRY_CPOINTER_32_BIT) || ENABLED (JERRY_VALUE_NAN_BOXING)
+  jmem_cpointer_t padding; /**< an unused value (keeps the property pairs aligned) */
+#endif /* !ENABLED (JERRY_CPOINTER_32_BIT) || ENABLED (JERRY_VALUE_NAN_BOXING) */
+} ecma_shape_storage_t;
+
+/**
+ * Property pair of an object with a shape. The names are stored by the shape.
+ */
+typedef struct
+{
+  ecma_property_t types[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< two property type slot */
+  uint16_t padding; /**< an unused value */
+  ecma_property_value_t values[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< property value slots */
+} ecma_shape_property_pair_t;
+
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
 /**
  * Get property type.
  */
@@ -538,7 +629,8 @@ typedef struct
  * Returns true if the property pointer is a property pair.
  */
 #define ECMA_PROPERTY_IS_PROPERTY_PAIR(property_header_p) \
-  ((property_header_p)->types[0] != ECMA_PROPERTY_TYPE_HASHMAP)
+  ((property_header_p)->types[0] != ECMA_PROPERTY_TYPE_HASHMAP \
+   && (property_header_p)->types[0] != ECMA_PROPERTY_TYPE_SHAPE)
 
 /**
  * Returns true if the property is named property.
@@ -713,6 +805,25 @@ typedef enum
 #define ECMA_OBJECT_FLAG_NON_CLOSURE 0x20
 #endif /* ENABLED (JERRY_DEBUGGER) */
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+
+/**
+ * The object is marked by the incremental garbage collector.
+ */
+#define ECMA_OBJECT_FLAG_GC_MARKED 0x40
+
+/**
+ * Value for increasing or decreasing the object reference counter.
+ */
+#define ECMA_OBJECT_REF_ONE (1u << 7)
+
+/**
+ * Maximum value of the object reference counter (511).
+ */
+#define ECMA_OBJECT_MAX_REF (0x1ffu << 7)
+
+#else /* !ENABLED (JERRY_GC_INCREMENTAL) */
+
 /**
  * Value for increasing or decreasing the object reference counter.
  */
@@ -723,6 +834,8 @@ typedef enum
  */
 #define ECMA_OBJECT_MAX_REF (0x3ffu << 6)
 
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
 /**
  * Description of ECMA-object or lexical environment
  * (depending on is_lexical_environment).
@@ -733,7 +846,8 @@ typedef struct
                      depending on ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV
       flags : 2 bit : ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV,
                       ECMA_OBJECT_FLAG_EXTENSIBLE or ECMA_OBJECT_FLAG_NON_CLOSURE
-      refs : 10 bit (max 1023) */
+      refs : 10 bit (max 1023), or when the incremental garbage collector is enabled:
+      gc marked flag : 1 bit, refs : 9 bit (max 511) */
   uint16_t type_flags_refs;
 
   /** next in the object chain maintained by the garbage collector */
@@ -1264,6 +1378,54 @@ typedef struct
  */
 #define ECMA_COLLECTION_INITIAL_SIZE ECMA_COLLECTION_ALLOCATED_SIZE (ECMA_COLLECTION_INITIAL_CAPACITY)
 
+#if ENABLED (JERRY_ES2015_BUILTIN_MAP) || ENABLED (JERRY_ES2015_BUILTIN_SET)
+/**
+ * Entry of a Map/Set hash table.
+ */
+typedef struct
+{
+  ecma_value_t key; /**< key of the entry (ECMA_VALUE_EMPTY if the entry is deleted) */
+  ecma_value_t value; /**< value of the entry (always ECMA_VALUE_UNDEFINED for Set) */
+} ecma_container_entry_t;
+
+/**
+ * Insertion-ordered hash table of Map/Set objects.
+ *
+ * The header is followed by an ecma_container_entry_t array of 'capacity' entries,
+ * which is followed by an uint32_t array of 2 * 'capacity' buckets. A bucket stores
+ * the index of an entry or ECMA_CONTAINER_EMPTY_BUCKET.
+ */
+typedef struct
+{
+  uint32_t capacity; /**< maximum number of entries (zero or a power of 2) */
+  uint32_t count; /**< number of used entries including the deleted ones */
+  ecma_collection_t *iterators_p; /**< (iterator, next index) pairs of the active
+                                   *   iterators and forEach calls (NULL if there is none) */
+} ecma_container_table_t;
+
+/**
+ * Value of an empty bucket in a Map/Set hash table.
+ */
+#define ECMA_CONTAINER_EMPTY_BUCKET UINT32_MAX
+
+/**
+ * Allocated size of a Map/Set hash table.
+ */
+#define ECMA_CONTAINER_TABLE_SIZE(capacity) \
+  (sizeof (ecma_container_table_t) + (capacity) * (sizeof (ecma_container_entry_t) + 2 * sizeof (uint32_t)))
+
+/**
+ * Get the entries of a Map/Set hash table.
+ */
+#define ECMA_CONTAINER_TABLE_ENTRIES(table_p) ((ecma_container_entry_t *) ((table_p) + 1))
+
+/**
+ * Get the buckets of a Map/Set hash table.
+ */
+#define ECMA_CONTAINER_TABLE_BUCKETS(table_p) \
+  ((uint32_t *) (ECMA_CONTAINER_TABLE_ENTRIES (table_p) + (table_p)->capacity))
+#endif /* ENABLED (JERRY_ES2015_BUILTIN_MAP) || ENABLED (JERRY_ES2015_BUILTIN_SET) */
+
 /**
  * Direct string types (2 bit).
  */
@@ -1363,9 +1525,12 @@ typedef enum
 
   ECMA_STRING_CONTAINER_SYMBOL, /**< the ecma-string is a symbol */
 
-  ECMA_STRING_CONTAINER_MAP_KEY, /**< the ecma-string is a map key string */
+  ECMA_STRING_CONTAINER_ROPE, /**< actual data is the concatenation of two strings,
+                               *   which is flattened when its characters are needed */
+  ECMA_STRING_CONTAINER_SLICE, /**< actual data is a substring of another string,
+                                *   which holds the characters on the heap */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_MAP_KEY /**< maximum value */
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_SLICE /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -1460,6 +1625,61 @@ typedef struct
   lit_utf8_size_t length; /**< length of this long utf-8 string in bytes */
 } ecma_long_utf8_string_t;
 
+/**
+ * ECMA rope string-value descriptor
+ *
+ * Note:
+ *   the second part is never a rope, so the parts of a rope form a list on the left side
+ */
+typedef struct
+{
+  ecma_string_t header; /**< string header, the hash is the hash of the whole string */
+  lit_utf8_size_t size; /**< size of the concatenated string in bytes */
+  lit_utf8_size_t length; /**< length of the concatenated string in characters */
+  jmem_cpointer_t left_cp; /**< first part of the string, or the flattened string */
+  jmem_cpointer_t right_cp; /**< second part of the string, JMEM_CP_NULL after flattening */
+} ecma_rope_string_t;
+
+/**
+ * Strings with a size less than this limit are never represented as ropes.
+ *
+ * Note:
+ *   the limit must be greater than the size of any magic string and stringified uint32
+ *   number, since these strings have a special representation which must not be a rope.
+ */
+#define ECMA_ROPE_STRING_MIN_SIZE 256
+
+/**
+ * ECMA slice string-value descriptor
+ *
+ * Note:
+ *   the parent is always an ASCII, UTF8 or long UTF8 string, so the characters
+ *   of a slice are always available without copying
+ */
+typedef struct
+{
+  ecma_string_t header; /**< string header */
+  lit_utf8_size_t size; /**< size of the substring in bytes */
+  lit_utf8_size_t length; /**< length of the substring in characters */
+  lit_utf8_size_t offset; /**< byte offset of the substring in the parent string */
+  jmem_cpointer_t parent_cp; /**< string which holds the characters of the substring */
+} ecma_slice_string_t;
+
+/**
+ * Substrings with a size less than this limit are always copied.
+ *
+ * Note:
+ *   the limit must be greater than the size of any magic string and stringified uint32
+ *   number, since these strings have a special representation which must not be a slice.
+ */
+#define ECMA_SLICE_STRING_MIN_SIZE 64
+
+/**
+ * Substrings are copied when the parent string is more than this many times
+ * larger, so small substrings cannot keep a large parent string alive.
+ */
+#define ECMA_SLICE_STRING_MAX_PARENT_RATIO 4
+
 /**
  * Get the start position of the string buffer of an ecma ASCII string
  */
@@ -1488,7 +1708,6 @@ typedef struct
   union
   {
     ecma_value_t symbol_descriptor; /**< symbol descriptor string-value */
-    ecma_value_t value; /**< original key value corresponds to the map key string */
   } u;
 } ecma_extended_string_t;
 
@@ -1575,13 +1794,16 @@ typedef struct
 } ecma_lit_storage_item_t;
 
 /**
- * Number storage item
+ * Hash index of literal strings or numbers
+ *
+ * Note: the index uses open addressing with linear probing
  */
 typedef struct
 {
-  jmem_cpointer_t next_cp; /**< cpointer ot next item */
-  jmem_cpointer_t values[ECMA_LIT_STORAGE_VALUE_COUNT]; /**< list of values */
-} ecma_number_storage_item_t;
+  jmem_cpointer_t *buckets_p; /**< buckets of the index (NULL if no literal is stored) */
+  uint32_t mask; /**< number of buckets - 1 */
+  uint32_t count; /**< number of stored literals */
+} ecma_lit_storage_index_t;
 
 #if ENABLED (JERRY_LCACHE)
 /**
@@ -1617,6 +1839,62 @@ typedef struct
 
 #endif /* ENABLED (JERRY_LCACHE) */
 
+#if ENABLED (JERRY_ICACHE)
+/**
+ * Entry of the inline cache
+ */
+typedef struct
+{
+  union
+  {
+    ecma_property_t *prop_p; /**< cached own property of the object */
+    uint32_t index; /**< index of the property in the shape */
+  } u;
+  jmem_cpointer_t object_cp; /**< compressed pointer to the object or to the shape of the object */
+  ecma_value_t name; /**< property name */
+  uint32_t epoch; /**< value of the icache epoch when the entry was inserted */
+} ecma_icache_entry_t;
+
+/**
+ * Number of rows in the inline cache
+ */
+#define ECMA_ICACHE_ROWS_COUNT 64
+
+/**
+ * Number of entries in a row of the inline cache
+ */
+#define ECMA_ICACHE_ROW_LENGTH 2
+
+/**
+ * Entry of the binding cache
+ *
+ * Note:
+ *      the environments of an identifier access site always form the same
+ *      static scope chain, so the first depth environments can be skipped
+ *      by every later access until a binding is added by an eval code
+ */
+typedef struct
+{
+  const uint8_t *site_p; /**< byte code of the identifier access */
+  ecma_value_t name; /**< identifier name */
+  uint32_t epoch; /**< value of the icache epoch when the entry was inserted */
+  uint16_t depth; /**< number of leading declarative environments which do not contain the binding */
+  uint16_t index; /**< index of the binding in the property list of the environment at depth,
+                   *   or ECMA_ICACHE_BINDING_NO_INDEX if the environment must be searched */
+} ecma_icache_binding_entry_t;
+
+/**
+ * Number of rows in the binding cache
+ */
+#define ECMA_ICACHE_BINDING_ROWS_COUNT 64
+
+/**
+ * Bindings whose index is greater or equal than this value are searched by name
+ */
+#define ECMA_ICACHE_BINDING_NO_INDEX 32
+
+#endif /* ENABLED (JERRY_ICACHE) */
+
 #if ENABLED (JERRY_ES2015_BUILTIN_TYPEDARRAY)
 
 /**
@@ -54,6 +54,13 @@ JERRY_STATIC_ASSERT (ECMA_PROPERTY_NAME_TYPE_SHIFT > ECMA_VALUE_SHIFT,
 JERRY_STATIC_ASSERT (sizeof (ecma_stringbuilder_header_t) <= sizeof (ecma_ascii_string_t),
                      ecma_stringbuilder_header_must_not_be_larger_than_ecma_ascii_string);
 
+JERRY_STATIC_ASSERT (ECMA_STRING_CONTAINER_SLICE == ECMA_STRING_CONTAINER_ROPE + 1
+                     && ECMA_STRING_CONTAINER_SLICE == ECMA_STRING_CONTAINER__MAX,
+                     ecma_rope_and_slice_strings_must_be_the_last_containers);
+
+JERRY_STATIC_ASSERT (ECMA_SLICE_STRING_MIN_SIZE > ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32,
+                     ecma_slice_strings_must_be_longer_than_stringified_uint32_numbers);
+
 /**
  * Convert a string to an unsigned 32 bit value if possible
  *
@@ -117,6 +124,8 @@ ecma_string_to_array_index (const lit_utf8_byte_t *string_p, /**< utf-8 string *
   return true;
 } /* ecma_string_to_array_index */
 
+static ecma_string_t *ecma_rope_string_flatten (const ecma_string_t *string_p);
+
 /**
  * Returns the characters and size of a string.
  *
@@ -151,6 +160,11 @@ ecma_string_get_chars_fast (const ecma_string_t *string_p, /**< ecma-string */
 
   JERRY_ASSERT (string_p->refs_and_container >= ECMA_STRING_REF_ONE);
 
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    string_p = ecma_rope_string_flatten (string_p);
+  }
+
   switch (ECMA_STRING_GET_CONTAINER (string_p))
   {
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
@@ -168,6 +182,19 @@ ecma_string_get_chars_fast (const ecma_string_t *string_p, /**< ecma-string */
       *size_p = ((ecma_ascii_string_t *) string_p)->size;
       return ECMA_ASCII_STRING_GET_BUFFER (string_p);
     }
+    case ECMA_STRING_CONTAINER_SLICE:
+    {
+      ecma_slice_string_t *slice_p = (ecma_slice_string_t *) string_p;
+      lit_utf8_size_t parent_size;
+      const lit_utf8_byte_t *parent_chars_p;
+
+      parent_chars_p = ecma_string_get_chars_fast (ECMA_GET_NON_NULL_POINTER (ecma_string_t, slice_p->parent_cp),
+                                                   &parent_size);
+      JERRY_ASSERT (slice_p->offset + slice_p->size <= parent_size);
+
+      *size_p = slice_p->size;
+      return parent_chars_p + slice_p->offset;
+    }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
@@ -240,41 +267,6 @@ ecma_prop_name_is_symbol (ecma_string_t *string_p) /**< ecma-string */
 } /* ecma_prop_name_is_symbol */
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
 
-#if ENABLED (JERRY_ES2015_BUILTIN_MAP) || ENABLED (JERRY_ES2015_BUILTIN_SET)
-/**
- * Allocate new ecma-string and fill it with reference to the map key descriptor
- *
- * @return pointer to ecma-string descriptor
- */
-ecma_string_t *
-ecma_new_map_key_string (ecma_value_t value) /**< non prop-name ecma-value */
-{
-  JERRY_ASSERT (!ecma_is_value_prop_name (value));
-
-  ecma_extended_string_t *string_p = ecma_alloc_extended_string ();
-  string_p->header.refs_and_container = ECMA_STRING_REF_ONE | ECMA_STRING_CONTAINER_MAP_KEY;
-  string_p->u.value = ecma_copy_value_if_not_object (value);
-  string_p->header.u.hash = (lit_string_hash_t) (ecma_is_value_simple (value) ? value : 0);
-
-  return (ecma_string_t *) string_p;
-} /* ecma_new_map_key_string */
-
-/**
- * Check whether an ecma-string contains a map key string
- *
- * @return true - if the ecma-string contains a map key string
- *         false - otherwise
- */
-bool
-ecma_prop_name_is_map_key (ecma_string_t *string_p) /**< ecma-string */
-{
-  JERRY_ASSERT (string_p != NULL);
-
-  return (!ECMA_IS_DIRECT_STRING (string_p)
-          && ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAP_KEY);
-} /* ecma_prop_name_is_map_key */
-#endif /* ENABLED (JERRY_ES2015_BUILTIN_MAP) || ENABLED (JERRY_ES2015_BUILTIN_SET) */
-
 /**
  * Allocate new UTF8 ecma-string and fill it with characters from the given utf8 buffer
  *
@@ -320,6 +312,249 @@ ecma_new_ecma_string_from_utf8_buffer (lit_utf8_size_t length, /**< length of th
   return (ecma_string_t *) string_desc_p;
 } /* ecma_new_ecma_string_from_utf8_buffer */
 
+/**
+ * Checks whether the characters of a non-direct string are stored on the heap,
+ * that is, the string is an ASCII, UTF8, long UTF8, rope or slice string.
+ *
+ * @return true - if the string can be a part of a rope string
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_string_can_be_rope_part (const ecma_string_t *string_p) /**< non-direct ecma-string */
+{
+  JERRY_ASSERT (!ECMA_IS_DIRECT_STRING (string_p));
+
+  switch (ECMA_STRING_GET_CONTAINER (string_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
+    case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
+    case ECMA_STRING_CONTAINER_ROPE:
+    case ECMA_STRING_CONTAINER_SLICE:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* ecma_string_can_be_rope_part */
+
+/**
+ * Decrease the reference counter of the parts of a rope string.
+ *
+ * Note:
+ *   the ropes on the left side which are referenced only by their parent are freed
+ *   by a loop, since a recursive destruction of a long rope could exhaust the stack
+ */
+static void
+ecma_rope_string_deref_parts (ecma_rope_string_t *rope_p) /**< rope string */
+{
+  ecma_string_t *left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp);
+
+  if (rope_p->right_cp != JMEM_CP_NULL)
+  {
+    ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp));
+  }
+
+  while (ECMA_STRING_GET_CONTAINER (left_p) == ECMA_STRING_CONTAINER_ROPE
+         && ECMA_STRING_IS_REF_EQUALS_TO_ONE (left_p))
+  {
+    JERRY_ASSERT (!ECMA_STRING_IS_STATIC (left_p));
+
+    ecma_rope_string_t *left_rope_p = (ecma_rope_string_t *) left_p;
+    left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, left_rope_p->left_cp);
+
+    if (left_rope_p->right_cp != JMEM_CP_NULL)
+    {
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, left_rope_p->right_cp));
+    }
+
+    ecma_dealloc_string_buffer ((ecma_string_t *) left_rope_p, sizeof (ecma_rope_string_t));
+  }
+
+  ecma_deref_ecma_string (left_p);
+} /* ecma_rope_string_deref_parts */
+
+/**
+ * Copy the characters of a rope string into a new string, which replaces the parts of the rope.
+ *
+ * Note:
+ *   flattening changes only the representation of the string, not its value
+ *
+ * @return the flat string which holds the characters of the rope
+ */
+static ecma_string_t *
+ecma_rope_string_flatten (const ecma_string_t *string_p) /**< rope string */
+{
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE);
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+  if (rope_p->right_cp == JMEM_CP_NULL)
+  {
+    return ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp);
+  }
+
+  lit_utf8_byte_t *data_p;
+  ecma_string_t *flat_string_p = ecma_new_ecma_string_from_utf8_buffer (rope_p->length, rope_p->size, &data_p);
+  flat_string_p->u.hash = rope_p->header.u.hash;
+
+  /* The parts are copied backwards, starting from the last part of the rope. */
+  lit_utf8_byte_t *end_p = data_p + rope_p->size;
+  ecma_rope_string_t *part_p = rope_p;
+  ecma_string_t *left_p;
+  const lit_utf8_byte_t *chars_p;
+  lit_utf8_size_t size;
+
+  while (true)
+  {
+    chars_p = ecma_string_get_chars_fast (ECMA_GET_NON_NULL_POINTER (ecma_string_t, part_p->right_cp), &size);
+    end_p -= size;
+    memcpy (end_p, chars_p, size);
+
+    left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, part_p->left_cp);
+
+    if (ECMA_STRING_GET_CONTAINER (left_p) != ECMA_STRING_CONTAINER_ROPE
+        || ((ecma_rope_string_t *) left_p)->right_cp == JMEM_CP_NULL)
+    {
+      break;
+    }
+
+    part_p = (ecma_rope_string_t *) left_p;
+  }
+
+  chars_p = ecma_string_get_chars_fast (left_p, &size);
+  end_p -= size;
+  memcpy (end_p, chars_p, size);
+
+  JERRY_ASSERT (end_p == data_p);
+
+  ecma_rope_string_deref_parts (rope_p);
+
+  ECMA_SET_NON_NULL_POINTER (rope_p->left_cp, flat_string_p);
+  rope_p->right_cp = JMEM_CP_NULL;
+  return flat_string_p;
+} /* ecma_rope_string_flatten */
+
+/**
+ * Checks whether the concatenation of a string and some characters should be represented as a rope string.
+ *
+ * @return true - if a rope string should be created
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_string_is_rope_candidate (const ecma_string_t *string1_p, /**< base ecma-string */
+                               lit_utf8_size_t cesu8_string2_size) /**< byte size of the appended characters */
+{
+  /* External magic strings can have any size, and the result of a concatenation
+   * must be an external magic string if it is equal to one of them. */
+  if (ECMA_IS_DIRECT_STRING (string1_p)
+      || !ecma_string_can_be_rope_part (string1_p)
+      || lit_get_magic_string_ex_count () > 0)
+  {
+    return false;
+  }
+
+  lit_utf8_size_t cesu8_string1_size = ecma_string_get_size (string1_p);
+
+  return (cesu8_string1_size + cesu8_string2_size >= ECMA_ROPE_STRING_MIN_SIZE
+          && cesu8_string1_size + cesu8_string2_size > cesu8_string1_size);
+} /* ecma_string_is_rope_candidate */
+
+/**
+ * Append characters to a string by creating a rope string, so the characters
+ * of the base string are not copied.
+ *
+ * Note:
+ *   The string1_p argument is freed. If it needs to be preserved,
+ *   call ecma_ref_ecma_string with string1_p before the call.
+ *
+ * @return rope string
+ */
+static ecma_string_t *
+ecma_append_chars_to_rope (ecma_string_t *string1_p, /**< base ecma-string */
+                           ecma_string_t *string2_p, /**< ecma-string which holds the characters to be appended,
+                                                      *   NULL if the characters are not stored on the heap */
+                           const lit_utf8_byte_t *cesu8_string2_p, /**< characters to be appended */
+                           lit_utf8_size_t cesu8_string2_size, /**< byte size of cesu8_string2_p */
+                           lit_utf8_size_t cesu8_string2_length) /**< character length of cesu8_string2_p */
+{
+  JERRY_ASSERT (ecma_string_is_rope_candidate (string1_p, cesu8_string2_size));
+
+  ecma_string_t *left_p = string1_p;
+  ecma_string_t *right_p = string2_p;
+  const lit_utf8_byte_t *last_part_p = NULL;
+  lit_utf8_size_t last_part_size = 0;
+  lit_utf8_size_t last_part_length = 0;
+  lit_string_hash_t last_part_hash = lit_utf8_string_calc_hash (NULL, 0);
+
+  if (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_ROPE
+      && ((ecma_rope_string_t *) string1_p)->right_cp != JMEM_CP_NULL)
+  {
+    ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string1_p;
+    ecma_string_t *last_string_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->right_cp);
+    lit_utf8_size_t size;
+    const lit_utf8_byte_t *chars_p = ecma_string_get_chars_fast (last_string_p, &size);
+
+    /* Short strings are merged with the last part of the rope, so appending
+     * short strings does not create a long list of small parts. */
+    if (size + cesu8_string2_size < ECMA_ROPE_STRING_MIN_SIZE)
+    {
+      last_part_p = chars_p;
+      last_part_size = size;
+      last_part_length = ecma_string_get_length (last_string_p);
+      last_part_hash = last_string_p->u.hash;
+
+      left_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, rope_p->left_cp);
+      ecma_ref_ecma_string (left_p);
+      right_p = NULL;
+    }
+  }
+
+  if (right_p == NULL)
+  {
+    lit_utf8_byte_t *data_p;
+    right_p = ecma_new_ecma_string_from_utf8_buffer (last_part_length + cesu8_string2_length,
+                                                     last_part_size + cesu8_string2_size,
+                                                     &data_p);
+    right_p->u.hash = lit_utf8_string_hash_combine (last_part_hash, cesu8_string2_p, cesu8_string2_size);
+
+    if (last_part_size > 0)
+    {
+      memcpy (data_p, last_part_p, last_part_size);
+    }
+
+    memcpy (data_p + last_part_size, cesu8_string2_p, cesu8_string2_size);
+  }
+  else
+  {
+    if (ECMA_STRING_GET_CONTAINER (right_p) == ECMA_STRING_CONTAINER_ROPE)
+    {
+      right_p = ecma_rope_string_flatten (right_p);
+    }
+
+    JERRY_ASSERT (ecma_string_can_be_rope_part (right_p));
+    ecma_ref_ecma_string (right_p);
+  }
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) ecma_alloc_string_buffer (sizeof (ecma_rope_string_t));
+  rope_p->header.refs_and_container = ECMA_STRING_CONTAINER_ROPE | ECMA_STRING_REF_ONE;
+  rope_p->header.u.hash = lit_utf8_string_hash_combine (string1_p->u.hash, cesu8_string2_p, cesu8_string2_size);
+  rope_p->size = ecma_string_get_size (string1_p) + cesu8_string2_size;
+  rope_p->length = ecma_string_get_length (string1_p) + cesu8_string2_length;
+  ECMA_SET_NON_NULL_POINTER (rope_p->left_cp, left_p);
+  ECMA_SET_NON_NULL_POINTER (rope_p->right_cp, right_p);
+
+  if (left_p != string1_p)
+  {
+    ecma_deref_ecma_string (string1_p);
+  }
+
+  return (ecma_string_t *) rope_p;
+} /* ecma_append_chars_to_rope */
+
 /**
  * Checks whether a string has a special representation, that is, the string is either a magic string,
  * an external magic string, or an uint32 number, and creates an ecma string using the special representation,
@@ -652,6 +887,11 @@ ecma_append_chars_to_string (ecma_string_t *string1_p, /**< base ecma-string */
     return ecma_new_ecma_string_from_utf8 (cesu8_string2_p, cesu8_string2_size);
   }
 
+  if (ecma_string_is_rope_candidate (string1_p, cesu8_string2_size))
+  {
+    return ecma_append_chars_to_rope (string1_p, NULL, cesu8_string2_p, cesu8_string2_size, cesu8_string2_length);
+  }
+
   lit_utf8_size_t cesu8_string1_size;
   lit_utf8_size_t cesu8_string1_length;
   uint8_t flags = ECMA_STRING_FLAG_IS_ASCII;
@@ -780,6 +1020,20 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
 
   JERRY_ASSERT (cesu8_string2_p != NULL);
 
+  if (ecma_string_is_rope_candidate (string1_p, cesu8_string2_size))
+  {
+    if (ECMA_IS_DIRECT_STRING (string2_p) || !ecma_string_can_be_rope_part (string2_p))
+    {
+      string2_p = NULL;
+    }
+
+    return ecma_append_chars_to_rope (string1_p,
+                                      string2_p,
+                                      cesu8_string2_p,
+                                      cesu8_string2_size,
+                                      cesu8_string2_length);
+  }
+
   ecma_string_t *result_p = ecma_append_chars_to_string (string1_p,
                                                          cesu8_string2_p,
                                                          cesu8_string2_size,
@@ -910,6 +1164,18 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
                                   ((ecma_ascii_string_t *) string_p)->size + sizeof (ecma_ascii_string_t));
       return;
     }
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_rope_string_deref_parts ((ecma_rope_string_t *) string_p);
+      ecma_dealloc_string_buffer (string_p, sizeof (ecma_rope_string_t));
+      return;
+    }
+    case ECMA_STRING_CONTAINER_SLICE:
+    {
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, ((ecma_slice_string_t *) string_p)->parent_cp));
+      ecma_dealloc_string_buffer (string_p, sizeof (ecma_slice_string_t));
+      return;
+    }
 #if ENABLED (JERRY_ES2015_BUILTIN_SYMBOL)
     case ECMA_STRING_CONTAINER_SYMBOL:
     {
@@ -919,15 +1185,6 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       return;
     }
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
-#if ENABLED (JERRY_ES2015_BUILTIN_MAP) || ENABLED (JERRY_ES2015_BUILTIN_SET)
-    case ECMA_STRING_CONTAINER_MAP_KEY:
-    {
-      ecma_extended_string_t *key_p = (ecma_extended_string_t *) string_p;
-      ecma_free_value_if_not_object (key_p->u.value);
-      ecma_dealloc_extended_string (key_p);
-      return;
-    }
-#endif /* ENABLED (JERRY_ES2015_BUILTIN_MAP) || ENABLED (JERRY_ES2015_BUILTIN_SET) */
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC
@@ -1470,6 +1727,11 @@ ecma_string_get_chars (const ecma_string_t *string_p, /**< ecma-string */
   {
     JERRY_ASSERT (string_p->refs_and_container >= ECMA_STRING_REF_ONE);
 
+    if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+    {
+      string_p = ecma_rope_string_flatten (string_p);
+    }
+
     switch (ECMA_STRING_GET_CONTAINER (string_p))
     {
       case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
@@ -1496,6 +1758,12 @@ ecma_string_get_chars (const ecma_string_t *string_p, /**< ecma-string */
         result_p = ECMA_ASCII_STRING_GET_BUFFER (ascii_string_desc_p);
         break;
       }
+      case ECMA_STRING_CONTAINER_SLICE:
+      {
+        result_p = ecma_string_get_chars_fast (string_p, &size);
+        length = ((ecma_slice_string_t *) string_p)->length;
+        break;
+      }
       case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
       {
         size = (lit_utf8_size_t) ecma_string_get_uint32_size (string_p->u.uint32_number);
@@ -1718,6 +1986,33 @@ ecma_string_compare_to_property_name (ecma_property_t property, /**< property na
   return ecma_compare_ecma_non_direct_strings (prop_name_p, string_p);
 } /* ecma_string_compare_to_property_name */
 
+/**
+ * Compare two non-direct ecma-strings, when at least one of them is a rope or slice string.
+ * These strings can be equal to any other string whose characters are stored on the heap.
+ *
+ * @return true - if strings are equal;
+ *         false - otherwise
+ */
+static bool JERRY_ATTR_NOINLINE
+ecma_compare_ecma_rope_strings (const ecma_string_t *string1_p, /**< ecma-string */
+                                const ecma_string_t *string2_p) /**< ecma-string */
+{
+  if ((ECMA_STRING_GET_CONTAINER (string1_p) < ECMA_STRING_CONTAINER_ROPE
+       && ECMA_STRING_GET_CONTAINER (string2_p) < ECMA_STRING_CONTAINER_ROPE)
+      || !ecma_string_can_be_rope_part (string1_p)
+      || !ecma_string_can_be_rope_part (string2_p)
+      || ecma_string_get_size (string1_p) != ecma_string_get_size (string2_p))
+  {
+    return false;
+  }
+
+  lit_utf8_size_t size;
+  const lit_utf8_byte_t *utf8_string1_p = ecma_string_get_chars_fast (string1_p, &size);
+  const lit_utf8_byte_t *utf8_string2_p = ecma_string_get_chars_fast (string2_p, &size);
+
+  return !memcmp ((char *) utf8_string1_p, (char *) utf8_string2_p, size);
+} /* ecma_compare_ecma_rope_strings */
+
 /**
  * Long path part of ecma-string to ecma-string comparison routine
  *
@@ -1733,6 +2028,11 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /**< ecma-st
 {
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_GET_CONTAINER (string2_p));
 
+  if (ECMA_STRING_GET_CONTAINER (string1_p) >= ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ecma_compare_ecma_rope_strings (string1_p, string2_p);
+  }
+
   const lit_utf8_byte_t *utf8_string1_p, *utf8_string2_p;
   lit_utf8_size_t utf8_string1_size, utf8_string2_size;
 
@@ -1801,7 +2101,7 @@ ecma_compare_ecma_strings (const ecma_string_t *string1_p, /**< ecma-string */
 
   if (string1_container != ECMA_STRING_GET_CONTAINER (string2_p))
   {
-    return false;
+    return ecma_compare_ecma_rope_strings (string1_p, string2_p);
   }
 
   if (string1_container == ECMA_STRING_CONTAINER_UINT32_IN_DESC)
@@ -1816,14 +2116,6 @@ ecma_compare_ecma_strings (const ecma_string_t *string1_p, /**< ecma-string */
   }
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
 
-#if ENABLED (JERRY_ES2015_BUILTIN_MAP)
-  if (string1_container == ECMA_STRING_CONTAINER_MAP_KEY)
-  {
-    return ecma_op_same_value_zero (((ecma_extended_string_t *) string1_p)->u.value,
-                                    ((ecma_extended_string_t *) string2_p)->u.value);
-  }
-#endif /* ENABLED (JERRY_ES2015_BUILTIN_MAP) */
-
   return ecma_compare_ecma_strings_longpath (string1_p, string2_p);
 } /* ecma_compare_ecma_strings */
 
@@ -1855,7 +2147,7 @@ ecma_compare_ecma_non_direct_strings (const ecma_string_t *string1_p, /**< ecma-
 
   if (string1_container != ECMA_STRING_GET_CONTAINER (string2_p))
   {
-    return false;
+    return ecma_compare_ecma_rope_strings (string1_p, string2_p);
   }
 
   if (string1_container == ECMA_STRING_CONTAINER_UINT32_IN_DESC)
@@ -1870,14 +2162,6 @@ ecma_compare_ecma_non_direct_strings (const ecma_string_t *string1_p, /**< ecma-
   }
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
 
-#if ENABLED (JERRY_ES2015_BUILTIN_MAP)
-  if (string1_container == ECMA_STRING_CONTAINER_MAP_KEY)
-  {
-    return ecma_op_same_value_zero (((ecma_extended_string_t *) string1_p)->u.value,
-                                    ((ecma_extended_string_t *) string2_p)->u.value);
-  }
-#endif /* ENABLED (JERRY_ES2015_BUILTIN_MAP) */
-
   return ecma_compare_ecma_strings_longpath (string1_p, string2_p);
 } /* ecma_compare_ecma_non_direct_strings */
 
@@ -2026,6 +2310,16 @@ ecma_string_get_ascii_size (const ecma_string_t *string_p) /**< ecma-string */
   {
     return ((ecma_ascii_string_t *) string_p)->size;
   }
+  else if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE
+           && ((ecma_rope_string_t *) string_p)->size == ((ecma_rope_string_t *) string_p)->length)
+  {
+    return ((ecma_rope_string_t *) string_p)->size;
+  }
+  else if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_SLICE
+           && ((ecma_slice_string_t *) string_p)->size == ((ecma_slice_string_t *) string_p)->length)
+  {
+    return ((ecma_slice_string_t *) string_p)->size;
+  }
 
   return ECMA_STRING_NO_ASCII_SIZE;
 } /* ecma_string_get_ascii_size */
@@ -2065,6 +2359,16 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     return (ecma_length_t) (((ecma_long_utf8_string_t *) string_p)->length);
   }
 
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return (ecma_length_t) (((ecma_rope_string_t *) string_p)->length);
+  }
+
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_SLICE)
+  {
+    return (ecma_length_t) (((ecma_slice_string_t *) string_p)->length);
+  }
+
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
 
   lit_magic_string_ex_id_t id = LIT_MAGIC_STRING__COUNT - string_p->u.magic_string_ex_id;
@@ -2122,6 +2426,18 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
                                                 long_utf8_string_p->size);
   }
 
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ecma_string_get_utf8_length (ecma_rope_string_flatten (string_p));
+  }
+
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_SLICE)
+  {
+    lit_utf8_size_t size;
+    const lit_utf8_byte_t *chars_p = ecma_string_get_chars_fast (string_p, &size);
+    return lit_get_utf8_length_of_cesu8_string (chars_p, size);
+  }
+
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
 
   lit_magic_string_ex_id_t id = LIT_MAGIC_STRING__COUNT - string_p->u.magic_string_ex_id;
@@ -2163,6 +2479,16 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     return (lit_utf8_size_t) (((ecma_long_utf8_string_t *) string_p)->size);
   }
 
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ((ecma_rope_string_t *) string_p)->size;
+  }
+
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_SLICE)
+  {
+    return ((ecma_slice_string_t *) string_p)->size;
+  }
+
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
 
   return lit_get_magic_string_ex_size (LIT_MAGIC_STRING__COUNT - string_p->u.magic_string_ex_id);
@@ -2218,6 +2544,18 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
                                               long_utf8_string_p->size);
   }
 
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    return ecma_string_get_utf8_size (ecma_rope_string_flatten (string_p));
+  }
+
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_SLICE)
+  {
+    lit_utf8_size_t size;
+    const lit_utf8_byte_t *chars_p = ecma_string_get_chars_fast (string_p, &size);
+    return lit_get_utf8_size_of_cesu8_string (chars_p, size);
+  }
+
   JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
 
   lit_magic_string_ex_id_t id = LIT_MAGIC_STRING__COUNT - string_p->u.magic_string_ex_id;
@@ -2292,6 +2630,11 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
 
   JERRY_ASSERT (string_p->refs_and_container >= ECMA_STRING_REF_ONE);
 
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    string_p = ecma_rope_string_flatten (string_p);
+  }
+
   switch (ECMA_STRING_GET_CONTAINER (string_p))
   {
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
@@ -2325,6 +2668,18 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
       const lit_utf8_byte_t *data_p = ECMA_ASCII_STRING_GET_BUFFER (string_p);
       return (ecma_char_t) data_p[index];
     }
+    case ECMA_STRING_CONTAINER_SLICE:
+    {
+      lit_utf8_size_t size;
+      const lit_utf8_byte_t *data_p = ecma_string_get_chars_fast (string_p, &size);
+
+      if (JERRY_LIKELY (size == ((ecma_slice_string_t *) string_p)->length))
+      {
+        return (ecma_char_t) data_p[index];
+      }
+
+      return lit_utf8_string_code_unit_at (data_p, size, index);
+    }
     case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
     {
       ecma_uint32_to_utf8_string (string_p->u.uint32_number,
@@ -2380,6 +2735,66 @@ ecma_string_hash (const ecma_string_t *string_p) /**< ecma-string to calculate h
   return (lit_string_hash_t) string_p->u.hash;
 } /* ecma_string_hash */
 
+/**
+ * Create a slice string, which references the characters of a substring instead of copying them.
+ *
+ * Note:
+ *   short substrings, and substrings which are much shorter than the string holding their
+ *   characters are copied instead, so a small substring cannot keep a large string alive
+ *
+ * @return slice string - if the substring is represented as a slice
+ *         NULL - otherwise
+ */
+static ecma_string_t *
+ecma_new_ecma_slice_string (const ecma_string_t *string_p, /**< string which contains the substring */
+                            const lit_utf8_byte_t *start_p, /**< start of the substring */
+                            lit_utf8_size_t size, /**< byte size of the substring */
+                            lit_utf8_size_t length) /**< character length of the substring */
+{
+  /* External magic strings can have any size, and a substring
+   * must be an external magic string if it is equal to one of them. */
+  if (size < ECMA_SLICE_STRING_MIN_SIZE
+      || ECMA_IS_DIRECT_STRING (string_p)
+      || !ecma_string_can_be_rope_part (string_p)
+      || lit_get_magic_string_ex_count () > 0)
+  {
+    return NULL;
+  }
+
+  ecma_string_t *parent_p = (ecma_string_t *) string_p;
+
+  if (ECMA_STRING_GET_CONTAINER (parent_p) == ECMA_STRING_CONTAINER_ROPE)
+  {
+    parent_p = ecma_rope_string_flatten (parent_p);
+  }
+  else if (ECMA_STRING_GET_CONTAINER (parent_p) == ECMA_STRING_CONTAINER_SLICE)
+  {
+    parent_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, ((ecma_slice_string_t *) parent_p)->parent_cp);
+  }
+
+  lit_utf8_size_t parent_size;
+  const lit_utf8_byte_t *parent_chars_p = ecma_string_get_chars_fast (parent_p, &parent_size);
+
+  JERRY_ASSERT (start_p >= parent_chars_p && start_p + size <= parent_chars_p + parent_size);
+
+  if (parent_size / ECMA_SLICE_STRING_MAX_PARENT_RATIO > size)
+  {
+    return NULL;
+  }
+
+  ecma_ref_ecma_string (parent_p);
+
+  ecma_slice_string_t *slice_p = (ecma_slice_string_t *) ecma_alloc_string_buffer (sizeof (ecma_slice_string_t));
+  slice_p->header.refs_and_container = ECMA_STRING_CONTAINER_SLICE | ECMA_STRING_REF_ONE;
+  slice_p->header.u.hash = lit_utf8_string_calc_hash (start_p, size);
+  slice_p->size = size;
+  slice_p->length = length;
+  slice_p->offset = (lit_utf8_size_t) (start_p - parent_chars_p);
+  ECMA_SET_NON_NULL_POINTER (slice_p->parent_cp, parent_p);
+
+  return (ecma_string_t *) slice_p;
+} /* ecma_new_ecma_slice_string */
+
 /**
  * Create a substring from an ecma string
  *
@@ -2404,25 +2819,37 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
 
   ECMA_STRING_TO_UTF8_STRING (string_p, start_p, buffer_size);
 
+  const lit_utf8_byte_t *substr_start_p = start_p;
+  lit_utf8_size_t substr_size;
+
   if (string_length == buffer_size)
   {
-    ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p + start_pos,
-                                                    (lit_utf8_size_t) end_pos);
+    substr_start_p += start_pos;
+    substr_size = (lit_utf8_size_t) end_pos;
   }
   else
   {
     while (start_pos--)
     {
-      start_p += lit_get_unicode_char_size_by_utf8_first_byte (*start_p);
+      substr_start_p += lit_get_unicode_char_size_by_utf8_first_byte (*substr_start_p);
     }
 
-    const lit_utf8_byte_t *end_p = start_p;
-    while (end_pos--)
+    const lit_utf8_byte_t *end_p = substr_start_p;
+    ecma_length_t length = end_pos;
+
+    while (length--)
     {
       end_p += lit_get_unicode_char_size_by_utf8_first_byte (*end_p);
     }
 
-    ecma_string_p = ecma_new_ecma_string_from_utf8 (start_p, (lit_utf8_size_t) (end_p - start_p));
+    substr_size = (lit_utf8_size_t) (end_p - substr_start_p);
+  }
+
+  ecma_string_p = ecma_new_ecma_slice_string (string_p, substr_start_p, substr_size, end_pos);
+
+  if (ecma_string_p == NULL)
+  {
+    ecma_string_p = ecma_new_ecma_string_from_utf8 (substr_start_p, substr_size);
   }
 
   ECMA_FINALIZE_UTF8_STRING (start_p, buffer_size);
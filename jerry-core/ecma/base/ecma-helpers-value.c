@@ -42,11 +42,41 @@ JERRY_STATIC_ASSERT (sizeof (uintptr_t) <= sizeof (ecma_value_t),
 
 #else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
 
-JERRY_STATIC_ASSERT (sizeof (uintptr_t) > sizeof (ecma_value_t),
-                     uintptr_t_must_not_fit_in_ecma_value_t);
+JERRY_STATIC_ASSERT (sizeof (uintptr_t) > sizeof (uint32_t),
+                     uintptr_t_must_not_fit_in_the_low_32_bits_of_ecma_value_t);
 
 #endif /* ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
 
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+
+JERRY_STATIC_ASSERT (sizeof (ecma_value_t) == sizeof (ecma_number_t),
+                     size_of_ecma_value_t_must_be_equal_to_the_size_of_ecma_number_t);
+
+/**
+ * Mask for checking the type of values which are not floating point numbers.
+ * The bits of floating point numbers never match to these types.
+ */
+#define ECMA_VALUE_TYPE_CHECK_MASK (ECMA_VALUE_FLOAT_MASK | ECMA_VALUE_TYPE_MASK)
+
+/**
+ * Mask for checking the type of directly encoded values.
+ */
+#define ECMA_DIRECT_TYPE_CHECK_MASK (ECMA_VALUE_FLOAT_MASK | ECMA_DIRECT_TYPE_MASK)
+
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
+
+/**
+ * Mask for checking the type of values which are not floating point numbers.
+ */
+#define ECMA_VALUE_TYPE_CHECK_MASK ECMA_VALUE_TYPE_MASK
+
+/**
+ * Mask for checking the type of directly encoded values.
+ */
+#define ECMA_DIRECT_TYPE_CHECK_MASK ECMA_DIRECT_TYPE_MASK
+
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
+
 JERRY_STATIC_ASSERT ((ECMA_VALUE_FALSE | (1 << ECMA_DIRECT_SHIFT)) == ECMA_VALUE_TRUE
                      && ECMA_VALUE_FALSE != ECMA_VALUE_TRUE,
                      only_the_lowest_bit_must_be_different_for_simple_value_true_and_false);
@@ -66,7 +96,14 @@ JERRY_STATIC_ASSERT ((ECMA_VALUE_FALSE | (1 << ECMA_DIRECT_SHIFT)) == ECMA_VALUE
 static inline ecma_type_t JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_get_value_type_field (ecma_value_t value) /**< ecma value */
 {
-  return value & ECMA_VALUE_TYPE_MASK;
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+  if (value >= ECMA_VALUE_FLOAT_OFFSET)
+  {
+    return ECMA_TYPE_FLOAT;
+  }
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
+
+  return (ecma_type_t) (value & ECMA_VALUE_TYPE_MASK);
 } /* ecma_get_value_type_field */
 
 /**
@@ -119,7 +156,7 @@ ecma_get_pointer_from_ecma_value (ecma_value_t value) /**< value */
 inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_direct (ecma_value_t value) /**< ecma value */
 {
-  return (ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT);
+  return ((value & ECMA_VALUE_TYPE_CHECK_MASK) == ECMA_TYPE_DIRECT);
 } /* ecma_is_value_direct */
 
 /**
@@ -131,7 +168,7 @@ ecma_is_value_direct (ecma_value_t value) /**< ecma value */
 inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_simple (ecma_value_t value) /**< ecma value */
 {
-  return (value & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_SIMPLE_VALUE;
+  return (value & ECMA_DIRECT_TYPE_CHECK_MASK) == ECMA_DIRECT_TYPE_SIMPLE_VALUE;
 } /* ecma_is_value_simple */
 
 /**
@@ -252,7 +289,7 @@ ecma_is_value_array_hole (ecma_value_t value) /**< ecma value */
 inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_integer_number (ecma_value_t value) /**< ecma value */
 {
-  return (value & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
+  return (value & ECMA_DIRECT_TYPE_CHECK_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
 } /* ecma_is_value_integer_number */
 
 /**
@@ -268,7 +305,7 @@ ecma_are_values_integer_numbers (ecma_value_t first_value, /**< first ecma value
   JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_INTEGER_VALUE == 0,
                        ecma_direct_type_integer_value_must_be_zero);
 
-  return ((first_value | second_value) & ECMA_DIRECT_TYPE_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
+  return ((first_value | second_value) & ECMA_DIRECT_TYPE_CHECK_MASK) == ECMA_DIRECT_TYPE_INTEGER_VALUE;
 } /* ecma_are_values_integer_numbers */
 
 /**
@@ -280,7 +317,11 @@ ecma_are_values_integer_numbers (ecma_value_t first_value, /**< first ecma value
 inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_float_number (ecma_value_t value) /**< ecma value */
 {
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+  return value >= ECMA_VALUE_FLOAT_OFFSET;
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
   return (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
 } /* ecma_is_value_float_number */
 
 /**
@@ -308,7 +349,7 @@ JERRY_STATIC_ASSERT ((ECMA_TYPE_STRING | 0x4) == ECMA_TYPE_DIRECT_STRING,
 extern inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_string (ecma_value_t value) /**< ecma value */
 {
-  return ((value & (ECMA_VALUE_TYPE_MASK - 0x4)) == ECMA_TYPE_STRING);
+  return ((value & (ECMA_VALUE_TYPE_CHECK_MASK - 0x4)) == ECMA_TYPE_STRING);
 } /* ecma_is_value_string */
 
 #if ENABLED (JERRY_ES2015_BUILTIN_SYMBOL)
@@ -321,7 +362,7 @@ ecma_is_value_string (ecma_value_t value) /**< ecma value */
 inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_symbol (ecma_value_t value) /**< ecma value */
 {
-  return (ecma_get_value_type_field (value) == ECMA_TYPE_SYMBOL);
+  return ((value & ECMA_VALUE_TYPE_CHECK_MASK) == ECMA_TYPE_SYMBOL);
 } /* ecma_is_value_symbol */
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
 
@@ -350,7 +391,7 @@ ecma_is_value_prop_name (ecma_value_t value) /**< ecma value */
 inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_direct_string (ecma_value_t value) /**< ecma value */
 {
-  return (ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT_STRING);
+  return ((value & ECMA_VALUE_TYPE_CHECK_MASK) == ECMA_TYPE_DIRECT_STRING);
 } /* ecma_is_value_direct_string */
 
 /**
@@ -362,7 +403,7 @@ ecma_is_value_direct_string (ecma_value_t value) /**< ecma value */
 inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_non_direct_string (ecma_value_t value) /**< ecma value */
 {
-  return (ecma_get_value_type_field (value) == ECMA_TYPE_STRING);
+  return ((value & ECMA_VALUE_TYPE_CHECK_MASK) == ECMA_TYPE_STRING);
 } /* ecma_is_value_non_direct_string */
 
 /**
@@ -374,7 +415,7 @@ ecma_is_value_non_direct_string (ecma_value_t value) /**< ecma value */
 inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_object (ecma_value_t value) /**< ecma value */
 {
-  return (ecma_get_value_type_field (value) == ECMA_TYPE_OBJECT);
+  return ((value & ECMA_VALUE_TYPE_CHECK_MASK) == ECMA_TYPE_OBJECT);
 } /* ecma_is_value_object */
 
 /**
@@ -386,7 +427,7 @@ ecma_is_value_object (ecma_value_t value) /**< ecma value */
 inline bool JERRY_ATTR_CONST JERRY_ATTR_ALWAYS_INLINE
 ecma_is_value_error_reference (ecma_value_t value) /**< ecma value */
 {
-  return (ecma_get_value_type_field (value) == ECMA_TYPE_ERROR);
+  return ((value & ECMA_VALUE_TYPE_CHECK_MASK) == ECMA_TYPE_ERROR);
 } /* ecma_is_value_error_reference */
 
 /**
@@ -429,7 +470,7 @@ ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number
 {
   JERRY_ASSERT (ECMA_IS_INTEGER_NUMBER (integer_value));
 
-  return (((ecma_value_t) integer_value) << ECMA_DIRECT_SHIFT) | ECMA_DIRECT_TYPE_INTEGER_VALUE;
+  return (ecma_value_t) ((((uint32_t) integer_value) << ECMA_DIRECT_SHIFT) | ECMA_DIRECT_TYPE_INTEGER_VALUE);
 } /* ecma_make_integer_value */
 
 /**
@@ -440,13 +481,26 @@ ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer number
 static ecma_value_t
 ecma_create_float_number (ecma_number_t ecma_number) /**< value of the float number */
 {
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+  if (JERRY_UNLIKELY (ecma_number_is_nan (ecma_number)))
+  {
+    ecma_number = ecma_number_make_nan ();
+  }
+
+  ecma_number_accessor_t u;
+  u.as_ecma_number_t = ecma_number;
+  return u.as_uint64_t + ECMA_VALUE_FLOAT_OFFSET;
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
   ecma_number_t *ecma_num_p = ecma_alloc_number ();
 
   *ecma_num_p = ecma_number;
 
   return ecma_pointer_to_ecma_value (ecma_num_p) | ECMA_TYPE_FLOAT;
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
 } /* ecma_create_float_number */
 
+#if !ENABLED (JERRY_VALUE_NAN_BOXING)
+
 /**
  * Encode float number without checks.
  *
@@ -458,6 +512,8 @@ ecma_make_float_value (ecma_number_t *ecma_num_p) /**< pointer to the float numb
   return ecma_pointer_to_ecma_value (ecma_num_p) | ECMA_TYPE_FLOAT;
 } /* ecma_make_float_value */
 
+#endif /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
+
 /**
  * Create a new NaN value.
  *
@@ -642,7 +698,7 @@ ecma_get_integer_from_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_is_value_integer_number (value));
 
-  return ((ecma_integer_value_t) value) >> ECMA_DIRECT_SHIFT;
+  return ((ecma_integer_value_t) (uint32_t) value) >> ECMA_DIRECT_SHIFT;
 } /* ecma_get_integer_from_value */
 
 /**
@@ -655,9 +711,17 @@ ecma_get_float_from_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_FLOAT);
 
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+  ecma_number_accessor_t u;
+  u.as_uint64_t = value - ECMA_VALUE_FLOAT_OFFSET;
+  return u.as_ecma_number_t;
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
   return *(ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
 } /* ecma_get_float_from_value */
 
+#if !ENABLED (JERRY_VALUE_NAN_BOXING)
+
 /**
  * Get floating point value pointer from an ecma value
  *
@@ -671,6 +735,8 @@ ecma_get_pointer_from_float_value (ecma_value_t value) /**< ecma value */
   return (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 } /* ecma_get_pointer_from_float_value */
 
+#endif /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
+
 /**
  * Get floating point value from an ecma value
  *
@@ -787,12 +853,14 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
 {
   switch (ecma_get_value_type_field (value))
   {
+#if !ENABLED (JERRY_VALUE_NAN_BOXING)
     case ECMA_TYPE_FLOAT:
     {
       ecma_number_t *num_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
 
       return ecma_create_float_number (*num_p);
     }
+#endif /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
     case ECMA_TYPE_STRING:
     {
       ecma_ref_ecma_string (ecma_get_string_from_value (value));
@@ -813,7 +881,8 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
     default:
     {
       JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT
-                    || ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT_STRING);
+                    || ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT_STRING
+                    || ecma_is_value_float_number (value));
 
       return value;
     }
@@ -834,7 +903,7 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
 inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
 ecma_fast_copy_value (ecma_value_t value)  /**< value description */
 {
-  return (ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT) ? value : ecma_copy_value (value);
+  return ecma_is_value_direct (value) ? value : ecma_copy_value (value);
 } /* ecma_fast_copy_value */
 
 /**
@@ -845,7 +914,7 @@ ecma_fast_copy_value (ecma_value_t value)  /**< value description */
 ecma_value_t
 ecma_copy_value_if_not_object (ecma_value_t value) /**< value description */
 {
-  if (ecma_get_value_type_field (value) != ECMA_TYPE_OBJECT)
+  if (!ecma_is_value_object (value))
   {
     return ecma_copy_value (value);
   }
@@ -875,6 +944,7 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
   {
     *value_p = ecma_value;
   }
+#if !ENABLED (JERRY_VALUE_NAN_BOXING)
   else if (ecma_is_value_float_number (ecma_value)
            && ecma_is_value_float_number (*value_p))
   {
@@ -883,6 +953,7 @@ ecma_value_assign_value (ecma_value_t *value_p, /**< [in, out] ecma value */
 
     *num_dst_p = *num_src_p;
   }
+#endif /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
   else
   {
     ecma_free_value_if_not_object (*value_p);
@@ -904,6 +975,9 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
 {
   JERRY_ASSERT (ecma_is_value_float_number (float_value));
 
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+  return ecma_make_number_value (new_number);
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
   ecma_integer_value_t integer_number = (ecma_integer_value_t) new_number;
   ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (float_value);
 
@@ -917,6 +991,7 @@ ecma_update_float_number (ecma_value_t float_value, /**< original float value */
 
   *number_p = new_number;
   return float_value;
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
 } /* ecma_update_float_number */
 
 /**
@@ -929,6 +1004,7 @@ static void
 ecma_value_assign_float_number (ecma_value_t *value_p, /**< [in, out] ecma value */
                                 ecma_number_t ecma_number) /**< number to assign */
 {
+#if !ENABLED (JERRY_VALUE_NAN_BOXING)
   if (ecma_is_value_float_number (*value_p))
   {
     ecma_number_t *num_dst_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (*value_p);
@@ -936,9 +1012,10 @@ ecma_value_assign_float_number (ecma_value_t *value_p, /**< [in, out] ecma value
     *num_dst_p = ecma_number;
     return;
   }
+#endif /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
 
-  if (ecma_get_value_type_field (*value_p) != ECMA_TYPE_DIRECT
-      && ecma_get_value_type_field (*value_p) != ECMA_TYPE_OBJECT)
+  if (!ecma_is_value_direct (*value_p)
+      && !ecma_is_value_object (*value_p))
   {
     ecma_free_value (*value_p);
   }
@@ -962,8 +1039,8 @@ ecma_value_assign_number (ecma_value_t *value_p, /**< [in, out] ecma value */
       && ((integer_value == 0) ? ecma_is_number_equal_to_positive_zero (ecma_number)
                                : ECMA_IS_INTEGER_NUMBER (integer_value)))
   {
-    if (ecma_get_value_type_field (*value_p) != ECMA_TYPE_DIRECT
-        && ecma_get_value_type_field (*value_p) != ECMA_TYPE_OBJECT)
+    if (!ecma_is_value_direct (*value_p)
+        && !ecma_is_value_object (*value_p))
     {
       ecma_free_value (*value_p);
     }
@@ -982,12 +1059,14 @@ ecma_free_value (ecma_value_t value) /**< value description */
 {
   switch (ecma_get_value_type_field (value))
   {
+#if !ENABLED (JERRY_VALUE_NAN_BOXING)
     case ECMA_TYPE_FLOAT:
     {
       ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
       ecma_dealloc_number (number_p);
       break;
     }
+#endif /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
 
     case ECMA_TYPE_STRING:
     {
@@ -1011,7 +1090,8 @@ ecma_free_value (ecma_value_t value) /**< value description */
     default:
     {
       JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT
-                    || ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT_STRING);
+                    || ecma_get_value_type_field (value) == ECMA_TYPE_DIRECT_STRING
+                    || ecma_is_value_float_number (value));
 
       /* no memory is allocated */
       break;
@@ -1031,7 +1111,7 @@ ecma_free_value (ecma_value_t value) /**< value description */
 inline void JERRY_ATTR_ALWAYS_INLINE
 ecma_fast_free_value (ecma_value_t value) /**< value description */
 {
-  if (ecma_get_value_type_field (value) != ECMA_TYPE_DIRECT)
+  if (!ecma_is_value_direct (value))
   {
     ecma_free_value (value);
   }
@@ -1043,7 +1123,7 @@ ecma_fast_free_value (ecma_value_t value) /**< value description */
 void
 ecma_free_value_if_not_object (ecma_value_t value) /**< value description */
 {
-  if (ecma_get_value_type_field (value) != ECMA_TYPE_OBJECT)
+  if (!ecma_is_value_object (value))
   {
     ecma_free_value (value);
   }
@@ -1057,11 +1137,15 @@ ecma_free_number (ecma_value_t value) /**< value description */
 {
   JERRY_ASSERT (ecma_is_value_number (value));
 
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+  JERRY_UNUSED (value);
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
   if (ecma_is_value_float_number (value))
   {
     ecma_number_t *number_p = (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
     ecma_dealloc_number (number_p);
   }
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
 } /* ecma_free_number */
 
 /**
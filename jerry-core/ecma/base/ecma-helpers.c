@@ -17,11 +17,14 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "ecma-icache.h"
 #include "ecma-lcache.h"
 #include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 #include "jrt-bit-fields.h"
 #include "byte-code.h"
+#include "js-parser.h"
 #include "re-compiler.h"
 #include "ecma-builtins.h"
 
@@ -51,8 +54,16 @@ JERRY_STATIC_ASSERT (ECMA_OBJECT_TYPE_MASK + 1 == ECMA_OBJECT_FLAG_BUILT_IN_OR_L
 JERRY_STATIC_ASSERT (ECMA_OBJECT_FLAG_EXTENSIBLE == (ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV << 1),
                      ecma_extensible_flag_must_follow_the_built_in_flag);
 
+#if ENABLED (JERRY_GC_INCREMENTAL)
+JERRY_STATIC_ASSERT (ECMA_OBJECT_FLAG_GC_MARKED == (ECMA_OBJECT_FLAG_EXTENSIBLE << 1),
+                     ecma_object_gc_marked_flag_must_follow_the_extensible_flag);
+
+JERRY_STATIC_ASSERT (ECMA_OBJECT_REF_ONE == (ECMA_OBJECT_FLAG_GC_MARKED << 1),
+                     ecma_object_ref_one_must_follow_the_gc_marked_flag);
+#else /* !ENABLED (JERRY_GC_INCREMENTAL) */
 JERRY_STATIC_ASSERT (ECMA_OBJECT_REF_ONE == (ECMA_OBJECT_FLAG_EXTENSIBLE << 1),
                      ecma_object_ref_one_must_follow_the_extensible_flag);
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
 
 JERRY_STATIC_ASSERT ((ECMA_OBJECT_MAX_REF | (ECMA_OBJECT_REF_ONE - 1)) == UINT16_MAX,
                      ecma_object_max_ref_does_not_fill_the_remaining_bits);
@@ -60,6 +71,12 @@ JERRY_STATIC_ASSERT ((ECMA_OBJECT_MAX_REF | (ECMA_OBJECT_REF_ONE - 1)) == UINT16
 JERRY_STATIC_ASSERT (ECMA_PROPERTY_TYPE_DELETED == (ECMA_DIRECT_STRING_MAGIC << ECMA_PROPERTY_NAME_TYPE_SHIFT),
                      ecma_property_type_deleted_must_have_magic_string_name_type);
 
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+JERRY_STATIC_ASSERT (offsetof (ecma_property_header_t, types) == 0
+                     && offsetof (ecma_property_pair_t, values) == sizeof (ecma_value_t),
+                     property_types_must_be_in_the_first_value_slot_of_property_pairs);
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
+
 /**
  * Create an object with specified prototype object
  * (or NULL prototype if there is not prototype for the object)
@@ -336,6 +353,25 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
   JERRY_ASSERT (name_p != NULL);
   JERRY_ASSERT (object_p != NULL);
 
+  ECMA_GC_WRITE_BARRIER (object_p);
+
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+  ecma_property_t *shape_property_p = ecma_shape_create_property (object_p, name_p, type_and_flags);
+
+  if (shape_property_p != NULL)
+  {
+    ecma_property_value_t *shape_value_p = ECMA_PROPERTY_VALUE_PTR (shape_property_p);
+
+    if (out_prop_p != NULL)
+    {
+      *out_prop_p = shape_property_p;
+    }
+
+    *shape_value_p = value;
+    return shape_value_p;
+  }
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
   jmem_cpointer_t *property_list_head_p = &object_p->u1.property_list_cp;
 
   if (*property_list_head_p != ECMA_NULL_POINTER)
@@ -552,6 +588,29 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
 
   jmem_cpointer_t prop_iter_cp = obj_p->u1.property_list_cp;
 
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+  if (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                     prop_iter_cp);
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+    {
+      jmem_cpointer_t property_shape_name_cp;
+      property_p = ecma_shape_find_property ((ecma_shape_storage_t *) prop_iter_p,
+                                             name_p,
+                                             &property_shape_name_cp);
+#if ENABLED (JERRY_LCACHE)
+      if (property_p != NULL
+          && !ecma_is_property_lcached (property_p))
+      {
+        ecma_lcache_insert (obj_p, property_shape_name_cp, property_p);
+      }
+#endif /* ENABLED (JERRY_LCACHE) */
+      return property_p;
+    }
+  }
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
   if (prop_iter_cp != JMEM_CP_NULL)
   {
@@ -752,6 +811,10 @@ ecma_free_property (ecma_object_t *object_p, /**< object the property belongs to
   }
 #endif /* ENABLED (JERRY_LCACHE) */
 
+#if ENABLED (JERRY_ICACHE)
+  ecma_icache_invalidate ();
+#endif /* ENABLED (JERRY_ICACHE) */
+
   if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_PTR)
   {
     ecma_string_t *prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp);
@@ -768,6 +831,15 @@ void
 ecma_delete_property (ecma_object_t *object_p, /**< object */
                       ecma_property_value_t *prop_value_p) /**< property value reference */
 {
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+  if (!ecma_is_lexical_environment (object_p)
+      && ecma_shape_get_storage (object_p) != NULL)
+  {
+    ecma_shape_delete_property (object_p, prop_value_p);
+    return;
+  }
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
   jmem_cpointer_t cur_prop_cp = object_p->u1.property_list_cp;
 
   ecma_property_header_t *prev_prop_p = NULL;
@@ -875,6 +947,27 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
 
   ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
 
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+  if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_SHAPE)
+  {
+    ecma_shape_storage_t *storage_p = (ecma_shape_storage_t *) prop_iter_p;
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, storage_p->shape_cp);
+
+    for (uint32_t index = 0; index < shape_p->count; index++)
+    {
+      ecma_property_t *property_p = ecma_shape_get_property (storage_p, index);
+
+      if (ECMA_PROPERTY_VALUE_PTR (property_p) == prop_value_p)
+      {
+        JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (*property_p) == type);
+        return;
+      }
+    }
+
+    JERRY_UNREACHABLE ();
+  }
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
   if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
   {
     prop_iter_cp = prop_iter_p->next_property_cp;
@@ -919,6 +1012,8 @@ ecma_named_data_property_assign_value (ecma_object_t *obj_p, /**< object */
 {
   ecma_assert_object_contains_the_property (obj_p, prop_value_p, ECMA_PROPERTY_TYPE_NAMEDDATA);
 
+  ECMA_GC_WRITE_BARRIER (obj_p);
+
   ecma_value_assign_value (&prop_value_p->value, value);
 } /* ecma_named_data_property_assign_value */
 
@@ -946,6 +1041,7 @@ ecma_set_named_accessor_property_getter (ecma_object_t *object_p, /**< the prope
                                          ecma_object_t *getter_p) /**< getter object */
 {
   ecma_assert_object_contains_the_property (object_p, prop_value_p, ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+  ECMA_GC_WRITE_BARRIER (object_p);
 
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   ecma_getter_setter_pointers_t *getter_setter_pair_p;
@@ -966,6 +1062,7 @@ ecma_set_named_accessor_property_setter (ecma_object_t *object_p, /**< the prope
                                          ecma_object_t *setter_p) /**< setter object */
 {
   ecma_assert_object_contains_the_property (object_p, prop_value_p, ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+  ECMA_GC_WRITE_BARRIER (object_p);
 
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   ecma_getter_setter_pointers_t *getter_setter_pair_p;
@@ -1169,12 +1266,24 @@ ecma_free_property_descriptor (ecma_property_descriptor_t *prop_desc_p) /**< pro
   *prop_desc_p = ecma_make_empty_property_descriptor ();
 } /* ecma_free_property_descriptor */
 
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+
+/**
+ * The size of error reference must be 16 bytes to use jmem_pools_alloc().
+ */
+JERRY_STATIC_ASSERT (sizeof (ecma_error_reference_t) == 16,
+                     ecma_error_reference_size_must_be_16_bytes);
+
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
+
 /**
  * The size of error reference must be 8 bytes to use jmem_pools_alloc().
  */
 JERRY_STATIC_ASSERT (sizeof (ecma_error_reference_t) == 8,
                      ecma_error_reference_size_must_be_8_bytes);
 
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
+
 /**
  * Create an error reference from a given value.
  *
@@ -1323,8 +1432,21 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
     return;
   }
 
+#if ENABLED (JERRY_PARSER)
+  if (JERRY_UNLIKELY (bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION))
+  {
+    parser_free_lazy_function (bytecode_p);
+    return;
+  }
+#endif /* ENABLED (JERRY_PARSER) */
+
   if (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
   {
+#if ENABLED (JERRY_ICACHE)
+    /* The identifier accesses of the byte code are cached by their address. */
+    ecma_icache_invalidate ();
+#endif /* ENABLED (JERRY_ICACHE) */
+
     ecma_value_t *literal_start_p = NULL;
     uint32_t literal_end;
     uint32_t const_literal_end;
@@ -190,7 +190,9 @@ void ecma_check_value_type_is_spec_defined (ecma_value_t value);
 ecma_value_t JERRY_ATTR_CONST ecma_make_boolean_value (bool boolean_value);
 ecma_value_t JERRY_ATTR_CONST ecma_make_integer_value (ecma_integer_value_t integer_value);
 ecma_value_t ecma_make_nan_value (void);
+#if !ENABLED (JERRY_VALUE_NAN_BOXING)
 ecma_value_t ecma_make_float_value (ecma_number_t *ecma_num_p);
+#endif /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
 ecma_value_t ecma_make_number_value (ecma_number_t ecma_number);
 ecma_value_t ecma_make_int32_value (int32_t int32_number);
 ecma_value_t ecma_make_uint32_value (uint32_t uint32_number);
@@ -204,7 +206,9 @@ ecma_value_t JERRY_ATTR_PURE ecma_make_object_value (const ecma_object_t *object
 ecma_value_t JERRY_ATTR_PURE ecma_make_error_reference_value (const ecma_error_reference_t *error_ref_p);
 ecma_integer_value_t JERRY_ATTR_CONST ecma_get_integer_from_value (ecma_value_t value);
 ecma_number_t JERRY_ATTR_PURE ecma_get_float_from_value (ecma_value_t value);
+#if !ENABLED (JERRY_VALUE_NAN_BOXING)
 ecma_number_t * ecma_get_pointer_from_float_value (ecma_value_t value);
+#endif /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
 ecma_number_t JERRY_ATTR_PURE ecma_get_number_from_value (ecma_value_t value);
 ecma_string_t JERRY_ATTR_PURE *ecma_get_string_from_value (ecma_value_t value);
 #if ENABLED (JERRY_ES2015_BUILTIN_SYMBOL)
@@ -231,10 +235,6 @@ lit_magic_string_id_t ecma_get_typeof_lit_id (ecma_value_t value);
 ecma_string_t *ecma_new_symbol_from_descriptor_string (ecma_value_t string_desc);
 bool ecma_prop_name_is_symbol (ecma_string_t *string_p);
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
-#if ENABLED (JERRY_ES2015_BUILTIN_MAP) || ENABLED (JERRY_ES2015_BUILTIN_SET)
-ecma_string_t *ecma_new_map_key_string (ecma_value_t value);
-bool ecma_prop_name_is_map_key (ecma_string_t *string_p);
-#endif /* ENABLED (JERRY_ES2015_BUILTIN_MAP) || ENABLED (JERRY_ES2015_BUILTIN_SET) */
 ecma_string_t *ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, lit_utf8_size_t string_size);
 ecma_string_t *ecma_new_ecma_string_from_utf8_converted_to_cesu8 (const lit_utf8_byte_t *string_p,
                                                                   lit_utf8_size_t string_size);
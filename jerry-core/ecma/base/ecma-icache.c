@@ -0,0 +1,443 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-icache.h"
+#include "ecma-shape.h"
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaicache Inline property cache
+ * @{
+ */
+
+#if ENABLED (JERRY_ICACHE)
+
+/**
+ * Compute the row index of a property access site
+ *
+ * Note:
+ *      each site has its own row (unless two sites collide), so the objects
+ *      accessed by one site do not evict the entries of other sites
+ *
+ * @return row index
+ */
+static inline size_t JERRY_ATTR_ALWAYS_INLINE
+ecma_icache_row_index (const uint8_t *site_p) /**< byte code of the property access */
+{
+  return (size_t) ((uintptr_t) site_p & (ECMA_ICACHE_ROWS_COUNT - 1));
+} /* ecma_icache_row_index */
+
+/**
+ * Compute the row index of an identifier access site in the binding cache
+ *
+ * @return row index
+ */
+static inline size_t JERRY_ATTR_ALWAYS_INLINE
+ecma_icache_binding_row_index (const uint8_t *site_p) /**< byte code of the identifier access */
+{
+  return (size_t) ((uintptr_t) site_p & (ECMA_ICACHE_BINDING_ROWS_COUNT - 1));
+} /* ecma_icache_binding_row_index */
+
+/**
+ * Lookup the own property of an object in the row of an access site
+ *
+ * Note:
+ *      objects with a shape are looked up by their shape, so the
+ *      entries are shared by all objects with the same shape
+ *
+ * @return a pointer to an ecma_property_t if the lookup is successful
+ *         NULL otherwise
+ */
+inline ecma_property_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_icache_lookup (const uint8_t *site_p, /**< byte code of the property access */
+                    const ecma_object_t *object_p, /**< object */
+                    ecma_value_t name) /**< property name */
+{
+  JERRY_ASSERT (object_p != NULL);
+
+  ecma_icache_entry_t *entry_p = JERRY_CONTEXT (icache) [ecma_icache_row_index (site_p)];
+  ecma_icache_entry_t *entry_end_p = entry_p + ECMA_ICACHE_ROW_LENGTH;
+  uint32_t epoch = JERRY_CONTEXT (icache_epoch);
+
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    ecma_shape_storage_t *storage_p = ecma_shape_get_storage (object_p);
+
+    if (storage_p != NULL)
+    {
+      do
+      {
+        if (entry_p->object_cp == storage_p->shape_cp
+            && entry_p->name == name
+            && entry_p->epoch == epoch)
+        {
+          return ecma_shape_get_property (storage_p, entry_p->u.index);
+        }
+        entry_p++;
+      }
+      while (entry_p < entry_end_p);
+
+      return NULL;
+    }
+  }
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
+  jmem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  do
+  {
+    if (entry_p->object_cp == object_cp
+        && entry_p->name == name
+        && entry_p->epoch == epoch)
+    {
+      JERRY_ASSERT (entry_p->u.prop_p != NULL);
+      return entry_p->u.prop_p;
+    }
+    entry_p++;
+  }
+  while (entry_p < entry_end_p);
+
+  return NULL;
+} /* ecma_icache_lookup */
+
+/**
+ * Insert an own property of an object into the row of an access site
+ */
+void
+ecma_icache_insert (const uint8_t *site_p, /**< byte code of the property access */
+                    const ecma_object_t *object_p, /**< object */
+                    ecma_value_t name, /**< property name */
+                    ecma_property_t *prop_p) /**< property */
+{
+  JERRY_ASSERT (object_p != NULL && prop_p != NULL);
+  JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (*prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+  ecma_icache_entry_t *entry_p = JERRY_CONTEXT (icache) [ecma_icache_row_index (site_p)];
+  uint32_t epoch = JERRY_CONTEXT (icache_epoch);
+  uint32_t index = 0;
+
+  /* Reuse outdated entries first, otherwise the oldest entry is dropped. */
+  while (index < ECMA_ICACHE_ROW_LENGTH - 1 && entry_p[index].epoch == epoch)
+  {
+    index++;
+  }
+
+  while (index > 0)
+  {
+    entry_p[index] = entry_p[index - 1];
+    index--;
+  }
+
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+  ecma_shape_storage_t *storage_p = NULL;
+
+  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL)
+  {
+    storage_p = ecma_shape_get_storage (object_p);
+  }
+
+  if (storage_p != NULL)
+  {
+    entry_p->u.index = ecma_shape_get_property_index (storage_p, prop_p);
+    entry_p->object_cp = storage_p->shape_cp;
+  }
+  else
+  {
+    entry_p->u.prop_p = prop_p;
+    ECMA_SET_NON_NULL_POINTER (entry_p->object_cp, object_p);
+  }
+#else /* !ENABLED (JERRY_PROPERTY_SHAPES) */
+  entry_p->u.prop_p = prop_p;
+  ECMA_SET_NON_NULL_POINTER (entry_p->object_cp, object_p);
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
+  entry_p->name = name;
+  entry_p->epoch = epoch;
+} /* ecma_icache_insert */
+
+/**
+ * Invalidate all icache entries
+ *
+ * Note:
+ *      must be called before a property or a shape is freed, since the freed
+ *      memory can be reused by another property or shape later
+ */
+inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_icache_invalidate (void)
+{
+  if (JERRY_UNLIKELY (++JERRY_CONTEXT (icache_epoch) == 0))
+  {
+    /* Entries of the previous epoch cycle could become valid again. */
+    memset (JERRY_CONTEXT (icache), 0, sizeof (JERRY_CONTEXT (icache)));
+    memset (JERRY_CONTEXT (icache_bindings), 0, sizeof (JERRY_CONTEXT (icache_bindings)));
+  }
+} /* ecma_icache_invalidate */
+
+/**
+ * Compute the index of a binding in the property list of a declarative environment
+ *
+ * @return index of the binding - if it is small enough to be cached
+ *         ECMA_ICACHE_BINDING_NO_INDEX - otherwise
+ */
+static uint16_t
+ecma_icache_get_binding_index (ecma_object_t *lex_env_p, /**< declarative lexical environment */
+                               ecma_property_t *property_p) /**< binding of the environment */
+{
+  jmem_cpointer_t prop_iter_cp = lex_env_p->u1.property_list_cp;
+  uint16_t index = 0;
+
+  while (prop_iter_cp != JMEM_CP_NULL && index < ECMA_ICACHE_BINDING_NO_INDEX)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+    {
+      prop_iter_cp = prop_iter_p->next_property_cp;
+      continue;
+    }
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    if (property_p == prop_iter_p->types + 0)
+    {
+      return index;
+    }
+
+    if (property_p == prop_iter_p->types + 1)
+    {
+      return (uint16_t) (index + 1);
+    }
+
+    index = (uint16_t) (index + ECMA_PROPERTY_PAIR_ITEM_COUNT);
+    prop_iter_cp = prop_iter_p->next_property_cp;
+  }
+
+  return ECMA_ICACHE_BINDING_NO_INDEX;
+} /* ecma_icache_get_binding_index */
+
+/**
+ * Get the binding of a declarative environment at the given index
+ *
+ * @return pointer to the binding - if it exists and its name matches
+ *         NULL - otherwise
+ */
+static ecma_property_t *
+ecma_icache_get_binding_at (ecma_object_t *lex_env_p, /**< lexical environment */
+                            uint32_t index, /**< index of the binding */
+                            ecma_string_t *name_p) /**< identifier name */
+{
+  if (ecma_get_lex_env_type (lex_env_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  {
+    return NULL;
+  }
+
+  jmem_cpointer_t prop_iter_cp = lex_env_p->u1.property_list_cp;
+
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
+  if (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+    {
+      prop_iter_cp = prop_iter_p->next_property_cp;
+    }
+  }
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+
+  uint32_t pair_count = index / ECMA_PROPERTY_PAIR_ITEM_COUNT;
+
+  while (true)
+  {
+    if (prop_iter_cp == JMEM_CP_NULL)
+    {
+      return NULL;
+    }
+
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+    if (pair_count == 0)
+    {
+      JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+      uint32_t item = index % ECMA_PROPERTY_PAIR_ITEM_COUNT;
+      ecma_property_t *property_p = prop_iter_p->types + item;
+
+      if (ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+          && ecma_string_compare_to_property_name (*property_p,
+                                                   ((ecma_property_pair_t *) prop_iter_p)->names_cp[item],
+                                                   name_p))
+      {
+        return property_p;
+      }
+      return NULL;
+    }
+
+    pair_count--;
+    prop_iter_cp = prop_iter_p->next_property_cp;
+  }
+} /* ecma_icache_get_binding_at */
+
+/**
+ * Store the result of an identifier resolution in the row of an access site
+ */
+static void
+ecma_icache_insert_binding (const uint8_t *site_p, /**< byte code of the identifier access */
+                            ecma_value_t name, /**< identifier name */
+                            uint32_t depth, /**< number of skipped environments */
+                            uint16_t index) /**< index of the binding */
+{
+  if (depth > UINT16_MAX)
+  {
+    return;
+  }
+
+  ecma_icache_binding_entry_t *entry_p = JERRY_CONTEXT (icache_bindings) [ecma_icache_binding_row_index (site_p)];
+  uint32_t epoch = JERRY_CONTEXT (icache_epoch);
+  uint32_t index_in_row = 0;
+
+  /* Reuse the entry of the site or an outdated entry first, otherwise the oldest entry is dropped. */
+  while (index_in_row < ECMA_ICACHE_ROW_LENGTH - 1
+         && entry_p[index_in_row].epoch == epoch
+         && (entry_p[index_in_row].site_p != site_p || entry_p[index_in_row].name != name))
+  {
+    index_in_row++;
+  }
+
+  while (index_in_row > 0)
+  {
+    entry_p[index_in_row] = entry_p[index_in_row - 1];
+    index_in_row--;
+  }
+
+  entry_p->site_p = site_p;
+  entry_p->name = name;
+  entry_p->epoch = epoch;
+  entry_p->depth = (uint16_t) depth;
+  entry_p->index = index;
+} /* ecma_icache_insert_binding */
+
+/**
+ * Find the binding of an identifier using the cached resolution of its access site
+ *
+ * The cache remembers how many declarative environments can be skipped from the
+ * start of the chain and the position of the binding in the environment where it
+ * was found, so repeated accesses of closure variables do not search by name.
+ *
+ * @return pointer to the binding - if it is found in a declarative environment,
+ *         the environment is stored into lex_env_p
+ *         NULL - otherwise, the identifier must be resolved starting from the
+ *                lexical environment stored into lex_env_p
+ */
+ecma_property_t *
+ecma_icache_find_binding (const uint8_t *site_p, /**< byte code of the identifier access */
+                          ecma_object_t **lex_env_p, /**< [in, out] lexical environment */
+                          ecma_string_t *name_p) /**< identifier name */
+{
+  ecma_object_t *env_p = *lex_env_p;
+  ecma_value_t name = ecma_make_string_value (name_p);
+  ecma_icache_binding_entry_t *entry_p = JERRY_CONTEXT (icache_bindings) [ecma_icache_binding_row_index (site_p)];
+  ecma_icache_binding_entry_t *entry_end_p = entry_p + ECMA_ICACHE_ROW_LENGTH;
+  uint32_t epoch = JERRY_CONTEXT (icache_epoch);
+
+  do
+  {
+    if (entry_p->site_p == site_p
+        && entry_p->name == name
+        && entry_p->epoch == epoch)
+    {
+      uint32_t depth = entry_p->depth;
+
+      while (depth > 0
+             && ecma_get_lex_env_type (env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE
+             && env_p->u2.outer_reference_cp != JMEM_CP_NULL)
+      {
+        env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, env_p->u2.outer_reference_cp);
+        depth--;
+      }
+
+      if (depth > 0)
+      {
+        /* The chain is different, search from the start. */
+        env_p = *lex_env_p;
+        break;
+      }
+
+      if (entry_p->index == ECMA_ICACHE_BINDING_NO_INDEX)
+      {
+        *lex_env_p = env_p;
+        return NULL;
+      }
+
+      ecma_property_t *property_p = ecma_icache_get_binding_at (env_p, entry_p->index, name_p);
+
+      if (property_p != NULL)
+      {
+        *lex_env_p = env_p;
+        return property_p;
+      }
+
+      env_p = *lex_env_p;
+      break;
+    }
+    entry_p++;
+  }
+  while (entry_p < entry_end_p);
+
+  uint32_t depth = 0;
+
+  while (ecma_get_lex_env_type (env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  {
+    ecma_property_t *property_p = ecma_find_named_property (env_p, name_p);
+
+    if (property_p != NULL)
+    {
+      ecma_icache_insert_binding (site_p, name, depth, ecma_icache_get_binding_index (env_p, property_p));
+      *lex_env_p = env_p;
+      return property_p;
+    }
+
+    if (env_p->u2.outer_reference_cp == JMEM_CP_NULL)
+    {
+      break;
+    }
+
+    env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, env_p->u2.outer_reference_cp);
+    depth++;
+  }
+
+  if (depth > 0)
+  {
+    ecma_icache_insert_binding (site_p, name, depth, ECMA_ICACHE_BINDING_NO_INDEX);
+  }
+
+  *lex_env_p = env_p;
+  return NULL;
+} /* ecma_icache_find_binding */
+
+#endif /* ENABLED (JERRY_ICACHE) */
+
+/**
+ * @}
+ * @}
+ */
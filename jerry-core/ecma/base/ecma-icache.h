@@ -0,0 +1,40 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_ICACHE_H
+#define ECMA_ICACHE_H
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaicache Inline property cache
+ * @{
+ */
+
+#if ENABLED (JERRY_ICACHE)
+ecma_property_t *ecma_icache_lookup (const uint8_t *site_p, const ecma_object_t *object_p, ecma_value_t name);
+void ecma_icache_insert (const uint8_t *site_p, const ecma_object_t *object_p, ecma_value_t name,
+                         ecma_property_t *prop_p);
+void ecma_icache_invalidate (void);
+ecma_property_t *ecma_icache_find_binding (const uint8_t *site_p, ecma_object_t **lex_env_p, ecma_string_t *name_p);
+
+#endif /* ENABLED (JERRY_ICACHE) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_ICACHE_H */
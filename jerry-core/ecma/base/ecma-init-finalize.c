@@ -21,6 +21,7 @@
 #include "ecma-literal-storage.h"
 #include "jmem.h"
 #include "jcontext.h"
+#include "re-compiler.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -61,6 +62,9 @@ ecma_finalize (void)
   ecma_finalize_global_lex_env ();
   ecma_finalize_builtins ();
   ecma_gc_run ();
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+  re_cache_gc_run ();
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
   ecma_finalize_lit_storage ();
 } /* ecma_finalize */
 
@@ -56,58 +56,170 @@ ecma_free_symbol_list (jmem_cpointer_t symbol_list_cp) /**< symbol list */
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
 
 /**
- * Free string list
+ * Initial number of buckets of a literal storage index
+ */
+#define ECMA_LIT_STORAGE_INDEX_INITIAL_SIZE 32
+
+/**
+ * Calculate the hash of a literal number
+ *
+ * @return hash of the number
+ */
+static lit_string_hash_t
+ecma_lit_storage_number_hash (ecma_number_t number) /**< number */
+{
+  uint32_t words[sizeof (ecma_number_t) / sizeof (uint32_t)];
+  memcpy (words, &number, sizeof (ecma_number_t));
+
+  uint32_t hash = words[0];
+
+  for (uint32_t i = 1; i < sizeof (ecma_number_t) / sizeof (uint32_t); i++)
+  {
+    hash ^= words[i];
+  }
+
+  /* The low bits of fractional numbers are often zero, so the bits are mixed. */
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35u;
+  hash ^= hash >> 16;
+
+  return (lit_string_hash_t) hash;
+} /* ecma_lit_storage_number_hash */
+
+/**
+ * Calculate the hash of a literal stored in an index
+ *
+ * @return hash of the literal
+ */
+static lit_string_hash_t
+ecma_lit_storage_get_hash (jmem_cpointer_t literal_cp, /**< literal */
+                           bool is_number) /**< true - if the literal is a number,
+                                            *   false - if the literal is a string */
+{
+  if (is_number)
+  {
+    return ecma_lit_storage_number_hash (*JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, literal_cp));
+  }
+
+  return ecma_string_hash (JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, literal_cp));
+} /* ecma_lit_storage_get_hash */
+
+/**
+ * Insert a literal into the buckets of an index, which must have at least one free bucket
  */
 static void
-ecma_free_string_list (jmem_cpointer_t string_list_cp) /**< string list */
+ecma_lit_storage_index_insert_bucket (ecma_lit_storage_index_t *index_p, /**< literal index */
+                                      jmem_cpointer_t literal_cp, /**< literal */
+                                      lit_string_hash_t hash) /**< hash of the literal */
 {
-  while (string_list_cp != JMEM_CP_NULL)
+  uint32_t bucket = hash & index_p->mask;
+
+  while (index_p->buckets_p[bucket] != JMEM_CP_NULL)
   {
-    ecma_lit_storage_item_t *string_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, string_list_cp);
+    bucket = (bucket + 1) & index_p->mask;
+  }
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  index_p->buckets_p[bucket] = literal_cp;
+} /* ecma_lit_storage_index_insert_bucket */
+
+/**
+ * Insert a new literal into an index, doubling the number of buckets when the index is 75% full
+ */
+static void
+ecma_lit_storage_index_insert (ecma_lit_storage_index_t *index_p, /**< literal index */
+                               jmem_cpointer_t literal_cp, /**< literal */
+                               bool is_number) /**< true - if the literal is a number,
+                                                *   false - if the literal is a string */
+{
+  uint32_t bucket_count = (index_p->buckets_p == NULL) ? 0 : index_p->mask + 1;
+
+  if ((index_p->count + 1) * 4 > bucket_count * 3)
+  {
+    jmem_cpointer_t *old_buckets_p = index_p->buckets_p;
+    uint32_t new_bucket_count = (bucket_count == 0) ? ECMA_LIT_STORAGE_INDEX_INITIAL_SIZE : bucket_count * 2;
+    size_t new_size = new_bucket_count * sizeof (jmem_cpointer_t);
+
+    index_p->buckets_p = (jmem_cpointer_t *) jmem_heap_alloc_block (new_size);
+    index_p->mask = new_bucket_count - 1;
+
+    for (uint32_t i = 0; i < new_bucket_count; i++)
     {
-      if (string_list_p->values[i] != JMEM_CP_NULL)
-      {
-        ecma_string_t *string_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
-                                                                string_list_p->values[i]);
+      index_p->buckets_p[i] = JMEM_CP_NULL;
+    }
 
-        JERRY_ASSERT (ECMA_STRING_IS_REF_EQUALS_TO_ONE (string_p));
-        ecma_destroy_ecma_string (string_p);
+    for (uint32_t i = 0; i < bucket_count; i++)
+    {
+      if (old_buckets_p[i] != JMEM_CP_NULL)
+      {
+        ecma_lit_storage_index_insert_bucket (index_p,
+                                              old_buckets_p[i],
+                                              ecma_lit_storage_get_hash (old_buckets_p[i], is_number));
       }
     }
 
-    jmem_cpointer_t next_item_cp = string_list_p->next_cp;
-    jmem_pools_free (string_list_p, sizeof (ecma_lit_storage_item_t));
-    string_list_cp = next_item_cp;
+    if (old_buckets_p != NULL)
+    {
+      jmem_heap_free_block (old_buckets_p, bucket_count * sizeof (jmem_cpointer_t));
+    }
   }
-} /* ecma_free_string_list */
+
+  ecma_lit_storage_index_insert_bucket (index_p, literal_cp, ecma_lit_storage_get_hash (literal_cp, is_number));
+  index_p->count++;
+} /* ecma_lit_storage_index_insert */
 
 /**
- * Free number list
+ * Free the literal strings and the buckets of the literal string index
  */
 static void
-ecma_free_number_list (jmem_cpointer_t number_list_cp) /**< string list */
+ecma_free_string_index (ecma_lit_storage_index_t *index_p) /**< literal string index */
 {
-  while (number_list_cp != JMEM_CP_NULL)
+  if (index_p->buckets_p == NULL)
   {
-    ecma_number_storage_item_t *number_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_storage_item_t,
-                                                                              number_list_cp);
+    return;
+  }
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  for (uint32_t i = 0; i <= index_p->mask; i++)
+  {
+    if (index_p->buckets_p[i] != JMEM_CP_NULL)
     {
-      if (number_list_p->values[i] != JMEM_CP_NULL)
-      {
-        ecma_number_t *num_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, number_list_p->values[i]);
-        ecma_dealloc_number (num_p);
-      }
+      ecma_string_t *string_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, index_p->buckets_p[i]);
+
+      JERRY_ASSERT (ECMA_STRING_IS_REF_EQUALS_TO_ONE (string_p));
+      ecma_destroy_ecma_string (string_p);
     }
+  }
+
+  jmem_heap_free_block (index_p->buckets_p, (index_p->mask + 1) * sizeof (jmem_cpointer_t));
+  index_p->buckets_p = NULL;
+  index_p->count = 0;
+} /* ecma_free_string_index */
+
+/**
+ * Free the literal numbers and the buckets of the literal number index
+ */
+static void
+ecma_free_number_index (ecma_lit_storage_index_t *index_p) /**< literal number index */
+{
+  if (index_p->buckets_p == NULL)
+  {
+    return;
+  }
 
-    jmem_cpointer_t next_item_cp = number_list_p->next_cp;
-    jmem_pools_free (number_list_p, sizeof (ecma_number_storage_item_t));
-    number_list_cp = next_item_cp;
+  for (uint32_t i = 0; i <= index_p->mask; i++)
+  {
+    if (index_p->buckets_p[i] != JMEM_CP_NULL)
+    {
+      ecma_number_t *num_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, index_p->buckets_p[i]);
+      ecma_dealloc_number (num_p);
+    }
   }
-} /* ecma_free_number_list */
+
+  jmem_heap_free_block (index_p->buckets_p, (index_p->mask + 1) * sizeof (jmem_cpointer_t));
+  index_p->buckets_p = NULL;
+  index_p->count = 0;
+} /* ecma_free_number_index */
 
 /**
  * Finalize literal storage
@@ -118,8 +230,8 @@ ecma_finalize_lit_storage (void)
 #if ENABLED (JERRY_ES2015_BUILTIN_SYMBOL)
   ecma_free_symbol_list (JERRY_CONTEXT (symbol_list_first_cp));
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
-  ecma_free_string_list (JERRY_CONTEXT (string_list_first_cp));
-  ecma_free_number_list (JERRY_CONTEXT (number_list_first_cp));
+  ecma_free_string_index (&JERRY_CONTEXT (string_literal_index));
+  ecma_free_number_index (&JERRY_CONTEXT (number_literal_index));
 } /* ecma_finalize_lit_storage */
 
 /**
@@ -138,60 +250,32 @@ ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string
     return ecma_make_string_value (string_p);
   }
 
-  jmem_cpointer_t string_list_cp = JERRY_CONTEXT (string_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+  ecma_lit_storage_index_t *index_p = &JERRY_CONTEXT (string_literal_index);
 
-  while (string_list_cp != JMEM_CP_NULL)
+  if (index_p->buckets_p != NULL)
   {
-    ecma_lit_storage_item_t *string_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, string_list_cp);
+    uint32_t bucket = ecma_string_hash (string_p) & index_p->mask;
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    while (index_p->buckets_p[bucket] != JMEM_CP_NULL)
     {
-      if (string_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = string_list_p->values + i;
-        }
-      }
-      else
+      ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, index_p->buckets_p[bucket]);
+
+      if (ecma_compare_ecma_strings (string_p, value_p))
       {
-        ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
-                                                               string_list_p->values[i]);
-
-        if (ecma_compare_ecma_strings (string_p, value_p))
-        {
-          /* Return with string if found in the list. */
-          ecma_deref_ecma_string (string_p);
-          return ecma_make_string_value (value_p);
-        }
+        /* Return with string if found in the index. */
+        ecma_deref_ecma_string (string_p);
+        return ecma_make_string_value (value_p);
       }
-    }
 
-    string_list_cp = string_list_p->next_cp;
+      bucket = (bucket + 1) & index_p->mask;
+    }
   }
 
   ECMA_SET_STRING_AS_STATIC (string_p);
   jmem_cpointer_t result;
   JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
 
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return ecma_make_string_value (string_p);
-  }
-
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = JERRY_CONTEXT (string_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (string_list_first_cp), new_item_p);
+  ecma_lit_storage_index_insert (index_p, result, false);
 
   return ecma_make_string_value (string_p);
 } /* ecma_find_or_create_literal_string */
@@ -206,6 +290,10 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
 {
   ecma_value_t num = ecma_make_number_value (number_arg);
 
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+  /* Floating point numbers are stored in the value, there is nothing to share. */
+  return num;
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
   if (ecma_is_value_integer_number (num))
   {
     return num;
@@ -213,37 +301,24 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
 
   JERRY_ASSERT (ecma_is_value_float_number (num));
 
-  jmem_cpointer_t number_list_cp = JERRY_CONTEXT (number_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+  ecma_lit_storage_index_t *index_p = &JERRY_CONTEXT (number_literal_index);
 
-  while (number_list_cp != JMEM_CP_NULL)
+  if (index_p->buckets_p != NULL)
   {
-    ecma_number_storage_item_t *number_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_storage_item_t,
-                                                                              number_list_cp);
+    uint32_t bucket = ecma_lit_storage_number_hash (number_arg) & index_p->mask;
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    while (index_p->buckets_p[bucket] != JMEM_CP_NULL)
     {
-      if (number_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = number_list_p->values + i;
-        }
-      }
-      else
+      ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, index_p->buckets_p[bucket]);
+
+      if (*number_p == number_arg)
       {
-        ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t,
-                                                                number_list_p->values[i]);
-
-        if (*number_p == number_arg)
-        {
-          ecma_free_value (num);
-          return ecma_make_float_value (number_p);
-        }
+        ecma_free_value (num);
+        return ecma_make_float_value (number_p);
       }
-    }
 
-    number_list_cp = number_list_p->next_cp;
+      bucket = (bucket + 1) & index_p->mask;
+    }
   }
 
   ecma_number_t *num_p = ecma_get_pointer_from_float_value (num);
@@ -251,25 +326,10 @@ ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be
   jmem_cpointer_t result;
   JMEM_CP_SET_NON_NULL_POINTER (result, num_p);
 
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return num;
-  }
-
-  ecma_number_storage_item_t *new_item_p;
-  new_item_p = (ecma_number_storage_item_t *) jmem_pools_alloc (sizeof (ecma_number_storage_item_t));
-
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
-  {
-    new_item_p->values[i] = JMEM_CP_NULL;
-  }
-
-  new_item_p->next_cp = JERRY_CONTEXT (number_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (number_list_first_cp), new_item_p);
+  ecma_lit_storage_index_insert (index_p, result, true);
 
   return num;
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
 } /* ecma_find_or_create_literal_number */
 
 /**
@@ -0,0 +1,706 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-icache.h"
+#include "ecma-lcache.h"
+#include "ecma-shape.h"
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Property shapes
+ * @{
+ */
+
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+
+/**
+ * Compute the bit of a property name in the name filter of the shapes
+ *
+ * @return name filter bit
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_name_filter_bit (const ecma_string_t *name_p) /**< property name */
+{
+  return (uint32_t) 1 << (ecma_string_hash (name_p) & 0x1f);
+} /* ecma_shape_name_filter_bit */
+
+/**
+ * Check whether the property name is an internal magic string
+ *
+ * @return true - if the name is an internal magic string,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_is_internal_name (const ecma_string_t *name_p) /**< property name */
+{
+  if (!ECMA_IS_DIRECT_STRING (name_p)
+      || ECMA_GET_DIRECT_STRING_TYPE (name_p) != ECMA_DIRECT_STRING_MAGIC)
+  {
+    return false;
+  }
+
+  uintptr_t id = ECMA_GET_DIRECT_STRING_VALUE (name_p);
+  return id >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT && id < LIT_MAGIC_STRING__COUNT;
+} /* ecma_shape_is_internal_name */
+
+/**
+ * Allocate a property storage block
+ *
+ * @return pointer to the block
+ */
+static ecma_shape_storage_t *
+ecma_shape_alloc_storage (uint32_t pair_count) /**< number of property pairs */
+{
+  JERRY_ASSERT (pair_count > 0 && pair_count <= UINT8_MAX);
+
+  size_t size = sizeof (ecma_shape_storage_t) + pair_count * sizeof (ecma_shape_property_pair_t);
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_allocate_property_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  ecma_shape_storage_t *storage_p = (ecma_shape_storage_t *) jmem_heap_alloc_block (size);
+
+  storage_p->header.types[0] = ECMA_PROPERTY_TYPE_SHAPE;
+  storage_p->header.types[1] = (ecma_property_t) pair_count;
+  storage_p->header.next_property_cp = JMEM_CP_NULL;
+  storage_p->shape_cp = JMEM_CP_NULL;
+
+  ecma_shape_property_pair_t *pairs_p = ECMA_SHAPE_STORAGE_GET_PAIRS (storage_p);
+
+  for (uint32_t i = 0; i < pair_count; i++)
+  {
+    pairs_p[i].types[0] = ECMA_PROPERTY_TYPE_DELETED;
+    pairs_p[i].types[1] = ECMA_PROPERTY_TYPE_DELETED;
+  }
+
+  return storage_p;
+} /* ecma_shape_alloc_storage */
+
+/**
+ * Free all property storage blocks of an object
+ */
+static void
+ecma_shape_free_storage_blocks (ecma_shape_storage_t *storage_p) /**< first block */
+{
+  while (true)
+  {
+    jmem_cpointer_t next_cp = storage_p->header.next_property_cp;
+    size_t size = sizeof (ecma_shape_storage_t) + storage_p->header.types[1] * sizeof (ecma_shape_property_pair_t);
+
+#if ENABLED (JERRY_MEM_STATS)
+    jmem_stats_free_property_bytes (size);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+    jmem_heap_free_block (storage_p, size);
+
+    if (next_cp == JMEM_CP_NULL)
+    {
+      return;
+    }
+
+    storage_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_storage_t, next_cp);
+  }
+} /* ecma_shape_free_storage_blocks */
+
+/**
+ * Decrease the reference counter of a shape, and free the shape
+ * (and its unreferenced parents) when the counter becomes zero
+ */
+static void
+ecma_shape_deref (ecma_shape_t *shape_p) /**< shape */
+{
+  while (true)
+  {
+    JERRY_ASSERT (shape_p->refs > 0);
+
+    if (--shape_p->refs > 0)
+    {
+      return;
+    }
+
+    JERRY_ASSERT (shape_p->first_child_cp == JMEM_CP_NULL);
+
+    ecma_shape_t *parent_p = NULL;
+    jmem_cpointer_t *list_cp_p = &JERRY_CONTEXT (ecma_shape_first_root_cp);
+
+    if (shape_p->parent_cp != JMEM_CP_NULL)
+    {
+      parent_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+      list_cp_p = &parent_p->first_child_cp;
+    }
+
+    jmem_cpointer_t shape_cp;
+    ECMA_SET_NON_NULL_POINTER (shape_cp, shape_p);
+
+    while (*list_cp_p != shape_cp)
+    {
+      JERRY_ASSERT (*list_cp_p != JMEM_CP_NULL);
+      list_cp_p = &ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *list_cp_p)->next_sibling_cp;
+    }
+
+    *list_cp_p = shape_p->next_sibling_cp;
+
+    if (ECMA_PROPERTY_GET_NAME_TYPE (shape_p->name_type) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp));
+    }
+
+#if ENABLED (JERRY_MEM_STATS)
+    jmem_stats_free_property_bytes (sizeof (ecma_shape_t));
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+    jmem_heap_free_block (shape_p, sizeof (ecma_shape_t));
+
+#if ENABLED (JERRY_ICACHE)
+    /* The inline cache may refer to the freed shape. */
+    ecma_icache_invalidate ();
+#endif /* ENABLED (JERRY_ICACHE) */
+
+    if (parent_p == NULL)
+    {
+      return;
+    }
+
+    shape_p = parent_p;
+  }
+} /* ecma_shape_deref */
+
+/**
+ * Get the shape which is derived from a shape by adding a new property,
+ * and create it if it does not exist yet.
+ *
+ * Note:
+ *      the reference counter of the returned shape is increased
+ *
+ * @return pointer to the shape - if the transition is found or created,
+ *         NULL - if the transition list is full
+ */
+static ecma_shape_t *
+ecma_shape_get_transition (ecma_shape_t *shape_p, /**< shape or NULL for objects without properties */
+                           ecma_string_t *name_p) /**< name of the new property */
+{
+  jmem_cpointer_t *list_cp_p = &JERRY_CONTEXT (ecma_shape_first_root_cp);
+
+  if (shape_p != NULL)
+  {
+    list_cp_p = &shape_p->first_child_cp;
+  }
+
+  jmem_cpointer_t child_cp = *list_cp_p;
+  uint32_t transition_count = 0;
+
+  while (child_cp != JMEM_CP_NULL)
+  {
+    ecma_shape_t *child_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, child_cp);
+
+    if (ecma_string_compare_to_property_name (child_p->name_type, child_p->name_cp, name_p))
+    {
+      child_p->refs++;
+      return child_p;
+    }
+
+    child_cp = child_p->next_sibling_cp;
+    transition_count++;
+  }
+
+  if (transition_count >= ECMA_SHAPE_MAX_TRANSITION_COUNT)
+  {
+    return NULL;
+  }
+
+#if ENABLED (JERRY_MEM_STATS)
+  jmem_stats_allocate_property_bytes (sizeof (ecma_shape_t));
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  /* The garbage collector may free other shapes, but the current
+   * shape is kept alive by the object which receives the property. */
+  ecma_shape_t *new_shape_p = (ecma_shape_t *) jmem_heap_alloc_block (sizeof (ecma_shape_t));
+
+  new_shape_p->first_child_cp = JMEM_CP_NULL;
+  new_shape_p->name_cp = ecma_string_to_property_name (name_p, &new_shape_p->name_type);
+  new_shape_p->refs = 1;
+  new_shape_p->name_filter = ecma_shape_name_filter_bit (name_p);
+  new_shape_p->count = 1;
+  new_shape_p->parent_cp = JMEM_CP_NULL;
+
+  if (shape_p != NULL)
+  {
+    new_shape_p->name_filter |= shape_p->name_filter;
+    new_shape_p->count = (uint8_t) (shape_p->count + 1);
+    ECMA_SET_NON_NULL_POINTER (new_shape_p->parent_cp, shape_p);
+    shape_p->refs++;
+
+    /* The storage of the objects is allocated for the largest derived shape. */
+    ecma_shape_t *iter_p = shape_p;
+
+    while (iter_p->max_count < new_shape_p->count)
+    {
+      iter_p->max_count = new_shape_p->count;
+
+      if (iter_p->parent_cp == JMEM_CP_NULL)
+      {
+        break;
+      }
+
+      iter_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, iter_p->parent_cp);
+    }
+  }
+
+  new_shape_p->max_count = new_shape_p->count;
+  new_shape_p->next_sibling_cp = *list_cp_p;
+  ECMA_SET_NON_NULL_POINTER (*list_cp_p, new_shape_p);
+
+  return new_shape_p;
+} /* ecma_shape_get_transition */
+
+/**
+ * Get the property storage of an object with a shape
+ *
+ * Note:
+ *      fast access mode arrays must not be passed to this function
+ *
+ * @return pointer to the first storage block - if the object has a shape,
+ *         NULL - otherwise
+ */
+inline ecma_shape_storage_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_get_storage (const ecma_object_t *object_p) /**< object */
+{
+  if (object_p->u1.property_list_cp == JMEM_CP_NULL)
+  {
+    return NULL;
+  }
+
+  ecma_shape_storage_t *storage_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_storage_t,
+                                                               object_p->u1.property_list_cp);
+
+  return (storage_p->header.types[0] == ECMA_PROPERTY_TYPE_SHAPE) ? storage_p : NULL;
+} /* ecma_shape_get_storage */
+
+/**
+ * Get a property of an object with a shape
+ *
+ * @return pointer to the property
+ */
+inline ecma_property_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_shape_get_property (ecma_shape_storage_t *storage_p, /**< first storage block */
+                         uint32_t index) /**< index of the property in the shape */
+{
+  while (index >= (uint32_t) storage_p->header.types[1] * ECMA_PROPERTY_PAIR_ITEM_COUNT)
+  {
+    index -= (uint32_t) storage_p->header.types[1] * ECMA_PROPERTY_PAIR_ITEM_COUNT;
+
+    JERRY_ASSERT (storage_p->header.next_property_cp != JMEM_CP_NULL);
+    storage_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_storage_t, storage_p->header.next_property_cp);
+  }
+
+  ecma_shape_property_pair_t *pair_p = ECMA_SHAPE_STORAGE_GET_PAIRS (storage_p);
+  pair_p += index / ECMA_PROPERTY_PAIR_ITEM_COUNT;
+  ecma_property_t *property_p = pair_p->types + (index % ECMA_PROPERTY_PAIR_ITEM_COUNT);
+
+  JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p) == pair_p->values + (index % ECMA_PROPERTY_PAIR_ITEM_COUNT));
+  return property_p;
+} /* ecma_shape_get_property */
+
+/**
+ * Get the index of a property of an object with a shape
+ *
+ * @return index of the property in the shape
+ */
+uint32_t
+ecma_shape_get_property_index (ecma_shape_storage_t *storage_p, /**< first storage block */
+                               const ecma_property_t *property_p) /**< property */
+{
+  uint32_t index = 0;
+
+  while (true)
+  {
+    const uint8_t *pairs_start_p = (const uint8_t *) ECMA_SHAPE_STORAGE_GET_PAIRS (storage_p);
+    uint32_t pair_count = storage_p->header.types[1];
+
+    if (property_p >= pairs_start_p
+        && property_p < pairs_start_p + pair_count * sizeof (ecma_shape_property_pair_t))
+    {
+      size_t offset = (size_t) (property_p - pairs_start_p);
+      uint32_t slot = (uint32_t) (offset % sizeof (ecma_shape_property_pair_t));
+
+      JERRY_ASSERT (slot < ECMA_PROPERTY_PAIR_ITEM_COUNT);
+      return index + (uint32_t) (offset / sizeof (ecma_shape_property_pair_t)) * ECMA_PROPERTY_PAIR_ITEM_COUNT + slot;
+    }
+
+    index += pair_count * ECMA_PROPERTY_PAIR_ITEM_COUNT;
+
+    JERRY_ASSERT (storage_p->header.next_property_cp != JMEM_CP_NULL);
+    storage_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_storage_t, storage_p->header.next_property_cp);
+  }
+} /* ecma_shape_get_property_index */
+
+/**
+ * Find a named property of an object with a shape
+ *
+ * @return pointer to the property - if it is found,
+ *         NULL - otherwise
+ */
+ecma_property_t *
+ecma_shape_find_property (ecma_shape_storage_t *storage_p, /**< first storage block */
+                          ecma_string_t *name_p, /**< property name */
+                          jmem_cpointer_t *name_cp_p) /**< [out] compressed pointer of the name */
+{
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, storage_p->shape_cp);
+  uint32_t name_filter_bit = ecma_shape_name_filter_bit (name_p);
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    ecma_property_t name_type = (ecma_property_t) ECMA_DIRECT_STRING_TYPE_TO_PROP_NAME_TYPE (name_p);
+    jmem_cpointer_t name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+
+    /* The filter of a shape contains the names of its parents as well. */
+    while (shape_p->name_filter & name_filter_bit)
+    {
+      if (shape_p->name_cp == name_cp && shape_p->name_type == name_type)
+      {
+        *name_cp_p = name_cp;
+        return ecma_shape_get_property (storage_p, (uint32_t) shape_p->count - 1);
+      }
+
+      if (shape_p->parent_cp == JMEM_CP_NULL)
+      {
+        break;
+      }
+
+      shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+    }
+
+    return NULL;
+  }
+
+  while (shape_p->name_filter & name_filter_bit)
+  {
+    if (ECMA_PROPERTY_GET_NAME_TYPE (shape_p->name_type) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_string_t *prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, shape_p->name_cp);
+
+      if (ecma_compare_ecma_non_direct_strings (name_p, prop_name_p))
+      {
+        *name_cp_p = shape_p->name_cp;
+        return ecma_shape_get_property (storage_p, (uint32_t) shape_p->count - 1);
+      }
+    }
+
+    if (shape_p->parent_cp == JMEM_CP_NULL)
+    {
+      break;
+    }
+
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+  }
+
+  return NULL;
+} /* ecma_shape_find_property */
+
+/**
+ * Free the value of a property of an object with a shape and change its type to deleted
+ */
+static void
+ecma_shape_free_property (ecma_object_t *object_p, /**< object */
+                          const ecma_shape_t *shape_p, /**< shape whose last property is freed */
+                          ecma_property_t *property_p) /**< property */
+{
+  if (ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+  {
+    ecma_free_value_if_not_object (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+  }
+  else
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+
+#if ENABLED (JERRY_CPOINTER_32_BIT)
+    ecma_getter_setter_pointers_t *getter_setter_pair_p;
+    getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
+                                                      ECMA_PROPERTY_VALUE_PTR (property_p)->getter_setter_pair_cp);
+    jmem_pools_free (getter_setter_pair_p, sizeof (ecma_getter_setter_pointers_t));
+#endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+  }
+
+#if ENABLED (JERRY_LCACHE)
+  if (ecma_is_property_lcached (property_p))
+  {
+    ecma_lcache_invalidate (object_p, shape_p->name_cp, property_p);
+  }
+#else /* !ENABLED (JERRY_LCACHE) */
+  JERRY_UNUSED (object_p);
+  JERRY_UNUSED (shape_p);
+#endif /* ENABLED (JERRY_LCACHE) */
+
+  *property_p = ECMA_PROPERTY_TYPE_DELETED;
+} /* ecma_shape_free_property */
+
+/**
+ * Move the properties of an object with a shape into a property list
+ */
+static void
+ecma_shape_convert_to_property_list (ecma_object_t *object_p, /**< object */
+                                     ecma_property_value_t *skipped_value_p) /**< value of a property which is
+                                                                              *   deleted or NULL */
+{
+  ecma_shape_storage_t *storage_p = ecma_shape_get_storage (object_p);
+  JERRY_ASSERT (storage_p != NULL);
+
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, storage_p->shape_cp);
+  uint32_t count = shape_p->count;
+  ecma_shape_t *shapes_p[ECMA_SHAPE_MAX_PROPERTY_COUNT];
+
+  JERRY_ASSERT (count > 0 && count <= ECMA_SHAPE_MAX_PROPERTY_COUNT);
+
+  ecma_shape_t *iter_p = shape_p;
+
+  while (true)
+  {
+    shapes_p[iter_p->count - 1] = iter_p;
+
+    if (iter_p->parent_cp == JMEM_CP_NULL)
+    {
+      break;
+    }
+
+    iter_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, iter_p->parent_cp);
+  }
+
+  /* The properties are added in the same order as ecma_create_property does, so
+   * the enumeration order of the properties is not changed. The storage is kept
+   * until the conversion is completed, since the allocation of the property pairs
+   * may trigger a garbage collection which marks the values of the properties. */
+  ecma_property_pair_t *first_pair_p = NULL;
+  jmem_cpointer_t property_list_cp = JMEM_CP_NULL;
+
+  for (uint32_t index = 0; index < count; index++)
+  {
+    ecma_property_t *property_p = ecma_shape_get_property (storage_p, index);
+
+    if (ECMA_PROPERTY_VALUE_PTR (property_p) == skipped_value_p)
+    {
+      ecma_shape_free_property (object_p, shapes_p[index], property_p);
+      continue;
+    }
+
+#if ENABLED (JERRY_LCACHE)
+    if (ecma_is_property_lcached (property_p))
+    {
+      ecma_lcache_invalidate (object_p, shapes_p[index]->name_cp, property_p);
+    }
+#endif /* ENABLED (JERRY_LCACHE) */
+
+    uint32_t slot = 0;
+
+    if (first_pair_p == NULL || first_pair_p->header.types[0] != ECMA_PROPERTY_TYPE_DELETED)
+    {
+      first_pair_p = ecma_alloc_property_pair ();
+
+      first_pair_p->header.next_property_cp = property_list_cp;
+      first_pair_p->header.types[0] = ECMA_PROPERTY_TYPE_DELETED;
+      first_pair_p->names_cp[0] = LIT_INTERNAL_MAGIC_STRING_DELETED;
+      ECMA_SET_NON_NULL_POINTER (property_list_cp, first_pair_p);
+      slot = 1;
+    }
+
+    jmem_cpointer_t name_cp = shapes_p[index]->name_cp;
+
+    if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_PTR)
+    {
+      ecma_ref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp));
+    }
+
+    first_pair_p->header.types[slot] = *property_p;
+    first_pair_p->values[slot] = *ECMA_PROPERTY_VALUE_PTR (property_p);
+    first_pair_p->names_cp[slot] = name_cp;
+  }
+
+  ecma_shape_free_storage_blocks (storage_p);
+  object_p->u1.property_list_cp = property_list_cp;
+  ecma_shape_deref (shape_p);
+} /* ecma_shape_convert_to_property_list */
+
+/**
+ * Create a property in an object with a shape
+ *
+ * Note:
+ *      the value of the property must be initialized by the caller
+ *
+ * @return pointer to the new property - if the object has a shape,
+ *         NULL - otherwise (the object is converted to a property list if needed)
+ */
+ecma_property_t *
+ecma_shape_create_property (ecma_object_t *object_p, /**< object */
+                            ecma_string_t *name_p, /**< property name */
+                            ecma_property_t type_and_flags) /**< type and flags, see ecma_property_info_t */
+{
+  ecma_shape_storage_t *storage_p = NULL;
+  ecma_shape_t *shape_p = NULL;
+
+  if (object_p->u1.property_list_cp == JMEM_CP_NULL)
+  {
+    /* Only ordinary objects have shapes. */
+    if (ecma_is_lexical_environment (object_p)
+        || ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_GENERAL
+        || ecma_get_object_is_builtin (object_p)
+        || ecma_shape_is_internal_name (name_p))
+    {
+      return NULL;
+    }
+  }
+  else
+  {
+    storage_p = ecma_shape_get_storage (object_p);
+
+    if (storage_p == NULL)
+    {
+      return NULL;
+    }
+
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, storage_p->shape_cp);
+
+    if (shape_p->count >= ECMA_SHAPE_MAX_PROPERTY_COUNT
+        || ecma_shape_is_internal_name (name_p))
+    {
+      ecma_shape_convert_to_property_list (object_p, NULL);
+      return NULL;
+    }
+  }
+
+  ecma_shape_t *new_shape_p = ecma_shape_get_transition (shape_p, name_p);
+
+  if (new_shape_p == NULL)
+  {
+    if (storage_p != NULL)
+    {
+      ecma_shape_convert_to_property_list (object_p, NULL);
+    }
+    return NULL;
+  }
+
+  uint32_t index = (uint32_t) new_shape_p->count - 1;
+  uint32_t capacity = 0;
+  ecma_shape_storage_t *last_storage_p = storage_p;
+
+  while (last_storage_p != NULL)
+  {
+    capacity += (uint32_t) last_storage_p->header.types[1] * ECMA_PROPERTY_PAIR_ITEM_COUNT;
+
+    if (last_storage_p->header.next_property_cp == JMEM_CP_NULL)
+    {
+      break;
+    }
+
+    last_storage_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_storage_t, last_storage_p->header.next_property_cp);
+  }
+
+  if (index >= capacity)
+  {
+    JERRY_ASSERT (index == capacity);
+
+    /* Objects which follow the same transitions get a single block. */
+    uint32_t pair_count = ((uint32_t) new_shape_p->max_count - index + 1) / ECMA_PROPERTY_PAIR_ITEM_COUNT;
+    ecma_shape_storage_t *new_storage_p = ecma_shape_alloc_storage (pair_count);
+
+    if (last_storage_p == NULL)
+    {
+      storage_p = new_storage_p;
+      ECMA_SET_NON_NULL_POINTER (object_p->u1.property_list_cp, storage_p);
+    }
+    else
+    {
+      ECMA_SET_NON_NULL_POINTER (last_storage_p->header.next_property_cp, new_storage_p);
+    }
+  }
+
+  ECMA_SET_NON_NULL_POINTER (storage_p->shape_cp, new_shape_p);
+
+  if (shape_p != NULL)
+  {
+    /* The new shape refers to the old one, so it is not freed. */
+    ecma_shape_deref (shape_p);
+  }
+
+  ecma_property_t *property_p = ecma_shape_get_property (storage_p, index);
+
+  JERRY_ASSERT (*property_p == ECMA_PROPERTY_TYPE_DELETED);
+  *property_p = (ecma_property_t) (type_and_flags | new_shape_p->name_type);
+  return property_p;
+} /* ecma_shape_create_property */
+
+/**
+ * Delete a property of an object with a shape
+ *
+ * Note:
+ *      the object is converted to a property list
+ */
+void
+ecma_shape_delete_property (ecma_object_t *object_p, /**< object */
+                            ecma_property_value_t *prop_value_p) /**< property value reference */
+{
+  JERRY_ASSERT (prop_value_p != NULL);
+
+  ecma_shape_convert_to_property_list (object_p, prop_value_p);
+} /* ecma_shape_delete_property */
+
+/**
+ * Convert an object with a shape to an object with a property list
+ */
+void
+ecma_shape_convert_to_dictionary (ecma_object_t *object_p) /**< object */
+{
+  ecma_shape_convert_to_property_list (object_p, NULL);
+} /* ecma_shape_convert_to_dictionary */
+
+/**
+ * Free the properties of an object with a shape
+ */
+void
+ecma_shape_free_storage (ecma_object_t *object_p) /**< object */
+{
+  ecma_shape_storage_t *storage_p = ecma_shape_get_storage (object_p);
+  JERRY_ASSERT (storage_p != NULL);
+
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, storage_p->shape_cp);
+  ecma_shape_t *iter_p = shape_p;
+
+  while (true)
+  {
+    ecma_shape_free_property (object_p, iter_p, ecma_shape_get_property (storage_p, (uint32_t) iter_p->count - 1));
+
+    if (iter_p->parent_cp == JMEM_CP_NULL)
+    {
+      break;
+    }
+
+    iter_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, iter_p->parent_cp);
+  }
+
+  ecma_shape_free_storage_blocks (storage_p);
+  object_p->u1.property_list_cp = JMEM_CP_NULL;
+  ecma_shape_deref (shape_p);
+} /* ecma_shape_free_storage */
+
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
+/**
+ * @}
+ * @}
+ */
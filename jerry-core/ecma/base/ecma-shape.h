@@ -0,0 +1,67 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_SHAPE_H
+#define ECMA_SHAPE_H
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Property shapes
+ * @{
+ */
+
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+
+/**
+ * Maximum number of properties of an object with a shape.
+ *
+ * Note:
+ *      larger objects are converted to property lists, which can have a property hashmap
+ */
+#define ECMA_SHAPE_MAX_PROPERTY_COUNT 32
+
+/**
+ * Maximum length of the transition list of a shape.
+ *
+ * Note:
+ *      objects used as dictionaries would create too many shapes otherwise
+ */
+#define ECMA_SHAPE_MAX_TRANSITION_COUNT 16
+
+/**
+ * Get the property pairs of a property storage block.
+ */
+#define ECMA_SHAPE_STORAGE_GET_PAIRS(storage_p) ((ecma_shape_property_pair_t *) ((storage_p) + 1))
+
+ecma_shape_storage_t *ecma_shape_get_storage (const ecma_object_t *object_p);
+ecma_property_t *ecma_shape_get_property (ecma_shape_storage_t *storage_p, uint32_t index);
+uint32_t ecma_shape_get_property_index (ecma_shape_storage_t *storage_p, const ecma_property_t *property_p);
+ecma_property_t *ecma_shape_find_property (ecma_shape_storage_t *storage_p, ecma_string_t *name_p,
+                                           jmem_cpointer_t *name_cp_p);
+ecma_property_t *ecma_shape_create_property (ecma_object_t *object_p, ecma_string_t *name_p,
+                                             ecma_property_t type_and_flags);
+void ecma_shape_delete_property (ecma_object_t *object_p, ecma_property_value_t *prop_value_p);
+void ecma_shape_convert_to_dictionary (ecma_object_t *object_p);
+void ecma_shape_free_storage (ecma_object_t *object_p);
+
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_SHAPE_H */
@@ -31,6 +31,10 @@
   PASTE (PASTE (ecma_builtin_, BUILTIN_UNDERSCORED_ID), _property_descriptor_list)
 #define DISPATCH_ROUTINE_ROUTINE_NAME \
   PASTE (PASTE (ecma_builtin_, BUILTIN_UNDERSCORED_ID), _dispatch_routine)
+#define FIND_PROPERTY_ROUTINE_NAME \
+  PASTE (PASTE (ecma_builtin_, BUILTIN_UNDERSCORED_ID), _find_property)
+#define PROPERTY_INDEX(name) \
+  PASTE (PASTE (PASTE (ECMA_PROPERTY_INDEX_, BUILTIN_UNDERSCORED_ID), _), name)
 
 #ifndef BUILTIN_CUSTOM_DISPATCH
 
@@ -78,6 +82,35 @@ enum
 
 #endif /* !BUILTIN_CUSTOM_DISPATCH */
 
+/**
+ * Indices of the built-in properties in the property list.
+ */
+enum
+{
+#define ROUTINE(name, c_function_name, args_number, length_prop_value) \
+  PROPERTY_INDEX (name),
+#define ROUTINE_CONFIGURABLE_ONLY(name, c_function_name, args_number, length_prop_value) \
+  PROPERTY_INDEX (name),
+#define ACCESSOR_READ_WRITE(name, c_getter_func_name, c_setter_func_name, prop_attributes) \
+  PROPERTY_INDEX (name),
+#define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_attributes) \
+  PROPERTY_INDEX (name),
+#define OBJECT_VALUE(name, obj_builtin_id, prop_attributes) \
+  PROPERTY_INDEX (name),
+#define SIMPLE_VALUE(name, simple_value, prop_attributes) \
+  PROPERTY_INDEX (name),
+#define NUMBER_VALUE(name, number_value, prop_attributes) \
+  PROPERTY_INDEX (name),
+#define STRING_VALUE(name, magic_string_id, prop_attributes) \
+  PROPERTY_INDEX (name),
+#if ENABLED (JERRY_ES2015_BUILTIN_SYMBOL)
+#define SYMBOL_VALUE(name, desc_string_id) \
+  PROPERTY_INDEX (name),
+#endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
+#include BUILTIN_INC_HEADER_NAME
+  PROPERTY_INDEX (_COUNT)
+};
+
 /**
  * Built-in property list of the built-in object.
  */
@@ -181,6 +214,75 @@ const ecma_builtin_property_descriptor_t PROPERTY_DESCRIPTOR_LIST_NAME[] =
   }
 };
 
+/**
+ * Find a property in the property list of the built-in object.
+ *
+ * Note: the compiler turns the switch into a jump table or a binary
+ *       search over the sorted names, so no linear scan is needed
+ *
+ * @return index of the property in the property list - if found
+ *         -1 - otherwise
+ */
+int32_t
+FIND_PROPERTY_ROUTINE_NAME (uint16_t magic_string_id) /**< name of the property */
+{
+  switch (magic_string_id)
+  {
+#define ROUTINE(name, c_function_name, args_number, length_prop_value) \
+    case name: \
+    { \
+      return PROPERTY_INDEX (name); \
+    }
+#define ROUTINE_CONFIGURABLE_ONLY(name, c_function_name, args_number, length_prop_value) \
+    case name: \
+    { \
+      return PROPERTY_INDEX (name); \
+    }
+#define ACCESSOR_READ_WRITE(name, c_getter_func_name, c_setter_func_name, prop_attributes) \
+    case name: \
+    { \
+      return PROPERTY_INDEX (name); \
+    }
+#define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_attributes) \
+    case name: \
+    { \
+      return PROPERTY_INDEX (name); \
+    }
+#define OBJECT_VALUE(name, obj_builtin_id, prop_attributes) \
+    case name: \
+    { \
+      return PROPERTY_INDEX (name); \
+    }
+#define SIMPLE_VALUE(name, simple_value, prop_attributes) \
+    case name: \
+    { \
+      return PROPERTY_INDEX (name); \
+    }
+#define NUMBER_VALUE(name, number_value, prop_attributes) \
+    case name: \
+    { \
+      return PROPERTY_INDEX (name); \
+    }
+#define STRING_VALUE(name, magic_string_id, prop_attributes) \
+    case name: \
+    { \
+      return PROPERTY_INDEX (name); \
+    }
+#if ENABLED (JERRY_ES2015_BUILTIN_SYMBOL)
+#define SYMBOL_VALUE(name, desc_string_id) \
+    case name: \
+    { \
+      return PROPERTY_INDEX (name); \
+    }
+#endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
+#include BUILTIN_INC_HEADER_NAME
+    default:
+    {
+      return -1;
+    }
+  }
+} /* FIND_PROPERTY_ROUTINE_NAME */
+
 #ifndef BUILTIN_CUSTOM_DISPATCH
 
 /**
@@ -257,6 +359,8 @@ DISPATCH_ROUTINE_ROUTINE_NAME (uint16_t builtin_routine_id, /**< built-in wide r
 #undef BUILTIN_CUSTOM_DISPATCH
 #undef BUILTIN_UNDERSCORED_ID
 #undef DISPATCH_ROUTINE_ROUTINE_NAME
+#undef FIND_PROPERTY_ROUTINE_NAME
+#undef PROPERTY_INDEX
 #undef ECMA_BUILTIN_PROPERTY_NAME_INDEX
 #undef PASTE__
 #undef PASTE_
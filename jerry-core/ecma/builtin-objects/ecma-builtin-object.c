@@ -231,6 +231,7 @@ ecma_set_prototype_of (ecma_value_t o_value, /**< O */
   }
 
   /* 9. */
+  ECMA_GC_WRITE_BARRIER (o_p);
   o_p->u2.prototype_cp = v_cp;
 
   /* 10. */
@@ -39,6 +39,11 @@ static void ecma_instantiate_builtin (ecma_builtin_id_t id);
  */
 typedef const ecma_builtin_property_descriptor_t *ecma_builtin_property_list_reference_t;
 
+/**
+ * Definition of built-in property lookup function pointer.
+ */
+typedef int32_t (*ecma_builtin_find_property_t)(uint16_t magic_string_id);
+
 /**
  * Definition of built-in dispatch routine function pointer.
  */
@@ -240,6 +245,35 @@ static const ecma_builtin_property_list_reference_t ecma_builtin_property_list_r
 /** @endcond */
 };
 
+/**
+ * Property lookup functions for all built-ins.
+ */
+static const ecma_builtin_find_property_t ecma_builtin_find_property_references[] =
+{
+/** @cond doxygen_suppress */
+#define BUILTIN(a, b, c, d, e)
+#define BUILTIN_ROUTINE(builtin_id, \
+                        object_type, \
+                        object_prototype_builtin_id, \
+                        is_extensible, \
+                        lowercase_name) \
+  ecma_builtin_ ## lowercase_name ## _find_property,
+#include "ecma-builtins.inc.h"
+#undef BUILTIN
+#undef BUILTIN_ROUTINE
+#define BUILTIN_ROUTINE(a, b, c, d, e)
+#define BUILTIN(builtin_id, \
+                object_type, \
+                object_prototype_builtin_id, \
+                is_extensible, \
+                lowercase_name) \
+  ecma_builtin_ ## lowercase_name ## _find_property,
+#include "ecma-builtins.inc.h"
+#undef BUILTIN_ROUTINE
+#undef BUILTIN
+/** @endcond */
+};
+
 /**
  * Get the number of properties of a built-in object.
  *
@@ -691,19 +725,17 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
   JERRY_ASSERT (ecma_builtin_is (object_p, builtin_id));
 
   const ecma_builtin_property_descriptor_t *property_list_p = ecma_builtin_property_list_references[builtin_id];
+  int32_t property_index = ecma_builtin_find_property_references[builtin_id] ((uint16_t) magic_string_id);
 
-  const ecma_builtin_property_descriptor_t *curr_property_p = property_list_p;
-
-  while (curr_property_p->magic_string_id != magic_string_id)
+  if (property_index < 0)
   {
-    if (curr_property_p->magic_string_id == LIT_MAGIC_STRING__COUNT)
-    {
-      return NULL;
-    }
-    curr_property_p++;
+    return NULL;
   }
 
-  uint32_t index = (uint32_t) (curr_property_p - property_list_p);
+  const ecma_builtin_property_descriptor_t *curr_property_p = property_list_p + property_index;
+  JERRY_ASSERT (curr_property_p->magic_string_id == magic_string_id);
+
+  uint32_t index = (uint32_t) property_index;
 
   uint32_t *bitset_p = built_in_props_p->instantiated_bitset + (index >> 5);
 
@@ -1389,14 +1389,30 @@ ecma_builtin_typedarray_prototype_fill (ecma_value_t this_arg, /**< this argumen
     subarray_length = end_index_uint32 - begin_index_uint32;
   }
 
-  ecma_typedarray_setter_fn_t typedarray_setter_cb = ecma_get_typedarray_setter_fn (info.id);
-  uint32_t byte_index = begin_index_uint32 * info.element_size;
-  uint32_t limit = byte_index + subarray_length * info.element_size;
-
-  while (byte_index < limit)
+  if (subarray_length > 0)
   {
-    typedarray_setter_cb (info.buffer_p + byte_index, value_num);
-    byte_index += info.element_size;
+    /* Only the first element is converted, the others are copies of its bytes. */
+    lit_utf8_byte_t *start_p = info.buffer_p + (begin_index_uint32 << info.shift);
+    uint32_t limit = (uint32_t) subarray_length << info.shift;
+
+    ecma_typedarray_setter_fn_t typedarray_setter_cb = ecma_get_typedarray_setter_fn (info.id);
+    typedarray_setter_cb (start_p, value_num);
+
+    if (info.element_size == 1)
+    {
+      memset (start_p + 1, *start_p, limit - 1);
+    }
+    else
+    {
+      uint32_t filled_size = info.element_size;
+
+      while (filled_size < limit)
+      {
+        uint32_t copy_size = JERRY_MIN (filled_size, limit - filled_size);
+        memcpy (start_p + filled_size, start_p, copy_size);
+        filled_size += copy_size;
+      }
+    }
   }
 
   return ecma_copy_value (this_arg);
@@ -1419,41 +1435,9 @@ ecma_builtin_typedarray_prototype_sort_compare_helper (ecma_value_t lhs, /**< le
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
   ecma_number_t result = ECMA_NUMBER_ZERO;
 
-  if (ecma_is_value_undefined (compare_func))
-  {
-    /* Default comparison when no comparefn is passed. */
-    double lhs_value = (double) ecma_get_number_from_value (lhs);
-    double rhs_value = (double) ecma_get_number_from_value (rhs);
-
-    if (ecma_number_is_nan (lhs_value))
-    {
-      // Keep NaNs at the end of the array.
-      result = ECMA_NUMBER_ONE;
-    }
-    else if (ecma_number_is_nan (rhs_value))
-    {
-      // Keep NaNs at the end of the array.
-      result = ECMA_NUMBER_MINUS_ONE;
-    }
-    else if (lhs_value < rhs_value)
-    {
-      result = ECMA_NUMBER_MINUS_ONE;
-    }
-    else if (lhs_value > rhs_value)
-    {
-      result = ECMA_NUMBER_ONE;
-    }
-    else
-    {
-      result = ECMA_NUMBER_ZERO;
-    }
-
-    return ecma_make_number_value (result);
-  }
-
   /*
-   * compare_func, if not undefined, will always contain a callable function object.
-   * We checked this previously, before this function was called.
+   * compare_func will always contain a callable function object, the default
+   * comparison is done by ecma_builtin_typedarray_prototype_sort_native.
    */
   JERRY_ASSERT (ecma_op_is_callable (compare_func));
   ecma_object_t *comparefn_obj_p = ecma_get_object_from_value (compare_func);
@@ -1494,6 +1478,240 @@ ecma_builtin_typedarray_prototype_sort_compare_helper (ecma_value_t lhs, /**< le
   return ret_value;
 } /* ecma_builtin_typedarray_prototype_sort_compare_helper */
 
+/**
+ * Maximum number of elements sorted by insertion sort in ecma_builtin_typedarray_prototype_sort_numbers
+ */
+#define ECMA_TYPEDARRAY_INSERTION_SORT_LIMIT 16
+
+/**
+ * Restore the max-heap property of a subtree for ecma_builtin_typedarray_prototype_sort_numbers
+ */
+static void
+ecma_builtin_typedarray_prototype_sort_sift_down (ecma_number_t *array_p, /**< array */
+                                                  uint32_t index, /**< root of the subtree */
+                                                  uint32_t length) /**< size of the heap */
+{
+  ecma_number_t value = array_p[index];
+
+  while (true)
+  {
+    uint32_t child_index = 2 * index + 1;
+
+    if (child_index >= length)
+    {
+      break;
+    }
+
+    if (child_index + 1 < length && array_p[child_index] < array_p[child_index + 1])
+    {
+      child_index++;
+    }
+
+    if (!(value < array_p[child_index]))
+    {
+      break;
+    }
+
+    array_p[index] = array_p[child_index];
+    index = child_index;
+  }
+
+  array_p[index] = value;
+} /* ecma_builtin_typedarray_prototype_sort_sift_down */
+
+/**
+ * Sort an array of numbers which contains no NaN values with introsort:
+ * quick sort with a median of three pivot, which falls back to heap sort
+ * when the partitions get unbalanced, and insertion sort for short ranges.
+ */
+static void
+ecma_builtin_typedarray_prototype_sort_numbers (ecma_number_t *array_p, /**< array */
+                                                uint32_t length, /**< length of the array */
+                                                uint32_t depth_limit) /**< remaining partitioning depth */
+{
+  while (length > ECMA_TYPEDARRAY_INSERTION_SORT_LIMIT)
+  {
+    if (depth_limit == 0)
+    {
+      for (uint32_t i = length / 2; i > 0; i--)
+      {
+        ecma_builtin_typedarray_prototype_sort_sift_down (array_p, i - 1, length);
+      }
+
+      for (uint32_t i = length - 1; i > 0; i--)
+      {
+        ecma_number_t max_value = array_p[0];
+        array_p[0] = array_p[i];
+        array_p[i] = max_value;
+        ecma_builtin_typedarray_prototype_sort_sift_down (array_p, 0, i);
+      }
+      return;
+    }
+
+    depth_limit--;
+
+    /* Order the first, middle and last elements, the middle one becomes the pivot. */
+    uint32_t middle = length / 2;
+    ecma_number_t tmp;
+
+    if (array_p[middle] < array_p[0])
+    {
+      tmp = array_p[middle];
+      array_p[middle] = array_p[0];
+      array_p[0] = tmp;
+    }
+
+    if (array_p[length - 1] < array_p[middle])
+    {
+      tmp = array_p[length - 1];
+      array_p[length - 1] = array_p[middle];
+      array_p[middle] = tmp;
+
+      if (array_p[middle] < array_p[0])
+      {
+        tmp = array_p[middle];
+        array_p[middle] = array_p[0];
+        array_p[0] = tmp;
+      }
+    }
+
+    ecma_number_t pivot = array_p[middle];
+    uint32_t left = 0;
+    uint32_t right = length - 1;
+
+    /* Hoare partition: [0, right] <= pivot <= [right + 1, length - 1] */
+    while (true)
+    {
+      while (array_p[left] < pivot)
+      {
+        left++;
+      }
+
+      while (pivot < array_p[right])
+      {
+        right--;
+      }
+
+      if (left >= right)
+      {
+        break;
+      }
+
+      tmp = array_p[left];
+      array_p[left] = array_p[right];
+      array_p[right] = tmp;
+      left++;
+      right--;
+    }
+
+    uint32_t left_length = right + 1;
+
+    /* Recurse into the smaller partition to keep the stack usage logarithmic. */
+    if (left_length < length - left_length)
+    {
+      ecma_builtin_typedarray_prototype_sort_numbers (array_p, left_length, depth_limit);
+      array_p += left_length;
+      length -= left_length;
+    }
+    else
+    {
+      ecma_builtin_typedarray_prototype_sort_numbers (array_p + left_length, length - left_length, depth_limit);
+      length = left_length;
+    }
+  }
+
+  for (uint32_t i = 1; i < length; i++)
+  {
+    ecma_number_t value = array_p[i];
+    uint32_t j = i;
+
+    while (j > 0 && value < array_p[j - 1])
+    {
+      array_p[j] = array_p[j - 1];
+      j--;
+    }
+
+    array_p[j] = value;
+  }
+} /* ecma_builtin_typedarray_prototype_sort_numbers */
+
+/**
+ * Sort the elements of a TypedArray in ascending order without a comparator function.
+ *
+ * Single byte elements are sorted by counting their values, other elements are
+ * converted to a native number array and sorted by introsort. NaN values are
+ * placed at the end of the array.
+ */
+static void
+ecma_builtin_typedarray_prototype_sort_native (ecma_typedarray_info_t *info_p) /**< typedarray info */
+{
+  if (info_p->element_size == 1)
+  {
+    uint32_t counts[256];
+    memset (counts, 0, sizeof (counts));
+
+    for (uint32_t i = 0; i < info_p->length; i++)
+    {
+      counts[info_p->buffer_p[i]]++;
+    }
+
+    /* The negative values of an Int8Array are stored in the upper half of the byte range. */
+    uint32_t sign_mask = (info_p->id == ECMA_INT8_ARRAY) ? 0x80 : 0;
+    lit_utf8_byte_t *dest_p = info_p->buffer_p;
+
+    for (uint32_t i = 0; i < 256; i++)
+    {
+      uint32_t byte = i ^ sign_mask;
+      memset (dest_p, (int) byte, counts[byte]);
+      dest_p += counts[byte];
+    }
+    return;
+  }
+
+  JMEM_DEFINE_LOCAL_ARRAY (values_buffer, info_p->length, ecma_number_t);
+
+  ecma_typedarray_getter_fn_t typedarray_getter_cb = ecma_get_typedarray_getter_fn (info_p->id);
+  uint32_t length = 0;
+  uint32_t nan_count = 0;
+
+  for (uint32_t i = 0; i < info_p->length; i++)
+  {
+    ecma_number_t element_num = typedarray_getter_cb (info_p->buffer_p + (i << info_p->shift));
+
+    if (ecma_number_is_nan (element_num))
+    {
+      nan_count++;
+    }
+    else
+    {
+      values_buffer[length++] = element_num;
+    }
+  }
+
+  uint32_t depth_limit = 0;
+
+  for (uint32_t i = length; i > 1; i >>= 1)
+  {
+    depth_limit += 2;
+  }
+
+  ecma_builtin_typedarray_prototype_sort_numbers (values_buffer, length, depth_limit);
+
+  ecma_typedarray_setter_fn_t typedarray_setter_cb = ecma_get_typedarray_setter_fn (info_p->id);
+
+  for (uint32_t i = 0; i < length; i++)
+  {
+    typedarray_setter_cb (info_p->buffer_p + (i << info_p->shift), values_buffer[i]);
+  }
+
+  for (uint32_t i = 0; i < nan_count; i++)
+  {
+    typedarray_setter_cb (info_p->buffer_p + ((length + i) << info_p->shift), ecma_number_make_nan ());
+  }
+
+  JMEM_FINALIZE_LOCAL_ARRAY (values_buffer);
+} /* ecma_builtin_typedarray_prototype_sort_native */
+
 /**
  * The %TypedArray%.prototype object's 'sort' routine.
  *
@@ -1530,6 +1748,12 @@ ecma_builtin_typedarray_prototype_sort (ecma_value_t this_arg, /**< this argumen
     return ecma_copy_value (this_arg);
   }
 
+  if (ecma_is_value_undefined (compare_func))
+  {
+    ecma_builtin_typedarray_prototype_sort_native (&info);
+    return ecma_copy_value (this_arg);
+  }
+
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
 
   JMEM_DEFINE_LOCAL_ARRAY (values_buffer, info.length, ecma_value_t);
@@ -1707,6 +1931,91 @@ ecma_builtin_typedarray_prototype_find_index (ecma_value_t this_arg, /**< this a
   return ecma_builtin_typedarray_prototype_find_helper (this_arg, predicate, predicate_this_arg, false);
 } /* ecma_builtin_typedarray_prototype_find_index */
 
+/**
+ * Compare the elements of the array with the searched element as the given unsigned integer type
+ * in ecma_builtin_typedarray_prototype_index_scan.
+ */
+#define ECMA_TYPEDARRAY_INDEX_SCAN(type) \
+  { \
+    type search_value; \
+    memcpy (&search_value, element_p, sizeof (type)); \
+    \
+    for (uint32_t index = from_index; index != end_index; index += step) \
+    { \
+      type value; \
+      memcpy (&value, buffer_p + index * sizeof (type), sizeof (type)); \
+      \
+      if (value == search_value) \
+      { \
+        *found_index_p = index; \
+        return true; \
+      } \
+    } \
+    return false; \
+  }
+
+/**
+ * Scan a TypedArray for an element by comparing the bytes of the elements.
+ *
+ * Note:
+ *      the element must have a single byte representation, i.e. it cannot be NaN or a floating point zero
+ *
+ * @return true - if the element is found, and its index is stored into found_index_p
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_typedarray_prototype_index_scan (ecma_typedarray_info_t *info_p, /**< typedarray info */
+                                              const lit_utf8_byte_t *element_p, /**< bytes of the searched element */
+                                              uint32_t from_index, /**< start index */
+                                              bool is_last_index_of, /**< true - search backwards
+                                                                      *   false - search forwards */
+                                              uint32_t *found_index_p) /**< [out] index of the element */
+{
+  JERRY_ASSERT (from_index < info_p->length);
+
+  const lit_utf8_byte_t *buffer_p = info_p->buffer_p;
+
+  if (info_p->element_size == 1 && !is_last_index_of)
+  {
+    const lit_utf8_byte_t *found_p = memchr (buffer_p + from_index, *element_p, info_p->length - from_index);
+
+    if (found_p == NULL)
+    {
+      return false;
+    }
+
+    *found_index_p = (uint32_t) (found_p - buffer_p);
+    return true;
+  }
+
+  /* The end index is UINT32_MAX in lastIndexOf, since the index wraps around after zero. */
+  uint32_t end_index = is_last_index_of ? UINT32_MAX : info_p->length;
+  uint32_t step = is_last_index_of ? UINT32_MAX : 1;
+
+  switch (info_p->element_size)
+  {
+    case 1:
+    {
+      ECMA_TYPEDARRAY_INDEX_SCAN (uint8_t)
+    }
+    case 2:
+    {
+      ECMA_TYPEDARRAY_INDEX_SCAN (uint16_t)
+    }
+    case 4:
+    {
+      ECMA_TYPEDARRAY_INDEX_SCAN (uint32_t)
+    }
+    default:
+    {
+      JERRY_ASSERT (info_p->element_size == 8);
+      ECMA_TYPEDARRAY_INDEX_SCAN (uint64_t)
+    }
+  }
+} /* ecma_builtin_typedarray_prototype_index_scan */
+
+#undef ECMA_TYPEDARRAY_INDEX_SCAN
+
 /**
  * The %TypedArray%.prototype object's 'indexOf' and 'lastIndexOf' routine helper
  *
@@ -1735,7 +2044,6 @@ ecma_builtin_typedarray_prototype_index_helper (ecma_value_t this_arg, /**< this
     return ecma_raise_type_error (ECMA_ERR_MSG ("ArrayBuffer has been detached."));
   }
 
-  uint32_t limit = info.length * info.element_size;
   uint32_t from_index;
 
   if (args_number == 0
@@ -1770,21 +2078,62 @@ ecma_builtin_typedarray_prototype_index_helper (ecma_value_t this_arg, /**< this
     }
   }
 
+  if (is_last_index_of)
+  {
+    if (from_index == UINT32_MAX)
+    {
+      return ecma_make_integer_value (-1);
+    }
+
+    from_index = JERRY_MIN (from_index, info.length - 1);
+  }
+  else if (from_index >= info.length)
+  {
+    return ecma_make_integer_value (-1);
+  }
+
   ecma_number_t search_num = ecma_get_number_from_value (args[0]);
 
-  int32_t increment = is_last_index_of ? -info.element_size : info.element_size;
+  if (ecma_number_is_nan (search_num))
+  {
+    return ecma_make_integer_value (-1);
+  }
+
+  /* Convert the searched value to the element type: values which cannot be
+   * stored in the array without change cannot be equal to any of its elements. */
+  uint64_t search_element = 0;
+  lit_utf8_byte_t *search_element_p = (lit_utf8_byte_t *) &search_element;
+
+  ecma_get_typedarray_setter_fn (info.id) (search_element_p, search_num);
   ecma_typedarray_getter_fn_t getter_cb = ecma_get_typedarray_getter_fn (info.id);
 
-  for (int32_t position = (int32_t) from_index * info.element_size;
-       (is_last_index_of ? position >= 0 : (uint32_t) position < limit);
-       position += increment)
+  if (getter_cb (search_element_p) != search_num)
   {
-    ecma_number_t element_num = getter_cb (info.buffer_p + position);
+    return ecma_make_integer_value (-1);
+  }
+
+  uint32_t index = from_index;
 
-    if (search_num == element_num)
+  /* Positive and negative zero are equal, but have different bytes in float arrays. */
+  if (search_num != 0 || info.id < ECMA_FLOAT32_ARRAY)
+  {
+    if (ecma_builtin_typedarray_prototype_index_scan (&info, search_element_p, from_index, is_last_index_of, &index))
     {
-      return ecma_make_number_value ((ecma_number_t) position / info.element_size);
+      return ecma_make_uint32_value (index);
     }
+
+    return ecma_make_integer_value (-1);
+  }
+
+  /* The index wraps around to UINT32_MAX after zero in lastIndexOf. */
+  while (index < info.length)
+  {
+    if (getter_cb (info.buffer_p + (index << info.shift)) == 0)
+    {
+      return ecma_make_uint32_value (index);
+    }
+
+    index = is_last_index_of ? index - 1 : index + 1;
   }
 
   return ecma_make_integer_value (-1);
@@ -39,11 +39,6 @@ NUMBER_VALUE (LIT_MAGIC_STRING_BYTES_PER_ELEMENT_U,
               TYPEDARRAY_BYTES_PER_ELEMENT,
               ECMA_PROPERTY_FIXED)
 
-/* ES2015 22.2.5 */
-NUMBER_VALUE (LIT_MAGIC_STRING_LENGTH,
-              3,
-              ECMA_PROPERTY_FIXED)
-
 /* ES2015 22.2.5 */
 STRING_VALUE (LIT_MAGIC_STRING_NAME,
               TYPEDARRAY_MAGIC_STRING_ID,
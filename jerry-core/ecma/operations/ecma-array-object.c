@@ -219,6 +219,8 @@ ecma_fast_array_set_property (ecma_object_t *object_p, /**< fast access mode arr
   ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
   JERRY_ASSERT (ext_obj_p->u.array.is_fast_mode);
 
+  ECMA_GC_WRITE_BARRIER (object_p);
+
   ecma_value_t *values_p;
 
   if (JERRY_LIKELY (index < ext_obj_p->u.array.length))
@@ -296,6 +298,9 @@ ecma_fast_array_extend (ecma_object_t *object_p, /**< fast access mode array obj
 
   ecma_ref_object (object_p);
 
+  /* The new items are filled by the caller. */
+  ECMA_GC_WRITE_BARRIER (object_p);
+
   ecma_value_t *new_values_p;
   const uint32_t old_length_aligned = ECMA_FAST_ARRAY_ALIGN_LENGTH (old_length);
   const uint32_t new_length_aligned = ECMA_FAST_ARRAY_ALIGN_LENGTH (new_length);
@@ -45,7 +45,13 @@ ecma_op_abstract_equality_compare (ecma_value_t x, /**< first operand */
 {
   if (x == y)
   {
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+    /* NaN values are canonicalized, so their representation is the same. */
+    return ecma_make_boolean_value (!ecma_is_value_float_number (x)
+                                    || !ecma_number_is_nan (ecma_get_float_from_value (x)));
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
     return ECMA_VALUE_TRUE;
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
   }
 
   if (ecma_are_values_integer_numbers (x, y))
@@ -35,6 +35,336 @@
  * @{
  */
 
+/**
+ * Initial capacity of the hash table of Map/Set objects
+ */
+#define ECMA_CONTAINER_INITIAL_CAPACITY 4
+
+/**
+ * Allocate an empty hash table for a Map/Set object
+ *
+ * @return pointer to the hash table
+ */
+static ecma_container_table_t *
+ecma_op_container_alloc_table (uint32_t capacity) /**< capacity of the table */
+{
+  JERRY_ASSERT ((capacity & (capacity - 1)) == 0);
+
+  ecma_container_table_t *table_p;
+  table_p = (ecma_container_table_t *) jmem_heap_alloc_block (ECMA_CONTAINER_TABLE_SIZE (capacity));
+
+  table_p->capacity = capacity;
+  table_p->count = 0;
+  table_p->iterators_p = NULL;
+
+  uint32_t *buckets_p = ECMA_CONTAINER_TABLE_BUCKETS (table_p);
+
+  for (uint32_t i = 0; i < 2 * capacity; i++)
+  {
+    buckets_p[i] = ECMA_CONTAINER_EMPTY_BUCKET;
+  }
+
+  return table_p;
+} /* ecma_op_container_alloc_table */
+
+/**
+ * Get the hash table of a Map/Set object
+ *
+ * @return pointer to the hash table
+ */
+static inline ecma_container_table_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_op_container_get_table (ecma_map_object_t *map_object_p) /**< map/set object */
+{
+  return ECMA_GET_INTERNAL_VALUE_POINTER (ecma_container_table_t, map_object_p->header.u.class_prop.u.value);
+} /* ecma_op_container_get_table */
+
+/**
+ * Convert a key argument to the representation which is stored in the hash table
+ *
+ * Note:
+ *      -0 is converted to +0, and integral floating point numbers are converted
+ *      to integer values, so equal numbers (except NaN) have equal ecma values
+ *
+ * @return normalized key
+ */
+static ecma_value_t
+ecma_op_container_normalize_key (ecma_value_t key_arg) /**< key argument */
+{
+  if (ecma_is_value_float_number (key_arg))
+  {
+    ecma_number_t number = ecma_get_float_from_value (key_arg);
+
+    if (ECMA_IS_INTEGER_NUMBER (number))
+    {
+      ecma_integer_value_t integer = (ecma_integer_value_t) number;
+
+      if ((ecma_number_t) integer == number)
+      {
+        return ecma_make_integer_value (integer);
+      }
+    }
+  }
+
+  return key_arg;
+} /* ecma_op_container_normalize_key */
+
+/**
+ * Calculate the hash of a normalized key
+ *
+ * @return hash of the key
+ */
+static uint32_t
+ecma_op_container_hash (ecma_value_t key) /**< normalized key */
+{
+  if (ecma_is_value_string (key))
+  {
+    return ecma_string_hash (ecma_get_string_from_value (key));
+  }
+
+  uint32_t hash = (uint32_t) key;
+
+  if (ecma_is_value_float_number (key))
+  {
+    ecma_number_t number = ecma_get_float_from_value (key);
+
+    if (ecma_number_is_nan (number))
+    {
+      return 0;
+    }
+
+    uint32_t words[sizeof (ecma_number_t) / sizeof (uint32_t)];
+    memcpy (words, &number, sizeof (ecma_number_t));
+
+    hash = words[0];
+
+    for (uint32_t i = 1; i < sizeof (ecma_number_t) / sizeof (uint32_t); i++)
+    {
+      hash ^= words[i];
+    }
+  }
+
+  /* Object pointers and integers have only a few varying low bits, so the bits are mixed. */
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35u;
+  hash ^= hash >> 16;
+
+  return hash;
+} /* ecma_op_container_hash */
+
+/**
+ * Compare a stored key with a normalized key using the SameValueZero algorithm
+ *
+ * @return true - if the keys are equal
+ *         false - otherwise
+ */
+static bool
+ecma_op_container_key_equals (ecma_value_t stored_key, /**< key stored in the table */
+                              ecma_value_t key) /**< normalized key */
+{
+  if (stored_key == key)
+  {
+    return true;
+  }
+
+  if (ecma_is_value_string (stored_key) && ecma_is_value_string (key))
+  {
+    return ecma_compare_ecma_strings (ecma_get_string_from_value (stored_key), ecma_get_string_from_value (key));
+  }
+
+  if (ecma_is_value_float_number (stored_key) && ecma_is_value_float_number (key))
+  {
+    ecma_number_t stored_number = ecma_get_float_from_value (stored_key);
+    ecma_number_t number = ecma_get_float_from_value (key);
+
+    return (stored_number == number
+            || (ecma_number_is_nan (stored_number) && ecma_number_is_nan (number)));
+  }
+
+  return false;
+} /* ecma_op_container_key_equals */
+
+/**
+ * Find the entry of a key in the hash table
+ *
+ * @return pointer to the entry - if the key is found
+ *         NULL - otherwise
+ */
+static ecma_container_entry_t *
+ecma_op_container_find (ecma_container_table_t *table_p, /**< hash table */
+                        ecma_value_t key, /**< normalized key */
+                        uint32_t hash) /**< hash of the key */
+{
+  if (table_p->count == 0)
+  {
+    return NULL;
+  }
+
+  ecma_container_entry_t *entries_p = ECMA_CONTAINER_TABLE_ENTRIES (table_p);
+  uint32_t *buckets_p = ECMA_CONTAINER_TABLE_BUCKETS (table_p);
+  uint32_t mask = 2 * table_p->capacity - 1;
+  uint32_t bucket = hash & mask;
+
+  while (buckets_p[bucket] != ECMA_CONTAINER_EMPTY_BUCKET)
+  {
+    ecma_container_entry_t *entry_p = entries_p + buckets_p[bucket];
+
+    if (ecma_op_container_key_equals (entry_p->key, key))
+    {
+      return entry_p;
+    }
+
+    bucket = (bucket + 1) & mask;
+  }
+
+  return NULL;
+} /* ecma_op_container_find */
+
+/**
+ * Insert an entry index into the first free bucket of its probe sequence
+ */
+static void
+ecma_op_container_insert_bucket (ecma_container_table_t *table_p, /**< hash table */
+                                 uint32_t hash, /**< hash of the key */
+                                 uint32_t index) /**< entry index */
+{
+  uint32_t *buckets_p = ECMA_CONTAINER_TABLE_BUCKETS (table_p);
+  uint32_t mask = 2 * table_p->capacity - 1;
+  uint32_t bucket = hash & mask;
+
+  while (buckets_p[bucket] != ECMA_CONTAINER_EMPTY_BUCKET)
+  {
+    bucket = (bucket + 1) & mask;
+  }
+
+  buckets_p[bucket] = index;
+} /* ecma_op_container_insert_bucket */
+
+/**
+ * Replace the hash table of a Map/Set object with a table which contains
+ * the live entries of the original table in insertion order
+ *
+ * Note:
+ *      the position of the registered iterators is adjusted to the new entry indices
+ *
+ * @return pointer to the new hash table
+ */
+static ecma_container_table_t *
+ecma_op_container_rebuild (ecma_map_object_t *map_object_p, /**< map/set object */
+                           uint32_t capacity) /**< capacity of the new table */
+{
+  JERRY_ASSERT (map_object_p->size <= capacity);
+
+  ecma_container_table_t *new_table_p = ecma_op_container_alloc_table (capacity);
+  ecma_container_table_t *table_p = ecma_op_container_get_table (map_object_p);
+  ecma_container_entry_t *entries_p = ECMA_CONTAINER_TABLE_ENTRIES (table_p);
+  ecma_container_entry_t *new_entries_p = ECMA_CONTAINER_TABLE_ENTRIES (new_table_p);
+  uint32_t count = 0;
+
+  for (uint32_t i = 0; i < table_p->count; i++)
+  {
+    if (!ecma_is_value_empty (entries_p[i].key))
+    {
+      new_entries_p[count] = entries_p[i];
+      ecma_op_container_insert_bucket (new_table_p, ecma_op_container_hash (entries_p[i].key), count);
+      count++;
+    }
+  }
+
+  JERRY_ASSERT (count == map_object_p->size);
+  new_table_p->count = count;
+
+  ecma_collection_t *iterators_p = table_p->iterators_p;
+
+  if (iterators_p != NULL)
+  {
+    ecma_value_t *buffer_p = iterators_p->buffer_p;
+
+    for (uint32_t i = 0; i + 1 < iterators_p->item_count; i += 2)
+    {
+      if (ecma_is_value_empty (buffer_p[i]))
+      {
+        continue;
+      }
+
+      /* The next index of an iterator is the number of live entries before its old index. */
+      uint32_t index = (uint32_t) buffer_p[i + 1];
+      uint32_t new_index = 0;
+
+      for (uint32_t j = 0; j < index; j++)
+      {
+        if (!ecma_is_value_empty (entries_p[j].key))
+        {
+          new_index++;
+        }
+      }
+
+      buffer_p[i + 1] = new_index;
+    }
+  }
+
+  new_table_p->iterators_p = iterators_p;
+
+  jmem_heap_free_block (table_p, ECMA_CONTAINER_TABLE_SIZE (table_p->capacity));
+  ECMA_SET_INTERNAL_VALUE_POINTER (map_object_p->header.u.class_prop.u.value, new_table_p);
+  return new_table_p;
+} /* ecma_op_container_rebuild */
+
+/**
+ * Register an iterator or a forEach call of a Map/Set object
+ *
+ * Note:
+ *      the (owner, next index) pairs are never moved, so the returned slot
+ *      identifies the registration until it is unregistered
+ *
+ * @return slot of the registration
+ */
+static uint32_t
+ecma_op_container_register (ecma_container_table_t *table_p, /**< hash table */
+                            ecma_value_t owner) /**< iterator object or ECMA_VALUE_UNDEFINED for forEach */
+{
+  if (table_p->iterators_p == NULL)
+  {
+    table_p->iterators_p = ecma_new_collection ();
+  }
+
+  ecma_collection_t *iterators_p = table_p->iterators_p;
+
+  for (uint32_t i = 0; i + 1 < iterators_p->item_count; i += 2)
+  {
+    if (ecma_is_value_empty (iterators_p->buffer_p[i]))
+    {
+      iterators_p->buffer_p[i] = owner;
+      iterators_p->buffer_p[i + 1] = 0;
+      return i;
+    }
+  }
+
+  uint32_t slot = iterators_p->item_count;
+  ecma_collection_push_back (iterators_p, owner);
+  ecma_collection_push_back (iterators_p, 0);
+  return slot;
+} /* ecma_op_container_register */
+
+/**
+ * Unregister an iterator or a forEach call of a Map/Set object
+ */
+static void
+ecma_op_container_unregister (ecma_container_table_t *table_p, /**< hash table */
+                              uint32_t slot) /**< slot of the registration */
+{
+  ecma_collection_t *iterators_p = table_p->iterators_p;
+  ecma_value_t *buffer_p = iterators_p->buffer_p;
+
+  buffer_p[slot] = ECMA_VALUE_EMPTY;
+
+  while (iterators_p->item_count >= 2 && ecma_is_value_empty (buffer_p[iterators_p->item_count - 2]))
+  {
+    iterators_p->item_count -= 2;
+  }
+} /* ecma_op_container_unregister */
+
 /**
  * Handle calling [[Construct]] of built-in map/set like objects
  *
@@ -48,7 +378,7 @@ ecma_op_container_create (const ecma_value_t *arguments_list_p, /**< arguments l
 {
   JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
 
-  ecma_object_t *internal_object_p = ecma_create_object (NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_container_table_t *table_p = ecma_op_container_alloc_table (0);
 
   ecma_object_t *object_p = ecma_create_object (ecma_builtin_get (proto_id),
                                                 sizeof (ecma_map_object_t),
@@ -56,11 +386,9 @@ ecma_op_container_create (const ecma_value_t *arguments_list_p, /**< arguments l
 
   ecma_map_object_t *map_obj_p = (ecma_map_object_t *) object_p;
   map_obj_p->header.u.class_prop.class_id = (uint16_t) lit_id;
-  map_obj_p->header.u.class_prop.u.value = ecma_make_object_value (internal_object_p);
+  ECMA_SET_INTERNAL_VALUE_POINTER (map_obj_p->header.u.class_prop.u.value, table_p);
   map_obj_p->size = 0;
 
-  ecma_deref_object (internal_object_p);
-
   ecma_value_t set_value = ecma_make_object_value (object_p);
 
 #if ENABLED (JERRY_ES2015_BUILTIN_SYMBOL)
@@ -224,69 +552,6 @@ ecma_op_container_get_object (ecma_value_t this_arg, /**< this argument */
   return NULL;
 } /* ecma_op_container_get_object */
 
-/**
- * Creates a property key for the internal object from the given argument
- *
- * Note:
- *      This operation does not increase the reference counter of strings and symbols
- *
- * @return property key
- */
-static ecma_string_t *
-ecma_op_container_to_key (ecma_value_t key_arg) /**< key argument */
-{
-  if (ecma_is_value_prop_name (key_arg))
-  {
-    ecma_string_t *prop_name_p = ecma_get_prop_name_from_value (key_arg);
-    ecma_ref_ecma_string (prop_name_p);
-    return prop_name_p;
-  }
-
-  if (ecma_is_value_object (key_arg))
-  {
-    ecma_object_t *obj_p = ecma_get_object_from_value (key_arg);
-    ecma_string_t *key_string_p = ecma_get_magic_string (LIT_INTERNAL_MAGIC_STRING_MAP_KEY);
-
-    if (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY
-        && ((ecma_extended_object_t *) obj_p)->u.array.is_fast_mode)
-    {
-      ecma_fast_array_convert_to_normal (obj_p);
-    }
-
-    ecma_property_t *property_p = ecma_find_named_property (obj_p, key_string_p);
-    ecma_string_t *object_key_string;
-
-    if (property_p == NULL)
-    {
-      object_key_string = ecma_new_map_key_string (key_arg);
-      ecma_property_value_t *value_p = ecma_create_named_data_property (obj_p,
-                                                                        key_string_p,
-                                                                        ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
-                                                                        NULL);
-      value_p->value = ecma_make_string_value (object_key_string);
-    }
-    else
-    {
-      object_key_string = ecma_get_string_from_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
-    }
-
-    ecma_ref_ecma_string (object_key_string);
-    return object_key_string;
-  }
-
-  if (ecma_is_value_integer_number (key_arg))
-  {
-    ecma_integer_value_t integer = ecma_get_integer_from_value (key_arg);
-
-    if (JERRY_LIKELY (integer > 0 && integer <= ECMA_DIRECT_STRING_MAX_IMM))
-    {
-      return (ecma_string_t *) ECMA_CREATE_DIRECT_STRING (ECMA_DIRECT_STRING_ECMA_INTEGER, (uintptr_t) integer);
-    }
-  }
-
-  return ecma_new_map_key_string (key_arg);
-} /* ecma_op_container_to_key */
-
 /**
  * Returns with the size of the map/set object.
  *
@@ -328,20 +593,17 @@ ecma_op_container_get (ecma_value_t this_arg, /**< this argument */
     return ECMA_VALUE_UNDEFINED;
   }
 
-  ecma_object_t *internal_obj_p = ecma_get_object_from_value (map_object_p->header.u.class_prop.u.value);
-
-  ecma_string_t *prop_name_p = ecma_op_container_to_key (key_arg);
-
-  ecma_property_t *property_p = ecma_find_named_property (internal_obj_p, prop_name_p);
-
-  ecma_deref_ecma_string (prop_name_p);
+  ecma_value_t key = ecma_op_container_normalize_key (key_arg);
+  ecma_container_entry_t *entry_p = ecma_op_container_find (ecma_op_container_get_table (map_object_p),
+                                                            key,
+                                                            ecma_op_container_hash (key));
 
-  if (property_p == NULL || ecma_is_value_empty (ECMA_PROPERTY_VALUE_PTR (property_p)->value))
+  if (entry_p == NULL)
   {
     return ECMA_VALUE_UNDEFINED;
   }
 
-  return ecma_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+  return ecma_copy_value (entry_p->value);
 } /* ecma_op_container_get */
 
 /**
@@ -367,16 +629,12 @@ ecma_op_container_has (ecma_value_t this_arg, /**< this argument */
     return ECMA_VALUE_FALSE;
   }
 
-  ecma_object_t *internal_obj_p = ecma_get_object_from_value (map_object_p->header.u.class_prop.u.value);
+  ecma_value_t key = ecma_op_container_normalize_key (key_arg);
+  ecma_container_entry_t *entry_p = ecma_op_container_find (ecma_op_container_get_table (map_object_p),
+                                                            key,
+                                                            ecma_op_container_hash (key));
 
-  ecma_string_t *prop_name_p = ecma_op_container_to_key (key_arg);
-
-  ecma_property_t *property_p = ecma_find_named_property (internal_obj_p, prop_name_p);
-
-  ecma_deref_ecma_string (prop_name_p);
-
-  return ecma_make_boolean_value (property_p != NULL
-                                  && !ecma_is_value_empty (ECMA_PROPERTY_VALUE_PTR (property_p)->value));
+  return ecma_make_boolean_value (entry_p != NULL);
 } /* ecma_op_container_has */
 
 /**
@@ -398,31 +656,48 @@ ecma_op_container_set (ecma_value_t this_arg, /**< this argument */
     return ECMA_VALUE_ERROR;
   }
 
-  ecma_object_t *internal_obj_p = ecma_get_object_from_value (map_object_p->header.u.class_prop.u.value);
+  ecma_value_t key = ecma_op_container_normalize_key (key_arg);
+  uint32_t hash = ecma_op_container_hash (key);
+  ecma_container_table_t *table_p = ecma_op_container_get_table (map_object_p);
+  ecma_container_entry_t *entry_p = ecma_op_container_find (table_p, key, hash);
 
-  ecma_string_t *prop_name_p = ecma_op_container_to_key (key_arg);
+  /* Object keys and values are marked through the map object. */
+  ECMA_GC_WRITE_BARRIER ((ecma_object_t *) &map_object_p->header);
 
-  ecma_property_t *property_p = ecma_find_named_property (internal_obj_p, prop_name_p);
-
-  if (property_p == NULL)
+  if (entry_p != NULL)
   {
-    ecma_property_value_t *value_p = ecma_create_named_data_property (internal_obj_p,
-                                                                      prop_name_p,
-                                                                      ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
-                                                                      NULL);
-    value_p->value = ecma_copy_value_if_not_object (value_arg);
-    map_object_p->size++;
+    if (lit_id != LIT_MAGIC_STRING_SET_UL)
+    {
+      ecma_free_value_if_not_object (entry_p->value);
+      entry_p->value = ecma_copy_value_if_not_object (value_arg);
+    }
   }
   else
   {
-    if (ecma_is_value_empty (ECMA_PROPERTY_VALUE_PTR (property_p)->value))
+    if (table_p->count == table_p->capacity)
     {
-      map_object_p->size++;
+      uint32_t capacity = table_p->capacity;
+
+      /* Deleted entries are dropped, and the table is only grown if it would be more than half full. */
+      if (map_object_p->size + 1 > capacity / 2)
+      {
+        capacity = (capacity == 0) ? ECMA_CONTAINER_INITIAL_CAPACITY : (capacity * 2);
+      }
+
+      table_p = ecma_op_container_rebuild (map_object_p, capacity);
     }
-    ecma_named_data_property_assign_value (internal_obj_p, ECMA_PROPERTY_VALUE_PTR (property_p), value_arg);
+
+    uint32_t index = table_p->count++;
+    entry_p = ECMA_CONTAINER_TABLE_ENTRIES (table_p) + index;
+
+    entry_p->key = ecma_copy_value_if_not_object (key);
+    entry_p->value = ((lit_id == LIT_MAGIC_STRING_SET_UL) ? ECMA_VALUE_UNDEFINED
+                                                          : ecma_copy_value_if_not_object (value_arg));
+
+    ecma_op_container_insert_bucket (table_p, hash, index);
+    map_object_p->size++;
   }
 
-  ecma_deref_ecma_string (prop_name_p);
   ecma_ref_object ((ecma_object_t *) &map_object_p->header);
   return this_arg;
 } /* ecma_op_container_set */
@@ -455,56 +730,41 @@ ecma_op_container_foreach (ecma_value_t this_arg, /**< this argument */
   JERRY_ASSERT (ecma_is_value_object (predicate));
   ecma_object_t *func_object_p = ecma_get_object_from_value (predicate);
 
-  ecma_object_t *internal_obj_p = ecma_get_object_from_value (map_object_p->header.u.class_prop.u.value);
-
-  ecma_collection_t *props_p = ecma_op_object_get_property_names (internal_obj_p, ECMA_LIST_NO_OPTS);
-
-  ecma_value_t *buffer_p = props_p->buffer_p;
-
   ecma_value_t ret_value = ECMA_VALUE_UNDEFINED;
 
-  ecma_ref_object (internal_obj_p);
+  /* The callback may modify the map, so the position is registered like an iterator. */
+  uint32_t slot = ecma_op_container_register (ecma_op_container_get_table (map_object_p), ECMA_VALUE_UNDEFINED);
 
-  for (uint32_t i = 0; i < props_p->item_count; i++)
+  while (true)
   {
-    ecma_string_t *prop_name_p = ecma_get_prop_name_from_value (buffer_p[i]);
-    ecma_property_t *property_p = ecma_find_named_property (internal_obj_p, prop_name_p);
-    JERRY_ASSERT (property_p != NULL);
+    ecma_container_table_t *table_p = ecma_op_container_get_table (map_object_p);
+    ecma_container_entry_t *entries_p = ECMA_CONTAINER_TABLE_ENTRIES (table_p);
+    ecma_value_t *index_p = table_p->iterators_p->buffer_p + slot + 1;
+    uint32_t index = (uint32_t) *index_p;
 
-    if (ecma_is_value_empty (ECMA_PROPERTY_VALUE_PTR (property_p)->value))
+    while (index < table_p->count && ecma_is_value_empty (entries_p[index].key))
     {
-      continue;
+      index++;
     }
 
-    ecma_value_t value = ecma_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
-    ecma_value_t key_arg;
-
-    if (lit_id == LIT_MAGIC_STRING_SET_UL)
-    {
-      key_arg = value;
-    }
-    else if (ecma_prop_name_is_map_key (prop_name_p))
-    {
-      key_arg = ((ecma_extended_string_t *) prop_name_p)->u.value;
-    }
-    else
+    if (index >= table_p->count)
     {
-      if (ECMA_IS_DIRECT_STRING (prop_name_p)
-          && ECMA_GET_DIRECT_STRING_TYPE (prop_name_p) == ECMA_DIRECT_STRING_ECMA_INTEGER)
-      {
-        key_arg = ecma_make_uint32_value ((uint32_t) ECMA_GET_DIRECT_STRING_VALUE (prop_name_p));
-      }
-      else
-      {
-        key_arg = buffer_p[i];
-      }
+      *index_p = index;
+      break;
     }
 
+    *index_p = index + 1;
+
+    ecma_value_t key_arg = ecma_copy_value (entries_p[index].key);
+    ecma_value_t value = ((lit_id == LIT_MAGIC_STRING_SET_UL) ? ecma_copy_value (key_arg)
+                                                              : ecma_copy_value (entries_p[index].value));
+
     ecma_value_t call_args[] = { value, key_arg };
 
     ecma_value_t call_value = ecma_op_function_call (func_object_p, predicate_this_arg, call_args, 2);
 
     ecma_free_value (value);
+    ecma_free_value (key_arg);
 
     if (ECMA_IS_VALUE_ERROR (call_value))
     {
@@ -515,8 +775,7 @@ ecma_op_container_foreach (ecma_value_t this_arg, /**< this argument */
     ecma_free_value (call_value);
   }
 
-  ecma_deref_object (internal_obj_p);
-  ecma_collection_free (props_p);
+  ecma_op_container_unregister (ecma_op_container_get_table (map_object_p), slot);
 
   return ret_value;
 } /* ecma_op_container_foreach */
@@ -538,11 +797,31 @@ ecma_op_container_clear (ecma_value_t this_arg, /**< this argument */
     return ECMA_VALUE_ERROR;
   }
 
-  ecma_object_t *internal_object_p = ecma_create_object (NULL, 0, ECMA_OBJECT_TYPE_GENERAL);
-  map_object_p->header.u.class_prop.u.value = ecma_make_object_value (internal_object_p);
-  map_object_p->size = 0;
+  ecma_container_table_t *new_table_p = ecma_op_container_alloc_table (0);
+  ecma_container_table_t *table_p = ecma_op_container_get_table (map_object_p);
+  ecma_container_entry_t *entries_p = ECMA_CONTAINER_TABLE_ENTRIES (table_p);
+
+  for (uint32_t i = 0; i < table_p->count; i++)
+  {
+    ecma_free_value_if_not_object (entries_p[i].key);
+    ecma_free_value_if_not_object (entries_p[i].value);
+  }
+
+  ecma_collection_t *iterators_p = table_p->iterators_p;
+
+  if (iterators_p != NULL)
+  {
+    for (uint32_t i = 0; i + 1 < iterators_p->item_count; i += 2)
+    {
+      iterators_p->buffer_p[i + 1] = 0;
+    }
+  }
 
-  ecma_deref_object (internal_object_p);
+  new_table_p->iterators_p = iterators_p;
+
+  jmem_heap_free_block (table_p, ECMA_CONTAINER_TABLE_SIZE (table_p->capacity));
+  ECMA_SET_INTERNAL_VALUE_POINTER (map_object_p->header.u.class_prop.u.value, new_table_p);
+  map_object_p->size = 0;
 
   return ECMA_VALUE_UNDEFINED;
 } /* ecma_op_container_clear */
@@ -565,27 +844,94 @@ ecma_op_container_delete (ecma_value_t this_arg, /**< this argument */
     return ECMA_VALUE_ERROR;
   }
 
-  ecma_object_t *internal_obj_p = ecma_get_object_from_value (map_object_p->header.u.class_prop.u.value);
-
-  ecma_string_t *prop_name_p = ecma_op_container_to_key (key_arg);
-
-  ecma_property_t *property_p = ecma_find_named_property (internal_obj_p, prop_name_p);
+  if (map_object_p->size == 0)
+  {
+    return ECMA_VALUE_FALSE;
+  }
 
-  ecma_deref_ecma_string (prop_name_p);
+  ecma_value_t key = ecma_op_container_normalize_key (key_arg);
+  ecma_container_entry_t *entry_p = ecma_op_container_find (ecma_op_container_get_table (map_object_p),
+                                                            key,
+                                                            ecma_op_container_hash (key));
 
-  if (property_p == NULL || ecma_is_value_empty (ECMA_PROPERTY_VALUE_PTR (property_p)->value))
+  if (entry_p == NULL)
   {
     return ECMA_VALUE_FALSE;
   }
 
-  ecma_named_data_property_assign_value (internal_obj_p, ECMA_PROPERTY_VALUE_PTR (property_p), ECMA_VALUE_EMPTY);
+  /* The entry keeps its bucket until the next rebuild, so the probe sequences are not broken. */
+  ecma_free_value_if_not_object (entry_p->key);
+  ecma_free_value_if_not_object (entry_p->value);
+  entry_p->key = ECMA_VALUE_EMPTY;
+  entry_p->value = ECMA_VALUE_UNDEFINED;
   map_object_p->size--;
 
   return ECMA_VALUE_TRUE;
 } /* ecma_op_container_delete */
 
+/**
+ * Free the hash table of a Map/Set object
+ *
+ * Note:
+ *      the registered iterators are detached from the object
+ */
+void
+ecma_op_container_free_table (ecma_object_t *object_p) /**< map/set object */
+{
+  ecma_container_table_t *table_p = ecma_op_container_get_table ((ecma_map_object_t *) object_p);
+  ecma_container_entry_t *entries_p = ECMA_CONTAINER_TABLE_ENTRIES (table_p);
+
+  for (uint32_t i = 0; i < table_p->count; i++)
+  {
+    ecma_free_value_if_not_object (entries_p[i].key);
+    ecma_free_value_if_not_object (entries_p[i].value);
+  }
+
+  ecma_collection_t *iterators_p = table_p->iterators_p;
+
+  if (iterators_p != NULL)
+  {
+    for (uint32_t i = 0; i + 1 < iterators_p->item_count; i += 2)
+    {
+      if (ecma_is_value_object (iterators_p->buffer_p[i]))
+      {
+        ecma_extended_object_t *iterator_p;
+        iterator_p = (ecma_extended_object_t *) ecma_get_object_from_value (iterators_p->buffer_p[i]);
+        iterator_p->u.pseudo_array.u2.iterated_value = ECMA_VALUE_EMPTY;
+      }
+    }
+
+    ecma_collection_destroy (iterators_p);
+  }
+
+  jmem_heap_free_block (table_p, ECMA_CONTAINER_TABLE_SIZE (table_p->capacity));
+} /* ecma_op_container_free_table */
+
 #if ENABLED (JERRY_ES2015_BUILTIN_ITERATOR)
 
+/**
+ * Find the registration slot of an iterator
+ *
+ * @return slot of the registration
+ */
+static uint32_t
+ecma_op_container_find_iterator (ecma_container_table_t *table_p, /**< hash table */
+                                 ecma_value_t iterator) /**< iterator object */
+{
+  ecma_collection_t *iterators_p = table_p->iterators_p;
+  JERRY_ASSERT (iterators_p != NULL);
+
+  uint32_t slot = 0;
+
+  while (iterators_p->buffer_p[slot] != iterator)
+  {
+    slot += 2;
+    JERRY_ASSERT (slot + 1 < iterators_p->item_count);
+  }
+
+  return slot;
+} /* ecma_op_container_find_iterator */
+
 /**
  * The Create{Set, Map}Iterator Abstract operation
  *
@@ -614,10 +960,14 @@ ecma_op_container_create_iterator (ecma_value_t this_arg, /**< this argument */
     return ECMA_VALUE_ERROR;
   }
 
-  return ecma_op_create_iterator_object (this_arg,
-                                         ecma_builtin_get (proto_id),
-                                         (uint8_t) iterator_type,
-                                         type);
+  ecma_value_t iterator = ecma_op_create_iterator_object (this_arg,
+                                                          ecma_builtin_get (proto_id),
+                                                          (uint8_t) iterator_type,
+                                                          type);
+
+  /* The next index is stored in the hash table, so it can be adjusted when the table is rebuilt. */
+  ecma_op_container_register (ecma_op_container_get_table (map_object_p), iterator);
+  return iterator;
 } /* ecma_op_container_create_iterator */
 
 /**
@@ -659,126 +1009,75 @@ ecma_op_container_iterator_next (ecma_value_t this_val, /**< this argument */
   }
 
   ecma_map_object_t *map_object_p = (ecma_map_object_t *) (ecma_get_object_from_value (iterated_value));
+  ecma_container_table_t *table_p = ecma_op_container_get_table (map_object_p);
+  ecma_container_entry_t *entries_p = ECMA_CONTAINER_TABLE_ENTRIES (table_p);
 
-  ecma_object_t *internal_obj_p = ecma_get_object_from_value (map_object_p->header.u.class_prop.u.value);
-  ecma_collection_t *props_p = ecma_op_object_get_property_names (internal_obj_p, ECMA_LIST_NO_OPTS);
-
-  uint32_t length = props_p->item_count;
-  uint32_t index = ext_obj_p->u.pseudo_array.u1.iterator_index;
-
-  if (JERRY_UNLIKELY (index == ECMA_ITERATOR_INDEX_LIMIT))
-  {
-    /* After the ECMA_ITERATOR_INDEX_LIMIT limit is reached the [[%Iterator%NextIndex]]
-       property is stored as an internal property */
-    ecma_string_t *prop_name_p = ecma_get_magic_string (LIT_INTERNAL_MAGIC_STRING_ITERATOR_NEXT_INDEX);
-
-    ecma_property_t *property_p = ecma_find_named_property (obj_p, prop_name_p);
-    ecma_property_value_t *value_p;
+  uint32_t slot = ecma_op_container_find_iterator (table_p, this_val);
+  uint32_t index = (uint32_t) table_p->iterators_p->buffer_p[slot + 1];
 
-    if (property_p == NULL)
-    {
-      value_p = ecma_create_named_data_property (obj_p, prop_name_p, ECMA_PROPERTY_FLAG_WRITABLE, &property_p);
-      value_p->value = ecma_make_uint32_value (index);
-    }
-    else
-    {
-      value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
-      index = (uint32_t) (ecma_get_number_from_value (value_p->value) + 1);
-      value_p->value = ecma_make_uint32_value (index);
-    }
-  }
-  else
+  while (index < table_p->count && ecma_is_value_empty (entries_p[index].key))
   {
-    ext_obj_p->u.pseudo_array.u1.iterator_index++;
+    index++;
   }
 
-  if (index >= length)
+  if (index >= table_p->count)
   {
+    ecma_op_container_unregister (table_p, slot);
     ext_obj_p->u.pseudo_array.u2.iterated_value = ECMA_VALUE_EMPTY;
-    ecma_collection_free (props_p);
     return ecma_create_iter_result_object (ECMA_VALUE_UNDEFINED, ECMA_VALUE_TRUE);
   }
 
-  uint8_t iterator_kind = ext_obj_p->u.pseudo_array.extra_info;
+  table_p->iterators_p->buffer_p[slot + 1] = index + 1;
 
-  ecma_value_t *buffer_p = props_p->buffer_p;
-
-  ecma_value_t ret_value = ECMA_VALUE_UNDEFINED;
+  uint8_t iterator_kind = ext_obj_p->u.pseudo_array.extra_info;
+  ecma_value_t key_arg = entries_p[index].key;
+  ecma_value_t value = (iterator_type == ECMA_PSEUDO_SET_ITERATOR) ? key_arg : entries_p[index].value;
 
-  for (uint32_t i = 0; i < props_p->item_count; i++)
+  if (iterator_kind == ECMA_ITERATOR_KEYS)
   {
-    if (index > 0)
-    {
-      index--;
-      continue;
-    }
-
-    ecma_string_t *prop_name_p = ecma_get_prop_name_from_value (buffer_p[i]);
-    ecma_property_t *property_p = ecma_find_named_property (internal_obj_p, prop_name_p);
-    JERRY_ASSERT (property_p != NULL);
+    return ecma_create_iter_result_object (key_arg, ECMA_VALUE_FALSE);
+  }
 
-    if (ecma_is_value_empty (ECMA_PROPERTY_VALUE_PTR (property_p)->value))
-    {
-      if (i == props_p->item_count - 1)
-      {
-        ret_value = ecma_create_iter_result_object (ECMA_VALUE_UNDEFINED, ECMA_VALUE_TRUE);
-      }
-      continue;
-    }
+  if (iterator_kind == ECMA_ITERATOR_VALUES)
+  {
+    return ecma_create_iter_result_object (value, ECMA_VALUE_FALSE);
+  }
 
-    ecma_value_t value = ecma_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
-    ecma_value_t key_arg;
+  JERRY_ASSERT (iterator_kind == ECMA_ITERATOR_KEYS_VALUES);
 
-    if (iterator_type == ECMA_PSEUDO_SET_ITERATOR)
-    {
-      key_arg = value;
-    }
-    else if (ecma_prop_name_is_map_key (prop_name_p))
-    {
-      key_arg = ((ecma_extended_string_t *) prop_name_p)->u.value;
-    }
-    else
-    {
-      if (ECMA_IS_DIRECT_STRING (prop_name_p)
-          && ECMA_GET_DIRECT_STRING_TYPE (prop_name_p) == ECMA_DIRECT_STRING_ECMA_INTEGER)
-      {
-        key_arg = ecma_make_uint32_value ((uint32_t) ECMA_GET_DIRECT_STRING_VALUE (prop_name_p));
-      }
-      else
-      {
-        key_arg = buffer_p[i];
-      }
-    }
+  ecma_value_t entry_array_value;
+  entry_array_value = ecma_create_array_from_iter_element (value, key_arg);
 
-    if (iterator_kind == ECMA_ITERATOR_KEYS)
-    {
-      ret_value = ecma_create_iter_result_object (key_arg, ECMA_VALUE_FALSE);
-    }
-    else if (iterator_kind == ECMA_ITERATOR_VALUES)
-    {
-      ret_value = ecma_create_iter_result_object (value, ECMA_VALUE_FALSE);
-    }
-    else
-    {
-      JERRY_ASSERT (iterator_kind == ECMA_ITERATOR_KEYS_VALUES);
+  ecma_value_t ret_value = ecma_create_iter_result_object (entry_array_value, ECMA_VALUE_FALSE);
+  ecma_free_value (entry_array_value);
 
-      ecma_value_t entry_array_value;
-      entry_array_value = ecma_create_array_from_iter_element (value, key_arg);
+  return ret_value;
+} /* ecma_op_container_iterator_next */
 
-      ret_value = ecma_create_iter_result_object (entry_array_value, ECMA_VALUE_FALSE);
-      ecma_free_value (entry_array_value);
-    }
+/**
+ * Unregister a Map/Set iterator which is freed by the garbage collector
+ */
+void
+ecma_op_container_free_iterator (ecma_object_t *object_p) /**< iterator object */
+{
+  ecma_value_t iterated_value = ((ecma_extended_object_t *) object_p)->u.pseudo_array.u2.iterated_value;
 
-    ecma_free_value (value);
-    break;
+  if (ecma_is_value_empty (iterated_value))
+  {
+    return;
   }
 
-  ecma_collection_free (props_p);
+  ecma_map_object_t *map_object_p = (ecma_map_object_t *) ecma_get_object_from_value (iterated_value);
+  ecma_container_table_t *table_p = ecma_op_container_get_table (map_object_p);
 
-  return ret_value;
-} /* ecma_op_container_iterator_next */
+  /* The registrations are not moved during garbage collection, since it may
+   * happen while a new registration is appended to the collection. */
+  uint32_t slot = ecma_op_container_find_iterator (table_p, ecma_make_object_value (object_p));
+  table_p->iterators_p->buffer_p[slot] = ECMA_VALUE_EMPTY;
+} /* ecma_op_container_free_iterator */
 
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_ITERATOR) */
+
 /**
  * @}
  * @}
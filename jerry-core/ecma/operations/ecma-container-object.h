@@ -40,9 +40,11 @@ ecma_value_t ecma_op_container_set (ecma_value_t this_arg, ecma_value_t key_arg,
 
 ecma_value_t ecma_op_container_clear (ecma_value_t this_arg, lit_magic_string_id_t lit_id);
 ecma_value_t ecma_op_container_delete (ecma_value_t this_arg, ecma_value_t key_arg, lit_magic_string_id_t lit_id);
+void ecma_op_container_free_table (ecma_object_t *object_p);
 ecma_value_t ecma_op_container_create_iterator (ecma_value_t this_arg, uint8_t type, lit_magic_string_id_t lit_id,
                                                 ecma_builtin_id_t proto_id, ecma_pseudo_array_type_t iterator_type);
 ecma_value_t ecma_op_container_iterator_next (ecma_value_t this_val, ecma_pseudo_array_type_t iterator_type);
+void ecma_op_container_free_iterator (ecma_object_t *object_p);
 
 /**
  * @}
@@ -26,6 +26,7 @@
 #include "ecma-objects-arguments.h"
 #include "ecma-try-catch-macro.h"
 #include "jcontext.h"
+#include "js-parser.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -123,6 +124,15 @@ ecma_op_create_function_object (ecma_object_t *scope_p, /**< function's scope */
 {
   JERRY_ASSERT (ecma_is_lexical_environment (scope_p));
 
+#if ENABLED (JERRY_PARSER)
+  if (JERRY_UNLIKELY (bytecode_data_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION)
+      && ((const cbc_lazy_function_t *) bytecode_data_p)->compiled_code_p != NULL)
+  {
+    /* The function has already been compiled by a call of another instance. */
+    bytecode_data_p = ((const cbc_lazy_function_t *) bytecode_data_p)->compiled_code_p;
+  }
+#endif /* ENABLED (JERRY_PARSER) */
+
   /* 1., 4., 13. */
   ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE);
 
@@ -687,10 +697,45 @@ ecma_op_set_class_prototype (ecma_value_t completion_value, /**< completion_valu
 
   JERRY_ASSERT (prototype_obj_cp != JMEM_CP_NULL);
 
+  ECMA_GC_WRITE_BARRIER (completion_obj_p);
   completion_obj_p->u2.prototype_cp = prototype_obj_cp;
 } /* ecma_op_set_class_prototype */
 #endif /* ENABLED (JERRY_ES2015_CLASS) */
 
+#if ENABLED (JERRY_PARSER)
+
+/**
+ * Compile a function whose compilation was delayed until its first call,
+ * and replace the lazy function stub of the function object with the byte code.
+ *
+ * @return compiled code - if success
+ *         NULL - otherwise (the syntax error is thrown)
+ */
+static const ecma_compiled_code_t * JERRY_ATTR_NOINLINE
+ecma_op_function_compile_lazy (ecma_extended_object_t *ext_func_p) /**< function object */
+{
+  ecma_compiled_code_t *lazy_bytecode_p;
+  lazy_bytecode_p = (ecma_compiled_code_t *) ecma_op_function_get_compiled_code (ext_func_p);
+
+  cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) lazy_bytecode_p;
+
+  if (lazy_function_p->compiled_code_p == NULL
+      && ECMA_IS_VALUE_ERROR (parser_compile_lazy_function (lazy_bytecode_p)))
+  {
+    return NULL;
+  }
+
+  ecma_compiled_code_t *bytecode_p = lazy_function_p->compiled_code_p;
+
+  ecma_bytecode_ref (bytecode_p);
+  ECMA_SET_INTERNAL_VALUE_POINTER (ext_func_p->u.function.bytecode_cp, bytecode_p);
+  ecma_bytecode_deref (lazy_bytecode_p);
+
+  return bytecode_p;
+} /* ecma_op_function_compile_lazy */
+
+#endif /* ENABLED (JERRY_PARSER) */
+
 /**
  * [[Call]] implementation for Function objects,
  * created through 13.2 (ECMA_OBJECT_TYPE_FUNCTION)
@@ -746,6 +791,18 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
 
       const ecma_compiled_code_t *bytecode_data_p = ecma_op_function_get_compiled_code (ext_func_p);
 
+#if ENABLED (JERRY_PARSER)
+      if (JERRY_UNLIKELY (bytecode_data_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION))
+      {
+        bytecode_data_p = ecma_op_function_compile_lazy (ext_func_p);
+
+        if (JERRY_UNLIKELY (bytecode_data_p == NULL))
+        {
+          return ECMA_VALUE_ERROR;
+        }
+      }
+#endif /* ENABLED (JERRY_PARSER) */
+
 #if ENABLED (JERRY_ES2015_CLASS)
       bool is_class_constructor = (bytecode_data_p->status_flags & CBC_CODE_FLAGS_CONSTRUCTOR) != 0;
 
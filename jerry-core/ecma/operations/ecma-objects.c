@@ -25,6 +25,7 @@
 #include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
+#include "ecma-shape.h"
 #include "jcontext.h"
 
 #if ENABLED (JERRY_ES2015_BUILTIN_TYPEDARRAY)
@@ -1678,6 +1679,83 @@ ecma_op_object_is_prototype_of (ecma_object_t *base_p, /**< base object */
   } while (true);
 } /* ecma_op_object_is_prototype_of */
 
+/**
+ * Helper routine for ecma_op_object_get_property_names: append the name of an own
+ * named data or named accessor property to the collected property names.
+ */
+static void
+ecma_op_object_collect_property_name (ecma_property_t property, /**< property type and flags */
+                                      jmem_cpointer_t name_cp, /**< property name */
+                                      uint32_t opts, /**< any combination of ecma_list_properties_options_t
+                                                      *   values */
+                                      ecma_collection_t *prop_names_p, /**< [in/out] property names */
+                                      ecma_collection_t *skipped_non_enumerable_p, /**< [in/out] skipped
+                                                                                    *   property names */
+                                      uint32_t *own_names_hashes_bitmap) /**< [in/out] hash bitmap of
+                                                                          *   the property names */
+{
+  if (ECMA_PROPERTY_GET_TYPE (property) != ECMA_PROPERTY_TYPE_NAMEDDATA
+      && ECMA_PROPERTY_GET_TYPE (property) != ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
+  {
+    return;
+  }
+
+  if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_MAGIC
+      && name_cp >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
+      && name_cp < LIT_MAGIC_STRING__COUNT)
+  {
+    /* Internal properties are never enumerated. */
+    return;
+  }
+
+  const bool is_enumerable_only = (opts & ECMA_LIST_ENUMERABLE) != 0;
+  ecma_string_t *name_p = ecma_string_from_property_name (property, name_cp);
+
+  if (is_enumerable_only && !ecma_is_property_enumerable (property))
+  {
+    ecma_collection_push_back (skipped_non_enumerable_p, ecma_make_prop_name_value (name_p));
+    return;
+  }
+
+#if ENABLED (JERRY_ES2015_BUILTIN_SYMBOL)
+  /* If is_symbols_only is false and prop_name is symbol
+     we should skip the current property e.g. for-in.
+
+     Also if is_symbols_only is true and prop_name is not symbol
+     we should skip the current property e.g. Object.getOwnPropertySymbols. */
+  if (JERRY_UNLIKELY (((opts & ECMA_LIST_SYMBOLS) != 0) != ecma_prop_name_is_symbol (name_p)))
+  {
+    ecma_deref_ecma_string (name_p);
+    return;
+  }
+#endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
+
+  const size_t bitmap_row_size = sizeof (uint32_t) * JERRY_BITSINBYTE;
+  uint8_t hash = (uint8_t) ecma_string_hash (name_p);
+  uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
+  uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
+
+  if ((own_names_hashes_bitmap[bitmap_row] & (1u << bitmap_column)) != 0)
+  {
+    ecma_value_t *buffer_p = prop_names_p->buffer_p;
+
+    for (uint32_t j = 0; j < prop_names_p->item_count; j++)
+    {
+      ecma_string_t *current_name_p = ecma_get_prop_name_from_value (buffer_p[j]);
+
+      if (ecma_compare_ecma_strings (name_p, current_name_p))
+      {
+        ecma_deref_ecma_string (name_p);
+        return;
+      }
+    }
+  }
+
+  own_names_hashes_bitmap[bitmap_row] |= (1u << bitmap_column);
+
+  ecma_collection_push_back (prop_names_p, ecma_make_prop_name_value (name_p));
+} /* ecma_op_object_collect_property_name */
+
 /**
  * Get collection of property names
  *
@@ -1899,6 +1977,37 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
     }
     else
     {
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+      ecma_shape_storage_t *storage_p = ecma_shape_get_storage (prototype_chain_iter_p);
+
+      if (storage_p != NULL)
+      {
+        ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, storage_p->shape_cp);
+
+        /* The last property is visited first, like in the property lists. */
+        while (true)
+        {
+          ecma_property_t *property_p = ecma_shape_get_property (storage_p, (uint32_t) shape_p->count - 1);
+
+          ecma_op_object_collect_property_name (*property_p,
+                                                shape_p->name_cp,
+                                                opts,
+                                                prop_names_p,
+                                                skipped_non_enumerable_p,
+                                                own_names_hashes_bitmap);
+
+          if (shape_p->parent_cp == JMEM_CP_NULL)
+          {
+            break;
+          }
+
+          shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, shape_p->parent_cp);
+        }
+
+        prop_iter_cp = JMEM_CP_NULL;
+      }
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
       if (prop_iter_cp != JMEM_CP_NULL)
       {
@@ -1916,81 +2025,16 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
         ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
         JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
 
+        ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
         for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
         {
-          ecma_property_t *property_p = prop_iter_p->types + i;
-
-          if (ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
-              || ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
-          {
-            ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
-
-            if (ECMA_PROPERTY_GET_NAME_TYPE (*property_p) == ECMA_DIRECT_STRING_MAGIC
-                && prop_pair_p->names_cp[i] >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT
-                && prop_pair_p->names_cp[i] < LIT_MAGIC_STRING__COUNT)
-            {
-              /* Internal properties are never enumerated. */
-              continue;
-            }
-
-            ecma_string_t *name_p = ecma_string_from_property_name (*property_p,
-                                                                    prop_pair_p->names_cp[i]);
-
-            if (!(is_enumerable_only && !ecma_is_property_enumerable (*property_p)))
-            {
-  #if ENABLED (JERRY_ES2015_BUILTIN_SYMBOL)
-              /* If is_symbols_only is false and prop_name is symbol
-                 we should skip the current property e.g. for-in.
-
-                 Also if is_symbols_only is true and prop_name is not symbol
-                 we should skip the current property e.g. Object.getOwnPropertySymbols. */
-              if (JERRY_UNLIKELY (is_symbols_only != ecma_prop_name_is_symbol (name_p)))
-              {
-                ecma_deref_ecma_string (name_p);
-                continue;
-              }
-  #endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
-
-              uint8_t hash = (uint8_t) ecma_string_hash (name_p);
-              uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
-              uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
-
-              bool is_add = true;
-
-              if ((own_names_hashes_bitmap[bitmap_row] & (1u << bitmap_column)) != 0)
-              {
-                buffer_p = prop_names_p->buffer_p;
-
-                for (uint32_t j = 0; j < prop_names_p->item_count; j++)
-                {
-                  ecma_string_t *current_name_p = ecma_get_prop_name_from_value (buffer_p[j]);
-
-                  if (ecma_compare_ecma_strings (name_p, current_name_p))
-                  {
-                    is_add = false;
-                    break;
-                  }
-                }
-              }
-
-              if (is_add)
-              {
-                own_names_hashes_bitmap[bitmap_row] |= (1u << bitmap_column);
-
-                ecma_collection_push_back (prop_names_p, ecma_make_prop_name_value (name_p));
-              }
-              else
-              {
-                ecma_deref_ecma_string (name_p);
-              }
-            }
-            else
-            {
-              JERRY_ASSERT (is_enumerable_only && !ecma_is_property_enumerable (*property_p));
-
-              ecma_collection_push_back (skipped_non_enumerable_p, ecma_make_prop_name_value (name_p));
-            }
-          }
+          ecma_op_object_collect_property_name (prop_iter_p->types[i],
+                                                prop_pair_p->names_cp[i],
+                                                opts,
+                                                prop_names_p,
+                                                skipped_non_enumerable_p,
+                                                own_names_hashes_bitmap);
         }
 
         prop_iter_cp = prop_iter_p->next_property_cp;
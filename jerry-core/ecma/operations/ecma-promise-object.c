@@ -76,6 +76,7 @@ ecma_promise_set_result (ecma_object_t *obj_p, /**< points to promise object */
 
   JERRY_ASSERT (ext_object_p->u.class_prop.u.value == ECMA_VALUE_UNDEFINED);
 
+  ECMA_GC_WRITE_BARRIER (obj_p);
   ext_object_p->u.class_prop.u.value = result;
 } /* ecma_promise_set_result */
 
@@ -705,6 +706,7 @@ ecma_promise_do_then (ecma_value_t promise, /**< the promise which call 'then' *
   if (ecma_promise_get_state (obj_p) == ECMA_PROMISE_STATE_PENDING)
   {
     /* 7. */
+    ECMA_GC_WRITE_BARRIER (obj_p);
     ecma_collection_push_back (promise_p->fulfill_reactions, ecma_make_object_value (fulfill_reaction_p));
     ecma_collection_push_back (promise_p->reject_reactions, ecma_make_object_value (reject_reaction_p));
   }
@@ -44,11 +44,6 @@
  */
 #define RE_GLOBAL_CAPTURE 0
 
-/**
- * Check if a RegExp opcode is a capture group or not
- */
-#define RE_IS_CAPTURE_GROUP(x) (((x) < RE_OP_NON_CAPTURE_GROUP_START) ? 1 : 0)
-
 /**
  * Parse RegExp flags (global, ignoreCase, multiline)
  *
@@ -1016,6 +1011,453 @@ ecma_regexp_match (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
   }
 } /* ecma_regexp_match */
 
+/**
+ * Find the next position where a match can start
+ *
+ * @return pointer to the next possible start of a match - if found
+ *         NULL - otherwise
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_find_candidate (const re_prefilter_t *prefilter_p, /**< prefilter */
+                            const lit_utf8_byte_t *str_curr_p, /**< input string pointer */
+                            const lit_utf8_byte_t *str_end_p) /**< end of the input string */
+{
+  const size_t prefix_size = prefilter_p->prefix_size;
+
+  if (prefix_size == 0)
+  {
+    while (str_curr_p < str_end_p)
+    {
+      const lit_utf8_byte_t byte = *str_curr_p;
+
+      if (prefilter_p->first_bytes[byte >> 5] & ((uint32_t) 1 << (byte & 0x1f)))
+      {
+        return str_curr_p;
+      }
+
+      str_curr_p++;
+    }
+
+    return NULL;
+  }
+
+  /* The first byte of the prefix is never a continuation byte,
+   * so the candidates are always at character boundaries. */
+  while ((size_t) (str_end_p - str_curr_p) >= prefix_size)
+  {
+    str_curr_p = (const lit_utf8_byte_t *) memchr (str_curr_p,
+                                                   prefilter_p->prefix[0],
+                                                   (size_t) (str_end_p - str_curr_p) - prefix_size + 1);
+
+    if (str_curr_p == NULL)
+    {
+      return NULL;
+    }
+
+    if (memcmp (str_curr_p + 1, prefilter_p->prefix + 1, prefix_size - 1) == 0)
+    {
+      return str_curr_p;
+    }
+
+    str_curr_p++;
+  }
+
+  return NULL;
+} /* ecma_regexp_find_candidate */
+
+/**
+ * Flag of the stack items of the linear matcher which restore a capture slot
+ */
+#define ECMA_REGEXP_LINEAR_RESTORE_SLOT 0x80000000u
+
+/**
+ * Stack item of the linear matcher
+ */
+typedef struct
+{
+  uint32_t pc;                       /**< instruction index, or the slot index combined
+                                      *   with the ECMA_REGEXP_LINEAR_RESTORE_SLOT flag */
+  const lit_utf8_byte_t *saved_p;    /**< saved value of the capture slot */
+} ecma_regexp_linear_stack_item_t;
+
+/**
+ * Thread list of the linear matcher
+ */
+typedef struct
+{
+  uint32_t *pcs_p;                   /**< instruction indicies of the threads */
+  const lit_utf8_byte_t **slots_p;   /**< capture slots of the threads */
+  uint32_t count;                    /**< number of threads */
+} ecma_regexp_linear_list_t;
+
+/**
+ * Context of the linear matcher
+ */
+typedef struct
+{
+  ecma_regexp_ctx_t *re_ctx_p;                 /**< RegExp matcher context */
+  const re_linear_instruction_t *program_p;    /**< linear program */
+  uint32_t slot_count;                         /**< number of capture slots of a thread */
+  uint32_t generation;                         /**< generation of the current thread list */
+  uint32_t *visited_p;                         /**< last generation which reached an instruction */
+  const lit_utf8_byte_t **slots_p;             /**< capture slots of the thread being added */
+  ecma_regexp_linear_stack_item_t *stack_p;    /**< stack of the pending instructions */
+} ecma_regexp_linear_ctx_t;
+
+/**
+ * Checks whether an assertion of the linear program holds at the given position
+ *
+ * @return true - if the assertion holds
+ *         false - otherwise
+ */
+static bool
+ecma_regexp_linear_check_assertion (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                                    re_linear_opcode_t opcode, /**< assertion opcode */
+                                    const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  switch (opcode)
+  {
+    case RE_LINEAR_ASSERT_START:
+    {
+      if (str_curr_p <= re_ctx_p->input_start_p)
+      {
+        return true;
+      }
+
+      return ((re_ctx_p->flags & RE_FLAG_MULTILINE)
+              && lit_char_is_line_terminator (lit_utf8_peek_prev (str_curr_p)));
+    }
+    case RE_LINEAR_ASSERT_END:
+    {
+      if (str_curr_p >= re_ctx_p->input_end_p)
+      {
+        return true;
+      }
+
+      return ((re_ctx_p->flags & RE_FLAG_MULTILINE)
+              && lit_char_is_line_terminator (lit_utf8_peek_next (str_curr_p)));
+    }
+    default:
+    {
+      JERRY_ASSERT (opcode == RE_LINEAR_ASSERT_WORD_BOUNDARY || opcode == RE_LINEAR_ASSERT_NOT_WORD_BOUNDARY);
+
+      const bool is_wordchar_left = ((str_curr_p > re_ctx_p->input_start_p)
+                                     && lit_char_is_word_char (lit_utf8_peek_prev (str_curr_p)));
+
+      const bool is_wordchar_right = ((str_curr_p < re_ctx_p->input_end_p)
+                                      && lit_char_is_word_char (lit_utf8_peek_next (str_curr_p)));
+
+      return (is_wordchar_left != is_wordchar_right) == (opcode == RE_LINEAR_ASSERT_WORD_BOUNDARY);
+    }
+  }
+} /* ecma_regexp_linear_check_assertion */
+
+/**
+ * Checks whether a character is in a character class of the RegExp bytecode
+ *
+ * @return true - if the character is in one of the ranges
+ *         false - otherwise
+ */
+static bool
+ecma_regexp_linear_match_char_class (const uint8_t *bc_p, /**< ranges of the character class */
+                                     ecma_char_t ch) /**< canonicalized character */
+{
+  uint32_t range_count = re_get_value (&bc_p);
+
+  while (range_count-- > 0)
+  {
+    const ecma_char_t ch1 = re_get_char (&bc_p);
+    const ecma_char_t ch2 = re_get_char (&bc_p);
+
+    if (ch >= ch1 && ch <= ch2)
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* ecma_regexp_linear_match_char_class */
+
+/**
+ * Add a thread and all threads reachable from it without consuming a character to a thread list
+ *
+ * Each instruction is added at most once to a list: a thread which reaches an instruction
+ * already reached by a higher priority thread at the same position is dropped.
+ */
+static void
+ecma_regexp_linear_add_thread (ecma_regexp_linear_ctx_t *ctx_p, /**< linear matcher context */
+                               ecma_regexp_linear_list_t *list_p, /**< thread list */
+                               uint32_t pc, /**< first instruction of the thread */
+                               const lit_utf8_byte_t **slots_p, /**< capture slots of the thread */
+                               const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  const size_t slots_size = ctx_p->slot_count * sizeof (const lit_utf8_byte_t *);
+  memcpy (ctx_p->slots_p, slots_p, slots_size);
+
+  ecma_regexp_linear_stack_item_t *stack_top_p = ctx_p->stack_p;
+  stack_top_p->pc = pc;
+  stack_top_p++;
+
+  while (stack_top_p > ctx_p->stack_p)
+  {
+    stack_top_p--;
+    pc = stack_top_p->pc;
+
+    if (pc & ECMA_REGEXP_LINEAR_RESTORE_SLOT)
+    {
+      ctx_p->slots_p[pc & ~ECMA_REGEXP_LINEAR_RESTORE_SLOT] = stack_top_p->saved_p;
+      continue;
+    }
+
+    if (ctx_p->visited_p[pc] == ctx_p->generation)
+    {
+      continue;
+    }
+
+    ctx_p->visited_p[pc] = ctx_p->generation;
+
+    const re_linear_instruction_t *instruction_p = ctx_p->program_p + pc;
+    const re_linear_opcode_t opcode = (re_linear_opcode_t) instruction_p->opcode;
+
+    switch (opcode)
+    {
+      case RE_LINEAR_JUMP:
+      {
+        stack_top_p->pc = instruction_p->target;
+        stack_top_p++;
+        break;
+      }
+      case RE_LINEAR_SPLIT:
+      case RE_LINEAR_SPLIT_LAZY:
+      {
+        /* The preferred branch is processed first. */
+        const bool is_greedy = (opcode == RE_LINEAR_SPLIT);
+        stack_top_p[0].pc = is_greedy ? instruction_p->target : pc + 1;
+        stack_top_p[1].pc = is_greedy ? pc + 1 : instruction_p->target;
+        stack_top_p += 2;
+        break;
+      }
+      case RE_LINEAR_SAVE:
+      {
+        stack_top_p[0].pc = instruction_p->argument | ECMA_REGEXP_LINEAR_RESTORE_SLOT;
+        stack_top_p[0].saved_p = ctx_p->slots_p[instruction_p->argument];
+        stack_top_p[1].pc = pc + 1;
+        stack_top_p += 2;
+
+        ctx_p->slots_p[instruction_p->argument] = str_curr_p;
+        break;
+      }
+      case RE_LINEAR_ASSERT_START:
+      case RE_LINEAR_ASSERT_END:
+      case RE_LINEAR_ASSERT_WORD_BOUNDARY:
+      case RE_LINEAR_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        if (ecma_regexp_linear_check_assertion (ctx_p->re_ctx_p, opcode, str_curr_p))
+        {
+          stack_top_p->pc = pc + 1;
+          stack_top_p++;
+        }
+        break;
+      }
+      default:
+      {
+        JERRY_ASSERT (opcode <= RE_LINEAR_MATCH);
+
+        list_p->pcs_p[list_p->count] = pc;
+        memcpy (list_p->slots_p + list_p->count * ctx_p->slot_count, ctx_p->slots_p, slots_size);
+        list_p->count++;
+        break;
+      }
+    }
+  }
+} /* ecma_regexp_linear_add_thread */
+
+/**
+ * Backtracking free RegExp matching
+ *
+ * All threads of the linear program are advanced in parallel over the input, ordered by
+ * their priority, so the first match found is the same as the match of the backtracking
+ * matcher. The running time is proportional to the length of the input multiplied by
+ * the length of the program.
+ *
+ * @return end of the match - if matched (the captures are filled)
+ *         NULL - otherwise
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_linear_match (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                          const re_compiled_code_t *bc_p, /**< RegExp bytecode */
+                          const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  const uint8_t *bytecode_start_p = (const uint8_t *) bc_p;
+  const uint32_t length = bc_p->linear_length;
+  const uint32_t slot_count = re_ctx_p->captures_count * 2;
+  const size_t slots_size = slot_count * sizeof (const lit_utf8_byte_t *);
+
+  /* Stack, thread lists, the slots of the added and the matched thread and the visited marks. */
+  const size_t buffer_size = ((2 * length + 1) * sizeof (ecma_regexp_linear_stack_item_t)
+                              + 2 * length * (slots_size + sizeof (uint32_t))
+                              + 2 * slots_size
+                              + length * sizeof (uint32_t));
+  uint8_t *buffer_p = (uint8_t *) jmem_heap_alloc_block (buffer_size);
+
+  ecma_regexp_linear_ctx_t ctx;
+  ecma_regexp_linear_list_t lists[2];
+
+  ctx.re_ctx_p = re_ctx_p;
+  ctx.program_p = (const re_linear_instruction_t *) (bytecode_start_p + bc_p->linear_offset);
+  ctx.slot_count = slot_count;
+  ctx.generation = 1;
+  ctx.stack_p = (ecma_regexp_linear_stack_item_t *) buffer_p;
+
+  uint8_t *next_p = buffer_p + (2 * length + 1) * sizeof (ecma_regexp_linear_stack_item_t);
+
+  for (uint32_t i = 0; i < 2; i++)
+  {
+    lists[i].slots_p = (const lit_utf8_byte_t **) next_p;
+    next_p += length * slots_size;
+    lists[i].count = 0;
+  }
+
+  ctx.slots_p = (const lit_utf8_byte_t **) next_p;
+  next_p += slots_size;
+
+  const lit_utf8_byte_t **matched_slots_p = (const lit_utf8_byte_t **) next_p;
+  next_p += slots_size;
+
+  for (uint32_t i = 0; i < 2; i++)
+  {
+    lists[i].pcs_p = (uint32_t *) next_p;
+    next_p += length * sizeof (uint32_t);
+  }
+
+  ctx.visited_p = (uint32_t *) next_p;
+  memset (ctx.visited_p, 0, length * sizeof (uint32_t));
+
+  ecma_regexp_linear_list_t *curr_list_p = lists + 0;
+  ecma_regexp_linear_list_t *next_list_p = lists + 1;
+  const lit_utf8_byte_t *matched_p = NULL;
+  const bool is_ignorecase = re_ctx_p->flags & RE_FLAG_IGNORE_CASE;
+  const re_prefilter_t *prefilter_p = NULL;
+
+  if (bc_p->prefilter_offset != 0)
+  {
+    prefilter_p = (const re_prefilter_t *) (bytecode_start_p + bc_p->prefilter_offset);
+  }
+
+  while (true)
+  {
+    if (matched_p == NULL)
+    {
+      if (curr_list_p->count == 0 && prefilter_p != NULL)
+      {
+        /* No active threads: skip the positions where a match cannot start. */
+        str_curr_p = ecma_regexp_find_candidate (prefilter_p, str_curr_p, re_ctx_p->input_end_p);
+
+        if (str_curr_p == NULL)
+        {
+          break;
+        }
+      }
+
+      /* Start a new match attempt at the current position with the lowest priority. */
+      memset (matched_slots_p, 0, slots_size);
+      ecma_regexp_linear_add_thread (&ctx, curr_list_p, 0, matched_slots_p, str_curr_p);
+    }
+
+    if (curr_list_p->count == 0 && matched_p != NULL)
+    {
+      break;
+    }
+
+    const bool has_char = (str_curr_p < re_ctx_p->input_end_p);
+    const lit_utf8_byte_t *str_next_p = str_curr_p;
+    ecma_char_t ch = 0;
+    ecma_char_t canonical_ch = 0;
+
+    if (has_char)
+    {
+      ch = lit_utf8_read_next (&str_next_p);
+      canonical_ch = ecma_regexp_canonicalize (ch, is_ignorecase);
+    }
+
+    ctx.generation++;
+    next_list_p->count = 0;
+
+    for (uint32_t i = 0; i < curr_list_p->count; i++)
+    {
+      const re_linear_instruction_t *instruction_p = ctx.program_p + curr_list_p->pcs_p[i];
+      const lit_utf8_byte_t **slots_p = curr_list_p->slots_p + i * slot_count;
+
+      if (instruction_p->opcode == RE_LINEAR_MATCH)
+      {
+        /* The remaining threads have lower priority. */
+        JERRY_TRACE_MSG ("Execute RE_LINEAR_MATCH: match\n");
+        matched_p = str_curr_p;
+        memcpy (matched_slots_p, slots_p, slots_size);
+        break;
+      }
+
+      if (!has_char)
+      {
+        continue;
+      }
+
+      bool is_match;
+
+      switch (instruction_p->opcode)
+      {
+        case RE_LINEAR_CHAR:
+        {
+          is_match = (instruction_p->argument == canonical_ch);
+          break;
+        }
+        case RE_LINEAR_PERIOD:
+        {
+          is_match = !lit_char_is_line_terminator (ch);
+          break;
+        }
+        default:
+        {
+          JERRY_ASSERT (instruction_p->opcode == RE_LINEAR_CHAR_CLASS
+                        || instruction_p->opcode == RE_LINEAR_INV_CHAR_CLASS);
+
+          is_match = ecma_regexp_linear_match_char_class (bytecode_start_p + instruction_p->target, canonical_ch);
+          is_match = (is_match == (instruction_p->opcode == RE_LINEAR_CHAR_CLASS));
+          break;
+        }
+      }
+
+      if (is_match)
+      {
+        ecma_regexp_linear_add_thread (&ctx, next_list_p, curr_list_p->pcs_p[i] + 1, slots_p, str_next_p);
+      }
+    }
+
+    ecma_regexp_linear_list_t *list_p = curr_list_p;
+    curr_list_p = next_list_p;
+    next_list_p = list_p;
+
+    if (!has_char)
+    {
+      break;
+    }
+
+    str_curr_p = str_next_p;
+  }
+
+  if (matched_p != NULL)
+  {
+    for (uint32_t i = 0; i < re_ctx_p->captures_count; i++)
+    {
+      re_ctx_p->captures_p[i].begin_p = matched_slots_p[2 * i];
+      re_ctx_p->captures_p[i].end_p = matched_slots_p[2 * i + 1];
+    }
+  }
+
+  jmem_heap_free_block (buffer_p, buffer_size);
+  return matched_p;
+} /* ecma_regexp_linear_match */
+
 static ecma_value_t
 ecma_regexp_create_result_object (ecma_regexp_ctx_t *re_ctx_p,
                                   ecma_string_t *input_string_p,
@@ -1205,55 +1647,111 @@ ecma_regexp_exec_helper (ecma_value_t regexp_value, /**< RegExp object */
   memset (re_ctx.captures_p, 0, re_ctx.captures_count * sizeof (ecma_regexp_capture_t));
 
   re_ctx.non_captures_count = bc_p->non_captures_count;
-  re_ctx.non_captures_p = jmem_heap_alloc_block (re_ctx.non_captures_count * sizeof (ecma_regexp_non_capture_t));
-  memset (re_ctx.non_captures_p, 0, re_ctx.non_captures_count * sizeof (ecma_regexp_non_capture_t));
+  re_ctx.non_captures_p = NULL;
+  re_ctx.iterations_p = NULL;
 
   const uint32_t iters_length = re_ctx.captures_count + re_ctx.non_captures_count - 1;
-  re_ctx.iterations_p = jmem_heap_alloc_block (iters_length * sizeof (uint32_t));
-  memset (re_ctx.iterations_p, 0, iters_length * sizeof (uint32_t));
-
-  /* 2. Try to match */
-  uint8_t *bc_start_p = (uint8_t *) (bc_p + 1);
   const lit_utf8_byte_t *matched_p = NULL;
 
   JERRY_ASSERT (index <= input_length);
-  while (true)
+
+  /* 2. Try to match */
+  if (bc_p->linear_length > 0)
   {
-    matched_p = ecma_regexp_match (&re_ctx, bc_start_p, input_curr_p);
+    matched_p = ecma_regexp_linear_match (&re_ctx, bc_p, input_curr_p);
 
     if (matched_p != NULL)
     {
-      break;
+      const lit_utf8_byte_t *match_begin_p = re_ctx.captures_p[0].begin_p;
+
+      if (input_flags & ECMA_STRING_FLAG_IS_ASCII)
+      {
+        index += (uint32_t) (match_begin_p - input_curr_p);
+      }
+      else
+      {
+        index += lit_utf8_string_length (input_curr_p, (lit_utf8_size_t) (match_begin_p - input_curr_p));
+      }
     }
+  }
+  else
+  {
+    re_ctx.non_captures_p = jmem_heap_alloc_block (re_ctx.non_captures_count * sizeof (ecma_regexp_non_capture_t));
+    memset (re_ctx.non_captures_p, 0, re_ctx.non_captures_count * sizeof (ecma_regexp_non_capture_t));
 
-    index++;
-    if (index > input_length)
+    re_ctx.iterations_p = jmem_heap_alloc_block (iters_length * sizeof (uint32_t));
+    memset (re_ctx.iterations_p, 0, iters_length * sizeof (uint32_t));
+
+    uint8_t *bc_start_p = (uint8_t *) (bc_p + 1);
+    const re_prefilter_t *prefilter_p = NULL;
+
+    if (bc_p->prefilter_offset != 0)
+    {
+      prefilter_p = (const re_prefilter_t *) (((const uint8_t *) bc_p) + bc_p->prefilter_offset);
+    }
+
+    while (true)
     {
-      if (re_ctx.flags & RE_FLAG_GLOBAL)
+      if (prefilter_p != NULL)
       {
-        ecma_value_t put_result = ecma_op_object_put (regexp_object_p,
-                                                      ecma_get_magic_string (LIT_MAGIC_STRING_LASTINDEX_UL),
-                                                      ecma_make_uint32_value (0),
-                                                      true);
-        if (ECMA_IS_VALUE_ERROR (put_result))
+        const lit_utf8_byte_t *candidate_p = ecma_regexp_find_candidate (prefilter_p, input_curr_p, input_end_p);
+
+        if (candidate_p == NULL)
+        {
+          break;
+        }
+
+        if (input_flags & ECMA_STRING_FLAG_IS_ASCII)
         {
-          ret_value = put_result;
-          goto cleanup_context;
+          index += (uint32_t) (candidate_p - input_curr_p);
+        }
+        else
+        {
+          index += lit_utf8_string_length (input_curr_p, (lit_utf8_size_t) (candidate_p - input_curr_p));
         }
 
-        JERRY_ASSERT (ecma_is_value_boolean (put_result));
+        input_curr_p = candidate_p;
       }
 
-      /* Failed to match, return 'null'. */
-      ret_value = ECMA_VALUE_NULL;
-      goto cleanup_context;
-    }
+      matched_p = ecma_regexp_match (&re_ctx, bc_start_p, input_curr_p);
 
-    JERRY_ASSERT (input_curr_p < input_end_p);
-    lit_utf8_incr (&input_curr_p);
+      if (matched_p != NULL)
+      {
+        break;
+      }
+
+      index++;
+      if (index > input_length)
+      {
+        break;
+      }
+
+      JERRY_ASSERT (input_curr_p < input_end_p);
+      lit_utf8_incr (&input_curr_p);
+    }
   }
 
-  JERRY_ASSERT (matched_p != NULL);
+  if (matched_p == NULL)
+  {
+    if (re_ctx.flags & RE_FLAG_GLOBAL)
+    {
+      ecma_value_t put_result = ecma_op_object_put (regexp_object_p,
+                                                    ecma_get_magic_string (LIT_MAGIC_STRING_LASTINDEX_UL),
+                                                    ecma_make_uint32_value (0),
+                                                    true);
+      if (ECMA_IS_VALUE_ERROR (put_result))
+      {
+        ret_value = put_result;
+        goto cleanup_context;
+      }
+
+      JERRY_ASSERT (ecma_is_value_boolean (put_result));
+    }
+
+    /* Failed to match, return 'null'. */
+    ret_value = ECMA_VALUE_NULL;
+    goto cleanup_context;
+  }
 
   if (ECMA_RE_STACK_LIMIT_REACHED (matched_p))
   {
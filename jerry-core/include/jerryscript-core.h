@@ -108,7 +108,10 @@ typedef enum
 typedef enum
 {
   JERRY_PARSE_NO_OPTS = 0, /**< no options passed */
-  JERRY_PARSE_STRICT_MODE = (1 << 0) /**< enable strict mode */
+  JERRY_PARSE_STRICT_MODE = (1 << 0), /**< enable strict mode */
+  JERRY_PARSE_LAZY_FUNCTIONS = (1 << 1), /**< compile the nested functions when they are called first */
+  JERRY_PARSE_STATIC_SOURCE = (1 << 2) /**< the source code is kept alive and unchanged by the
+                                        *   application, so lazily compiled functions do not copy it */
 } jerry_parse_opts_t;
 
 /**
@@ -150,7 +153,11 @@ typedef uint32_t jerry_length_t;
 /**
  * Description of a JerryScript value.
  */
+#if defined (JERRY_VALUE_NAN_BOXING) && (JERRY_VALUE_NAN_BOXING == 1)
+typedef uint64_t jerry_value_t;
+#else /* !defined (JERRY_VALUE_NAN_BOXING) || (JERRY_VALUE_NAN_BOXING != 1) */
 typedef uint32_t jerry_value_t;
+#endif /* defined (JERRY_VALUE_NAN_BOXING) && (JERRY_VALUE_NAN_BOXING == 1) */
 
 /**
  * Description of ECMA property descriptor.
@@ -207,6 +214,17 @@ typedef struct
   size_t reserved[4]; /**< padding for future extensions */
 } jerry_heap_stats_t;
 
+/**
+ * Description of the RegExp byte code cache stats.
+ */
+typedef struct
+{
+  uint32_t size; /**< number of cache entries */
+  uint32_t used_entries; /**< number of entries holding a compiled byte code */
+  uint32_t hits; /**< number of RegExp compilations served from the cache */
+  uint32_t misses; /**< number of RegExp compilations not found in the cache */
+} jerry_regexp_cache_stats_t;
+
 /**
  * Type of an external function handler.
  */
@@ -338,9 +356,11 @@ void jerry_register_magic_strings (const jerry_char_t * const *ex_str_items_p,
                                    uint32_t count,
                                    const jerry_length_t *str_lengths_p);
 void jerry_gc (jerry_gc_mode_t mode);
+bool jerry_gc_step (uint32_t budget);
 void *jerry_get_context_data (const jerry_context_data_manager_t *manager_p);
 
 bool jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p);
+bool jerry_get_regexp_cache_stats (jerry_regexp_cache_stats_t *out_stats_p);
 
 /**
  * Parser and executor functions.
@@ -74,6 +74,23 @@
  */
 #define CONFIG_ECMA_GC_NEW_OBJECTS_FRACTION (16)
 
+/**
+ * Number of objects which can be stored on the mark stack of the garbage collector.
+ *
+ * The mark stack is allocated on the C stack while the garbage collector is running. When it
+ * overflows, the collector falls back to rescanning the list of unmarked objects, so this value
+ * only affects the speed of marking, not its correctness.
+ */
+#define CONFIG_ECMA_GC_MARK_STACK_SIZE (128)
+
+#if ENABLED (JERRY_GC_INCREMENTAL)
+/**
+ * Number of objects processed by an incremental garbage collector step
+ * performed at a backward jump of the interpreter.
+ */
+#define CONFIG_ECMA_GC_INCREMENTAL_STEP (256)
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+
 #if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
 /**
  * Heap structure
@@ -130,18 +147,24 @@ struct jerry_context_t
 #endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
   jmem_cpointer_t ecma_gc_objects_cp; /**< List of currently alive objects. */
   jmem_heap_free_t *jmem_heap_list_skip_p; /**< This is used to speed up deallocation. */
+#if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  uint32_t jmem_heap_bins[JMEM_HEAP_BIN_COUNT]; /**< offsets of the first regions of the free bins */
+#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
   jmem_pools_chunk_t *jmem_free_8_byte_chunk_p; /**< list of free eight byte pool chunks */
-#if ENABLED (JERRY_CPOINTER_32_BIT)
+#if ENABLED (JMEM_POOLS_16_BYTE_CHUNKS)
   jmem_pools_chunk_t *jmem_free_16_byte_chunk_p; /**< list of free sixteen byte pool chunks */
-#endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+#endif /* ENABLED (JMEM_POOLS_16_BYTE_CHUNKS) */
   const lit_utf8_byte_t * const *lit_magic_string_ex_array; /**< array of external magic strings */
   const lit_utf8_size_t *lit_magic_string_ex_sizes; /**< external magic string lengths */
-  jmem_cpointer_t string_list_first_cp; /**< first item of the literal string list */
+  ecma_lit_storage_index_t string_literal_index; /**< hash index of literal strings */
+  ecma_lit_storage_index_t number_literal_index; /**< hash index of literal numbers */
 #if ENABLED (JERRY_ES2015_BUILTIN_SYMBOL)
   jmem_cpointer_t symbol_list_first_cp; /**< first item of the global symbol list */
 #endif /* ENABLED (JERRY_ES2015_BUILTIN_SYMBOL) */
-  jmem_cpointer_t number_list_first_cp; /**< first item of the literal number list */
   jmem_cpointer_t ecma_global_lex_env_cp; /**< global lexical environment */
+#if ENABLED (JERRY_PROPERTY_SHAPES)
+  jmem_cpointer_t ecma_shape_first_root_cp; /**< first shape of the objects with a single property */
+#endif /* ENABLED (JERRY_PROPERTY_SHAPES) */
 
 #if ENABLED (JERRY_ES2015_MODULE_SYSTEM)
   ecma_module_t *ecma_modules_p; /**< list of referenced modules */
@@ -152,6 +175,14 @@ struct jerry_context_t
   jerry_context_data_header_t *context_data_p; /**< linked list of user-provided context-specific pointers */
   size_t ecma_gc_objects_number; /**< number of currently allocated objects */
   size_t ecma_gc_new_objects; /**< number of newly allocated objects since last GC session */
+  jmem_cpointer_t *ecma_gc_mark_stack_p; /**< mark stack of the currently running GC session */
+  uint32_t ecma_gc_mark_stack_top; /**< number of objects stored on the mark stack */
+#if ENABLED (JERRY_GC_INCREMENTAL)
+  jmem_cpointer_t ecma_gc_iter_cp; /**< next object of the incremental GC cycle: the next root candidate
+                                    *   during marking or the next unswept object during sweeping */
+  uint8_t ecma_gc_phase; /**< current phase of the incremental GC cycle (ecma_gc_phase_t) */
+  jmem_cpointer_t ecma_gc_mark_stack[CONFIG_ECMA_GC_MARK_STACK_SIZE]; /**< mark stack of the incremental GC */
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
   size_t jmem_heap_allocated_size; /**< size of allocated regions */
   size_t jmem_heap_limit; /**< current limit of heap usage, that is upon being reached,
                            *   causes call of "try give memory back" callbacks */
@@ -166,7 +197,10 @@ struct jerry_context_t
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
 #if ENABLED (JERRY_BUILTIN_REGEXP)
-  uint8_t re_cache_idx; /**< evicted item index when regex cache is full (round-robin) */
+  uint32_t re_cache_time; /**< incremented on each regex cache access */
+  uint32_t re_cache_hits; /**< number of regex cache hits */
+  uint32_t re_cache_misses; /**< number of regex cache misses */
+  uint32_t re_cache_last_use[RE_CACHE_SIZE]; /**< access time of regex cache entries (LRU eviction) */
 #endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
 
 #if ENABLED (JERRY_ES2015_BUILTIN_PROMISE)
@@ -216,6 +250,14 @@ struct jerry_context_t
   /** hash table for caching the last access of properties */
   ecma_lcache_hash_entry_t lcache[ECMA_LCACHE_HASH_ROWS_COUNT][ECMA_LCACHE_HASH_ROW_LENGTH];
 #endif /* ENABLED (JERRY_LCACHE) */
+
+#if ENABLED (JERRY_ICACHE)
+  uint32_t icache_epoch; /**< incremented when a property is freed, older icache entries are invalid */
+  /** per access site cache of named property lookups */
+  ecma_icache_entry_t icache[ECMA_ICACHE_ROWS_COUNT][ECMA_ICACHE_ROW_LENGTH];
+  /** per access site cache of identifier resolutions */
+  ecma_icache_binding_entry_t icache_bindings[ECMA_ICACHE_BINDING_ROWS_COUNT][ECMA_ICACHE_ROW_LENGTH];
+#endif /* ENABLED (JERRY_ICACHE) */
 };
 
 
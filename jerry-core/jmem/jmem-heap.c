@@ -39,6 +39,23 @@
  */
 #define JMEM_HEAP_END_OF_LIST ((uint32_t) 0xffffffff)
 
+/**
+ * Maximum size of a region which is stored in a free bin.
+ */
+#define JMEM_HEAP_BIN_MAX_SIZE ((JMEM_HEAP_BIN_COUNT + 1) * JMEM_ALIGNMENT)
+
+/**
+ * Checks whether a region of the given (aligned) size is stored in a free bin.
+ *
+ * Note: eight byte regions are cached by the pool manager instead
+ */
+#define JMEM_HEAP_IS_BIN_SIZE(size) ((size) > JMEM_ALIGNMENT && (size) <= JMEM_HEAP_BIN_MAX_SIZE)
+
+/**
+ * Get the index of the free bin which stores the regions of the given (aligned) size.
+ */
+#define JMEM_HEAP_GET_BIN_INDEX(size) (((size) >> JMEM_ALIGNMENT_LOG) - 2)
+
 /**
  * @{
  */
@@ -91,6 +108,11 @@ jmem_heap_init (void)
 
   JERRY_CONTEXT (jmem_heap_list_skip_p) = &JERRY_HEAP_CONTEXT (first);
 
+  for (uint32_t i = 0; i < JMEM_HEAP_BIN_COUNT; i++)
+  {
+    JERRY_CONTEXT (jmem_heap_bins)[i] = JMEM_HEAP_END_OF_LIST;
+  }
+
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
   JMEM_VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), JMEM_HEAP_AREA_SIZE);
 
@@ -127,6 +149,33 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
   const size_t required_size = ((size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT) * JMEM_ALIGNMENT;
   jmem_heap_free_t *data_space_p = NULL;
 
+  /* Fast path for small regions, any region of the corresponding bin is an exact fit. */
+  if (JMEM_HEAP_IS_BIN_SIZE (required_size))
+  {
+    uint32_t *bin_p = JERRY_CONTEXT (jmem_heap_bins) + JMEM_HEAP_GET_BIN_INDEX (required_size);
+
+    if (*bin_p != JMEM_HEAP_END_OF_LIST)
+    {
+      data_space_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (*bin_p);
+      JERRY_ASSERT (jmem_is_heap_pointer (data_space_p));
+
+      JMEM_VALGRIND_DEFINED_SPACE (data_space_p, sizeof (jmem_heap_free_t));
+      JERRY_ASSERT (data_space_p->size == required_size);
+      *bin_p = data_space_p->next_offset;
+      JMEM_VALGRIND_NOACCESS_SPACE (data_space_p, sizeof (jmem_heap_free_t));
+
+      JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
+
+      while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+      {
+        JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
+      }
+
+      JMEM_VALGRIND_MALLOCLIKE_SPACE (data_space_p, size);
+      return (void *) data_space_p;
+    }
+  }
+
   JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
 
   /* Fast path for 8 byte chunks, first region is guaranteed to be sufficient. */
@@ -239,6 +288,12 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
 
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
 
+  /* The free bins might contain neighbouring regions, which form a sufficiently large region. */
+  if (JERRY_UNLIKELY (data_space_p == NULL) && jmem_heap_collect_bins ())
+  {
+    return jmem_heap_alloc (size);
+  }
+
   JERRY_ASSERT ((uintptr_t) data_space_p % JMEM_ALIGNMENT == 0);
   JMEM_VALGRIND_MALLOCLIKE_SPACE (data_space_p, size);
 
@@ -446,6 +501,42 @@ jmem_heap_insert_block (jmem_heap_free_t *block_p, /**< block to insert */
 } /* jmem_heap_insert_block */
 #endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
 
+/**
+ * Move the regions of the free bins back to the free region list, merging them with their neighbours.
+ *
+ * @return true - if any region was moved,
+ *         false - otherwise
+ */
+bool
+jmem_heap_collect_bins (void)
+{
+  bool is_collected = false;
+
+#if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+  for (uint32_t i = 0; i < JMEM_HEAP_BIN_COUNT; i++)
+  {
+    uint32_t block_offset = JERRY_CONTEXT (jmem_heap_bins)[i];
+    JERRY_CONTEXT (jmem_heap_bins)[i] = JMEM_HEAP_END_OF_LIST;
+
+    while (block_offset != JMEM_HEAP_END_OF_LIST)
+    {
+      jmem_heap_free_t *const block_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (block_offset);
+      JERRY_ASSERT (jmem_is_heap_pointer (block_p));
+
+      JMEM_VALGRIND_DEFINED_SPACE (block_p, sizeof (jmem_heap_free_t));
+      const uint32_t block_size = block_p->size;
+      block_offset = block_p->next_offset;
+      JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
+
+      jmem_heap_insert_block (block_p, jmem_heap_find_prev (block_p), block_size);
+      is_collected = true;
+    }
+  }
+#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+
+  return is_collected;
+} /* jmem_heap_collect_bins */
+
 /**
  * Internal method for freeing a memory block.
  */
@@ -465,8 +556,25 @@ jmem_heap_free_block_internal (void *ptr, /**< pointer to beginning of data spac
   const size_t aligned_size = (size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT * JMEM_ALIGNMENT;
 
   jmem_heap_free_t *const block_p = (jmem_heap_free_t *) ptr;
-  jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
-  jmem_heap_insert_block (block_p, prev_p, aligned_size);
+
+  if (JMEM_HEAP_IS_BIN_SIZE (aligned_size))
+  {
+    /* Small regions are merged with their neighbours only when the bins are collected. */
+    uint32_t *bin_p = JERRY_CONTEXT (jmem_heap_bins) + JMEM_HEAP_GET_BIN_INDEX (aligned_size);
+
+    JMEM_VALGRIND_NOACCESS_SPACE (block_p, aligned_size);
+    JMEM_VALGRIND_DEFINED_SPACE (block_p, sizeof (jmem_heap_free_t));
+    block_p->size = (uint32_t) aligned_size;
+    block_p->next_offset = *bin_p;
+    JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
+
+    *bin_p = JMEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+  }
+  else
+  {
+    jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
+    jmem_heap_insert_block (block_p, prev_p, aligned_size);
+  }
 
   JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_size;
 
@@ -44,9 +44,9 @@ jmem_pools_finalize (void)
   jmem_pools_collect_empty ();
 
   JERRY_ASSERT (JERRY_CONTEXT (jmem_free_8_byte_chunk_p) == NULL);
-#if ENABLED (JERRY_CPOINTER_32_BIT)
+#if ENABLED (JMEM_POOLS_16_BYTE_CHUNKS)
   JERRY_ASSERT (JERRY_CONTEXT (jmem_free_16_byte_chunk_p) == NULL);
-#endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+#endif /* ENABLED (JMEM_POOLS_16_BYTE_CHUNKS) */
 } /* jmem_pools_finalize */
 
 /**
@@ -62,12 +62,12 @@ jmem_pools_alloc (size_t size) /**< size of the chunk */
   ecma_free_unused_memory (JMEM_PRESSURE_LOW);
 #endif /* ENABLED (JERRY_MEM_GC_BEFORE_EACH_ALLOC) */
 
-#if ENABLED (JERRY_CPOINTER_32_BIT)
+#if ENABLED (JMEM_POOLS_16_BYTE_CHUNKS)
   if (size <= 8)
   {
-#else /* !ENABLED (JERRY_CPOINTER_32_BIT) */
+#else /* !ENABLED (JMEM_POOLS_16_BYTE_CHUNKS) */
     JERRY_ASSERT (size <= 8);
-#endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+#endif /* ENABLED (JMEM_POOLS_16_BYTE_CHUNKS) */
 
     if (JERRY_CONTEXT (jmem_free_8_byte_chunk_p) != NULL)
     {
@@ -87,7 +87,7 @@ jmem_pools_alloc (size_t size) /**< size of the chunk */
       return chunk_p;
     }
 
-#if ENABLED (JERRY_CPOINTER_32_BIT)
+#if ENABLED (JMEM_POOLS_16_BYTE_CHUNKS)
   }
 
   JERRY_ASSERT (size <= 16);
@@ -109,7 +109,7 @@ jmem_pools_alloc (size_t size) /**< size of the chunk */
     JMEM_HEAP_STAT_ALLOC (16);
     return chunk_p;
   }
-#endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+#endif /* ENABLED (JMEM_POOLS_16_BYTE_CHUNKS) */
 } /* jmem_pools_alloc */
 
 /**
@@ -126,17 +126,17 @@ jmem_pools_free (void *chunk_p, /**< pointer to the chunk */
 
   JMEM_VALGRIND_DEFINED_SPACE (chunk_to_free_p, size);
 
-#if ENABLED (JERRY_CPOINTER_32_BIT)
+#if ENABLED (JMEM_POOLS_16_BYTE_CHUNKS)
   if (size <= 8)
   {
-#else /* !ENABLED (JERRY_CPOINTER_32_BIT) */
+#else /* !ENABLED (JMEM_POOLS_16_BYTE_CHUNKS) */
     JERRY_ASSERT (size <= 8);
-#endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+#endif /* ENABLED (JMEM_POOLS_16_BYTE_CHUNKS) */
 
     chunk_to_free_p->next_p = JERRY_CONTEXT (jmem_free_8_byte_chunk_p);
     JERRY_CONTEXT (jmem_free_8_byte_chunk_p) = chunk_to_free_p;
 
-#if ENABLED (JERRY_CPOINTER_32_BIT)
+#if ENABLED (JMEM_POOLS_16_BYTE_CHUNKS)
   }
   else
   {
@@ -145,7 +145,7 @@ jmem_pools_free (void *chunk_p, /**< pointer to the chunk */
     chunk_to_free_p->next_p = JERRY_CONTEXT (jmem_free_16_byte_chunk_p);
     JERRY_CONTEXT (jmem_free_16_byte_chunk_p) = chunk_to_free_p;
   }
-#endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+#endif /* ENABLED (JMEM_POOLS_16_BYTE_CHUNKS) */
 
   JMEM_VALGRIND_NOACCESS_SPACE (chunk_to_free_p, size);
 } /* jmem_pools_free */
@@ -169,7 +169,7 @@ jmem_pools_collect_empty (void)
     chunk_p = next_p;
   }
 
-#if ENABLED (JERRY_CPOINTER_32_BIT)
+#if ENABLED (JMEM_POOLS_16_BYTE_CHUNKS)
   chunk_p = JERRY_CONTEXT (jmem_free_16_byte_chunk_p);
   JERRY_CONTEXT (jmem_free_16_byte_chunk_p) = NULL;
 
@@ -182,7 +182,7 @@ jmem_pools_collect_empty (void)
     jmem_heap_free_block_internal (chunk_p, 16);
     chunk_p = next_p;
   }
-#endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+#endif /* ENABLED (JMEM_POOLS_16_BYTE_CHUNKS) */
 } /* jmem_pools_collect_empty */
 
 /**
@@ -69,6 +69,15 @@ typedef uint32_t jmem_cpointer_t;
 typedef uint16_t jmem_cpointer_t;
 #endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
 
+/**
+ * Sixteen byte pool chunks are needed by 32 bit compressed pointers and 64 bit ecma values.
+ */
+#if ENABLED (JERRY_CPOINTER_32_BIT) || ENABLED (JERRY_VALUE_NAN_BOXING)
+# define JMEM_POOLS_16_BYTE_CHUNKS 1
+#else /* !ENABLED (JERRY_CPOINTER_32_BIT) && !ENABLED (JERRY_VALUE_NAN_BOXING) */
+# define JMEM_POOLS_16_BYTE_CHUNKS 0
+#endif /* ENABLED (JERRY_CPOINTER_32_BIT) || ENABLED (JERRY_VALUE_NAN_BOXING) */
+
 /**
  * Memory usage pressure for reclaiming unused memory.
  *
@@ -103,6 +112,15 @@ typedef struct
   uint32_t size; /**< Size of region */
 } jmem_heap_free_t;
 
+/**
+ * Number of free bins of the heap.
+ *
+ * Freed regions from 2 * JMEM_ALIGNMENT up to (JMEM_HEAP_BIN_COUNT + 1) * JMEM_ALIGNMENT
+ * bytes are kept in a separate list for each size, and they are merged with
+ * their neighbours only when the heap runs out of sufficiently large regions.
+ */
+#define JMEM_HEAP_BIN_COUNT 8
+
 void jmem_init (void);
 void jmem_finalize (void);
 
@@ -110,6 +128,7 @@ void *jmem_heap_alloc_block (const size_t size);
 void *jmem_heap_alloc_block_null_on_error (const size_t size);
 void *jmem_heap_realloc_block (void *ptr, const size_t old_size, const size_t new_size);
 void jmem_heap_free_block (void *ptr, const size_t size);
+bool jmem_heap_collect_bins (void);
 
 #if ENABLED (JERRY_MEM_STATS)
 /**
@@ -118,6 +118,20 @@
 
 #define CBC_UNARY_LVALUE_WITH_IDENT 3
 
+/**
+ * Arithmetic operations whose result is assigned to an identifier.
+ * The destination literal follows the literal arguments of the
+ * operation, and the byte argument holds the operation (see
+ * CBC_ARITHMETIC_SET_IDENT_GET_OPCODE).
+ */
+#define CBC_ARITHMETIC_SET_IDENT_OPERATION(name, arg_flags, stack, vm_oc) \
+  CBC_OPCODE (name, (arg_flags) | CBC_HAS_BYTE_ARG, stack, \
+              VM_OC_ARITHMETIC_SET_IDENT | (vm_oc) | VM_OC_PUT_IDENT) \
+  CBC_OPCODE (name ## _PUSH_RESULT, (arg_flags) | CBC_HAS_BYTE_ARG, (stack) + 1, \
+              VM_OC_ARITHMETIC_SET_IDENT | (vm_oc) | VM_OC_PUT_IDENT | VM_OC_PUT_STACK) \
+  CBC_OPCODE (name ## _BLOCK, (arg_flags) | CBC_HAS_BYTE_ARG, stack, \
+              VM_OC_ARITHMETIC_SET_IDENT | (vm_oc) | VM_OC_PUT_IDENT | VM_OC_PUT_BLOCK)
+
 #define CBC_BINARY_WITH_LITERAL 1
 #define CBC_BINARY_WITH_TWO_LITERALS 2
 
@@ -177,6 +191,97 @@
   CBC_OPCODE (name ## _3, CBC_HAS_BRANCH_ARG, stack, \
               (vm_oc) | VM_OC_GET_BRANCH | VM_OC_BACKWARD_BRANCH)
 
+/**
+ * Compare and branch instructions are the fusion of a comparison
+ * and a CBC_BRANCH_IF_TRUE / CBC_BRANCH_IF_FALSE instruction. They
+ * are organized in the same way as the branch instructions, and
+ * each form of the comparison (two stack values, a stack value and
+ * a literal, two literals) has a forward and a backward group.
+ *
+ * The byte argument holds the comparison (see
+ * CBC_COMPARE_BRANCH_GET_COMPARE) and the CBC_COMPARE_BRANCH_IF_FALSE
+ * flag. The byte argument is followed by the branch offset.
+ */
+#define CBC_COMPARE_FORWARD_BRANCH(name, arg_flags, stack, vm_oc) \
+  CBC_OPCODE (name, (arg_flags) | CBC_HAS_BYTE_ARG | CBC_HAS_BRANCH_ARG | CBC_FORWARD_BRANCH_ARG, stack, \
+              VM_OC_BRANCH_IF_COMPARE | (vm_oc)) \
+  CBC_OPCODE (name ## _2, (arg_flags) | CBC_HAS_BYTE_ARG | CBC_HAS_BRANCH_ARG | CBC_FORWARD_BRANCH_ARG, stack, \
+              VM_OC_BRANCH_IF_COMPARE | (vm_oc)) \
+  CBC_OPCODE (name ## _3, (arg_flags) | CBC_HAS_BYTE_ARG | CBC_HAS_BRANCH_ARG | CBC_FORWARD_BRANCH_ARG, stack, \
+              VM_OC_BRANCH_IF_COMPARE | (vm_oc))
+
+#define CBC_COMPARE_BACKWARD_BRANCH(name, arg_flags, stack, vm_oc) \
+  CBC_OPCODE (name, (arg_flags) | CBC_HAS_BYTE_ARG | CBC_HAS_BRANCH_ARG, stack, \
+              VM_OC_BRANCH_IF_COMPARE | (vm_oc) | VM_OC_BACKWARD_BRANCH) \
+  CBC_OPCODE (name ## _2, (arg_flags) | CBC_HAS_BYTE_ARG | CBC_HAS_BRANCH_ARG, stack, \
+              VM_OC_BRANCH_IF_COMPARE | (vm_oc) | VM_OC_BACKWARD_BRANCH) \
+  CBC_OPCODE (name ## _3, (arg_flags) | CBC_HAS_BYTE_ARG | CBC_HAS_BRANCH_ARG, stack, \
+              VM_OC_BRANCH_IF_COMPARE | (vm_oc) | VM_OC_BACKWARD_BRANCH)
+
+/**
+ * Checks whether the opcode is a comparison which can be fused with a branch.
+ */
+#define CBC_IS_COMPARE_OPERATION(opcode) \
+  ((opcode) >= CBC_EQUAL && (opcode) <= CBC_GREATER_EQUAL_TWO_LITERALS)
+
+/**
+ * Checks whether the opcode is a compare and branch opcode.
+ */
+#define CBC_IS_COMPARE_BRANCH_OPERATION(opcode) \
+  ((opcode) >= CBC_BRANCH_IF_COMPARE_FORWARD && (opcode) <= CBC_BRANCH_IF_COMPARE_TWO_LITERALS_BACKWARD_3)
+
+/**
+ * Distance of the compare and branch groups of the different argument forms.
+ */
+#define CBC_COMPARE_BRANCH_FORM_DISTANCE 8
+
+/**
+ * Distance of the forward and backward compare and branch groups.
+ */
+#define CBC_COMPARE_BRANCH_BACKWARD_DISTANCE 4
+
+/**
+ * The branch is taken when the result of the comparison is false.
+ */
+#define CBC_COMPARE_BRANCH_IF_FALSE 0x8
+
+/**
+ * Create the byte argument of a compare and branch opcode from a comparison opcode.
+ */
+#define CBC_COMPARE_BRANCH_CREATE_ARG(opcode) \
+  ((uint8_t) (((opcode) - CBC_EQUAL) / (CBC_BINARY_WITH_TWO_LITERALS + 1)))
+
+/**
+ * Get the comparison opcode (the form without literal arguments) from the byte argument.
+ */
+#define CBC_COMPARE_BRANCH_GET_COMPARE(byte_arg) \
+  ((uint16_t) (CBC_EQUAL + ((byte_arg) & (CBC_COMPARE_BRANCH_IF_FALSE - 1)) * (CBC_BINARY_WITH_TWO_LITERALS + 1)))
+
+/**
+ * Checks whether the opcode is an arithmetic operation which can be fused with an assignment.
+ */
+#define CBC_IS_ARITHMETIC_OPERATION(opcode) \
+  (((opcode) >= CBC_BIT_OR && (opcode) <= CBC_BIT_AND_TWO_LITERALS) \
+   || ((opcode) >= CBC_LEFT_SHIFT && (opcode) <= CBC_MODULO_TWO_LITERALS))
+
+/**
+ * Checks whether the opcode is an arithmetic and set identifier opcode.
+ */
+#define CBC_IS_ARITHMETIC_SET_IDENT_OPERATION(opcode) \
+  ((opcode) >= CBC_ARITHMETIC_SET_IDENT && (opcode) <= CBC_ARITHMETIC_TWO_LITERALS_SET_IDENT_BLOCK)
+
+/**
+ * Create the byte argument of an arithmetic and set identifier opcode from an arithmetic opcode.
+ */
+#define CBC_ARITHMETIC_SET_IDENT_CREATE_ARG(opcode) \
+  ((uint8_t) (((opcode) - CBC_BIT_OR) / (CBC_BINARY_WITH_TWO_LITERALS + 1)))
+
+/**
+ * Get the arithmetic opcode (the form without literal arguments) from the byte argument.
+ */
+#define CBC_ARITHMETIC_SET_IDENT_GET_OPCODE(byte_arg) \
+  ((uint16_t) (CBC_BIT_OR + (byte_arg) * (CBC_BINARY_WITH_TWO_LITERALS + 1)))
+
 #define CBC_BRANCH_OFFSET_LENGTH(opcode) \
   ((opcode) & 0x3)
 
@@ -244,28 +349,42 @@
               VM_OC_PUSH_ELISON | VM_OC_PUT_STACK) \
   CBC_FORWARD_BRANCH (CBC_BRANCH_IF_STRICT_EQUAL, -1, \
                       VM_OC_BRANCH_IF_STRICT_EQUAL) \
-  \
-  /* Basic opcodes. Note: These 4 opcodes must me in this order */ \
-  CBC_OPCODE (CBC_PUSH_LITERAL, CBC_HAS_LITERAL_ARG, 1, \
-              VM_OC_PUSH | VM_OC_GET_LITERAL) \
-  CBC_OPCODE (CBC_PUSH_TWO_LITERALS, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 2, \
-              VM_OC_PUSH_TWO | VM_OC_GET_LITERAL_LITERAL) \
-  CBC_OPCODE (CBC_PUSH_THIS_LITERAL, CBC_HAS_LITERAL_ARG, 2, \
-              VM_OC_PUSH_TWO | VM_OC_GET_THIS_LITERAL) \
-  CBC_OPCODE (CBC_PUSH_THREE_LITERALS, CBC_HAS_LITERAL_ARG2, 3, \
-              VM_OC_PUSH_THREE | VM_OC_GET_LITERAL_LITERAL) \
   CBC_OPCODE (CBC_PUSH_UNDEFINED, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_UNDEFINED | VM_OC_PUT_STACK) \
+  CBC_COMPARE_FORWARD_BRANCH (CBC_BRANCH_IF_COMPARE_FORWARD, CBC_NO_FLAG, -2, \
+                              VM_OC_GET_STACK_STACK) \
   CBC_OPCODE (CBC_PUSH_TRUE, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_TRUE | VM_OC_PUT_STACK) \
+  CBC_COMPARE_BACKWARD_BRANCH (CBC_BRANCH_IF_COMPARE_BACKWARD, CBC_NO_FLAG, -2, \
+                               VM_OC_GET_STACK_STACK) \
   CBC_OPCODE (CBC_PUSH_FALSE, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_FALSE | VM_OC_PUT_STACK) \
+  CBC_COMPARE_FORWARD_BRANCH (CBC_BRANCH_IF_COMPARE_RIGHT_LITERAL_FORWARD, CBC_HAS_LITERAL_ARG, -1, \
+                              VM_OC_GET_STACK_LITERAL) \
   CBC_OPCODE (CBC_PUSH_NULL, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_NULL | VM_OC_PUT_STACK) \
+  CBC_COMPARE_BACKWARD_BRANCH (CBC_BRANCH_IF_COMPARE_RIGHT_LITERAL_BACKWARD, CBC_HAS_LITERAL_ARG, -1, \
+                               VM_OC_GET_STACK_LITERAL) \
   CBC_OPCODE (CBC_PUSH_THIS, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_THIS | VM_OC_PUT_STACK) \
+  CBC_COMPARE_FORWARD_BRANCH (CBC_BRANCH_IF_COMPARE_TWO_LITERALS_FORWARD, \
+                              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+                              VM_OC_GET_LITERAL_LITERAL) \
   CBC_OPCODE (CBC_PUSH_NUMBER_0, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_0 | VM_OC_PUT_STACK) \
+  CBC_COMPARE_BACKWARD_BRANCH (CBC_BRANCH_IF_COMPARE_TWO_LITERALS_BACKWARD, \
+                               CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+                               VM_OC_GET_LITERAL_LITERAL) \
+  \
+  /* Basic opcodes. Note: These 4 opcodes must me in this order */ \
+  CBC_OPCODE (CBC_PUSH_LITERAL, CBC_HAS_LITERAL_ARG, 1, \
+              VM_OC_PUSH | VM_OC_GET_LITERAL) \
+  CBC_OPCODE (CBC_PUSH_TWO_LITERALS, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 2, \
+              VM_OC_PUSH_TWO | VM_OC_GET_LITERAL_LITERAL) \
+  CBC_OPCODE (CBC_PUSH_THIS_LITERAL, CBC_HAS_LITERAL_ARG, 2, \
+              VM_OC_PUSH_TWO | VM_OC_GET_THIS_LITERAL) \
+  CBC_OPCODE (CBC_PUSH_THREE_LITERALS, CBC_HAS_LITERAL_ARG2, 3, \
+              VM_OC_PUSH_THREE | VM_OC_GET_LITERAL_LITERAL) \
   CBC_OPCODE (CBC_PUSH_NUMBER_POS_BYTE, CBC_HAS_BYTE_ARG, 1, \
               VM_OC_PUSH_POS_BYTE | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_PUSH_NUMBER_NEG_BYTE, CBC_HAS_BYTE_ARG, 1, \
@@ -474,6 +593,13 @@
               VM_OC_ASSIGN_PROP_THIS | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_ASSIGN_PROP_THIS_LITERAL_BLOCK, CBC_HAS_LITERAL_ARG, -1, \
               VM_OC_ASSIGN_PROP_THIS | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_BLOCK) \
+  CBC_ARITHMETIC_SET_IDENT_OPERATION (CBC_ARITHMETIC_SET_IDENT, CBC_HAS_LITERAL_ARG, -2, \
+                                      VM_OC_GET_STACK_STACK) \
+  CBC_ARITHMETIC_SET_IDENT_OPERATION (CBC_ARITHMETIC_RIGHT_LITERAL_SET_IDENT, \
+                                      CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, -1, \
+                                      VM_OC_GET_STACK_LITERAL) \
+  CBC_ARITHMETIC_SET_IDENT_OPERATION (CBC_ARITHMETIC_TWO_LITERALS_SET_IDENT, CBC_HAS_LITERAL_ARG2, 0, \
+                                      VM_OC_GET_LITERAL_LITERAL) \
   CBC_OPCODE (CBC_MOV_IDENT, CBC_HAS_LITERAL_ARG, -1, \
               VM_OC_MOV_IDENT | VM_OC_GET_STACK | VM_OC_PUT_IDENT) \
   \
@@ -681,8 +807,41 @@ typedef enum
   CBC_CODE_FLAGS_DEBUGGER_IGNORE = (1u << 8), /**< this function should be ignored by debugger */
   CBC_CODE_FLAGS_CONSTRUCTOR = (1u << 9), /**< this function is a constructor */
   CBC_CODE_FLAGS_REST_PARAMETER = (1u << 10), /**< this function has rest parameter */
+  CBC_CODE_FLAGS_LAZY_FUNCTION = (1u << 11), /**< compiled code is a cbc_lazy_function_t stub */
 } cbc_code_flags;
 
+/**
+ * Source code shared by the lazily compiled functions of a script.
+ */
+typedef struct
+{
+  uint32_t refs;                    /**< reference counter */
+  uint32_t size;                    /**< size of the allocated block */
+  const uint8_t *source_p;          /**< source code: either stored after this structure,
+                                     *   or kept alive by the host (JERRY_PARSE_STATIC_SOURCE) */
+#if ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ERROR_MESSAGES) || ENABLED (JERRY_ES2015_MODULE_SYSTEM)
+  ecma_value_t resource_name;       /**< resource name of the script */
+#endif /* ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ERROR_MESSAGES) || ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
+} cbc_lazy_source_t;
+
+/**
+ * Stub which replaces the byte code of a function until the function is called first.
+ *
+ * Note:
+ *      only the header and the argument_end fields of the arguments are valid
+ */
+typedef struct
+{
+  cbc_uint8_arguments_t header;         /**< byte code arguments */
+  ecma_compiled_code_t *compiled_code_p; /**< compiled byte code (NULL before the first call) */
+  cbc_lazy_source_t *source_p;          /**< shared source code */
+  uint32_t start_offset;                /**< offset of the opening bracket of the argument list */
+  uint32_t end_offset;                  /**< offset after the closing brace of the function body */
+  uint32_t line;                        /**< line of the opening bracket */
+  uint32_t column;                      /**< column of the opening bracket */
+  uint32_t status_flags;                /**< parser status flags of the function */
+} cbc_lazy_function_t;
+
 /**
  * Non-strict arguments object must be constructed
  */
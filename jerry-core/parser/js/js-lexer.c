@@ -638,6 +638,11 @@ lexer_parse_identifier (parser_context_t *context_p, /**< context */
     /* Fill literal data. */
     context_p->token.lit_location.char_p = ident_start_p;
     context_p->token.lit_location.length = (prop_length_t) length;
+
+    if (JERRY_UNLIKELY (context_p->scanner_lazy_info_p != NULL))
+    {
+      scanner_lazy_add_identifier (context_p);
+    }
   }
 
   context_p->source_p = source_p;
@@ -1855,17 +1855,39 @@ parser_append_binary_token (parser_context_t *context_p) /**< context */
     {
       parser_check_invalid_assign (context_p);
 
-      parser_emit_ident_reference (context_p, CBC_PUSH_IDENT_REFERENCE);
+      /* The value of the identifier is kept as the left operand, and
+       * the result is stored by CBC_ASSIGN_SET_IDENT, which is fused
+       * with the arithmetic operation. */
+      uint16_t literal_index;
+
+      if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
+      {
+        literal_index = context_p->last_cbc.literal_index;
+      }
+      else if (context_p->last_cbc_opcode == CBC_PUSH_TWO_LITERALS)
+      {
+        literal_index = context_p->last_cbc.value;
+      }
+      else
+      {
+        JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_THREE_LITERALS);
+        literal_index = context_p->last_cbc.third_literal_index;
+      }
+
+      parser_stack_push_uint16 (context_p, literal_index);
+      parser_stack_push_uint8 (context_p, CBC_ASSIGN_SET_IDENT);
     }
     else if (PARSER_IS_PUSH_PROP (context_p->last_cbc_opcode))
     {
       context_p->last_cbc_opcode = PARSER_PUSH_PROP_TO_PUSH_PROP_REFERENCE (context_p->last_cbc_opcode);
+      parser_stack_push_uint8 (context_p, CBC_ASSIGN);
     }
     else
     {
       /* Invalid LeftHandSide expression. */
       parser_emit_cbc_ext (context_p, CBC_EXT_THROW_REFERENCE_ERROR);
       parser_emit_cbc (context_p, CBC_PUSH_PROP_REFERENCE);
+      parser_stack_push_uint8 (context_p, CBC_ASSIGN);
     }
   }
   else if (context_p->token.type == LEXER_LOGICAL_OR
@@ -1886,6 +1908,41 @@ parser_append_binary_token (parser_context_t *context_p) /**< context */
   parser_stack_push_uint8 (context_p, context_p->token.type);
 } /* parser_append_binary_token */
 
+/**
+ * Fuse the arithmetic operation in last_cbc with the assignment
+ * of its result to an identifier.
+ */
+static void
+parser_emit_arithmetic_set_ident (parser_context_t *context_p, /**< context */
+                                  uint16_t literal_index) /**< literal index of the identifier */
+{
+  JERRY_STATIC_ASSERT (CBC_ARITHMETIC_RIGHT_LITERAL_SET_IDENT - CBC_ARITHMETIC_SET_IDENT == 3
+                       && CBC_ARITHMETIC_TWO_LITERALS_SET_IDENT - CBC_ARITHMETIC_SET_IDENT == 6,
+                       arithmetic_set_ident_forms_must_follow_the_binary_operation_forms);
+
+  uint16_t opcode = context_p->last_cbc_opcode;
+  uint16_t form = (uint16_t) ((opcode - CBC_BIT_OR) % (CBC_BINARY_WITH_TWO_LITERALS + 1));
+
+  JERRY_ASSERT (CBC_IS_ARITHMETIC_OPERATION (opcode));
+
+  context_p->last_cbc_opcode = (uint16_t) (CBC_ARITHMETIC_SET_IDENT + form * 3);
+  context_p->last_cbc.byte_argument = CBC_ARITHMETIC_SET_IDENT_CREATE_ARG (opcode);
+
+  if (form == CBC_BINARY_WITH_TWO_LITERALS)
+  {
+    context_p->last_cbc.third_literal_index = literal_index;
+  }
+  else if (form == CBC_BINARY_WITH_LITERAL)
+  {
+    context_p->last_cbc.value = literal_index;
+  }
+  else
+  {
+    context_p->last_cbc.literal_index = literal_index;
+    context_p->last_cbc.value = context_p->last_cbc.byte_argument;
+  }
+} /* parser_emit_arithmetic_set_ident */
+
 /**
  * Emit opcode for binary computations.
  */
@@ -1931,6 +1988,14 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
       if (cbc_flags[opcode] & CBC_HAS_LITERAL_ARG)
       {
         uint16_t index = parser_stack_pop_uint16 (context_p);
+
+        if (opcode == CBC_ASSIGN_SET_IDENT
+            && CBC_IS_ARITHMETIC_OPERATION (context_p->last_cbc_opcode))
+        {
+          parser_emit_arithmetic_set_ident (context_p, index);
+          continue;
+        }
+
         parser_emit_cbc_literal (context_p, (uint16_t) opcode, index);
 
         if (opcode == CBC_ASSIGN_PROP_THIS_LITERAL
@@ -1951,7 +2016,7 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
     }
     else if (LEXER_IS_BINARY_LVALUE_TOKEN (token))
     {
-      parser_stack_push_uint8 (context_p, CBC_ASSIGN);
+      /* The assignment opcode is pushed by parser_append_binary_token. */
       parser_stack_push_uint8 (context_p, LEXER_ASSIGN);
       parser_stack_push_uint8 (context_p, lexer_convert_binary_lvalue_token_to_binary (token));
       continue;
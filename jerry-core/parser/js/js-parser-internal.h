@@ -86,6 +86,7 @@ typedef enum
   PARSER_MODULE_STORE_IDENT = (1u << 26),     /**< store identifier of the current export statement */
   PARSER_IS_EVAL = (1u << 27),                /**< eval code */
 #endif /* ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
+  PARSER_HAS_LAZY_FUNCTION = (1u << 28),      /**< the lazy_filter of the context is not empty */
 #ifndef JERRY_NDEBUG
   PARSER_SCANNING_SUCCESSFUL = (1u << 30),    /**< scanning process was successful */
 #endif /* !JERRY_NDEBUG */
@@ -173,6 +174,7 @@ typedef struct
   uint16_t third_literal_index;               /**< literal index argument */
   uint8_t literal_type;                       /**< last literal type */
   uint8_t literal_object_type;                /**< last literal object type */
+  uint8_t byte_argument;                      /**< byte argument of opcodes with two or three literals */
 } cbc_argument_t;
 
 /* Useful parser macros. */
@@ -352,6 +354,7 @@ typedef struct parser_saved_context_t
   parser_mem_data_t byte_code;                /**< byte code buffer */
   uint32_t byte_code_size;                    /**< byte code size for branches */
   parser_mem_data_t literal_pool_data;        /**< literal list */
+  uint32_t lazy_filter[SCANNER_LAZY_FILTER_WORDS]; /**< identifiers of the lazily compiled functions */
 
 #ifndef JERRY_NDEBUG
   uint16_t context_stack_depth;               /**< current context stack depth */
@@ -394,6 +397,12 @@ typedef struct
   scanner_info_t *active_scanner_info_p;      /**< currently active scanner info block */
   scanner_info_t *skipped_scanner_info_p;     /**< next scanner info block */
   scanner_info_t *skipped_scanner_info_end_p; /**< currently active scanner info block */
+  scanner_lazy_info_t *scanner_lazy_info_p;   /**< lazily compiled function whose body is being scanned */
+
+  /* Lazy compilation members. */
+  cbc_lazy_source_t *lazy_source_p;           /**< source code shared by the lazily compiled functions
+                                               *   (NULL if lazy compilation is disabled) */
+  uint32_t lazy_filter[SCANNER_LAZY_FILTER_WORDS]; /**< identifiers of the lazily compiled functions */
 
   /* Compact byte code members. */
   cbc_argument_t last_cbc;                    /**< argument of the last cbc */
@@ -595,8 +604,13 @@ void scanner_release_active (parser_context_t *context_p, size_t size);
 void scanner_release_switch_cases (scanner_case_info_t *case_p);
 void scanner_seek (parser_context_t *context_p);
 void scanner_reverse_info_list (parser_context_t *context_p);
+void scanner_free_info (scanner_info_t *scanner_info_p);
 void scanner_cleanup (parser_context_t *context_p);
 
+void scanner_lazy_filter_add (uint32_t *filter_p, const uint8_t *char_p, size_t length);
+bool scanner_lazy_filter_contains (const uint32_t *filter_p, const uint8_t *char_p, size_t length);
+void scanner_lazy_add_identifier (parser_context_t *context_p);
+
 void scanner_get_location (scanner_location_t *location_p, parser_context_t *context_p);
 void scanner_set_location (parser_context_t *context_p, scanner_location_t *location_p);
 
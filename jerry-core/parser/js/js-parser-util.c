@@ -157,9 +157,18 @@ parser_flush_cbc (parser_context_t *context_p) /**< context */
 
   if (flags & CBC_HAS_BYTE_ARG)
   {
-    uint8_t byte_argument = (uint8_t) context_p->last_cbc.value;
+    uint8_t byte_argument;
 
-    JERRY_ASSERT (context_p->last_cbc.value <= CBC_MAXIMUM_BYTE_VALUE);
+    if (flags & CBC_HAS_LITERAL_ARG2)
+    {
+      /* The value field holds the second literal. */
+      byte_argument = context_p->last_cbc.byte_argument;
+    }
+    else
+    {
+      JERRY_ASSERT (context_p->last_cbc.value <= CBC_MAXIMUM_BYTE_VALUE);
+      byte_argument = (uint8_t) context_p->last_cbc.value;
+    }
 
     if (flags & CBC_POP_STACK_BYTE_ARG)
     {
@@ -216,6 +225,10 @@ parser_flush_cbc (parser_context_t *context_p) /**< context */
       {
         JERRY_DEBUG_MSG (" number:%d", -((int) context_p->last_cbc.value + 1));
       }
+      else if (CBC_IS_ARITHMETIC_SET_IDENT_OPERATION (last_opcode))
+      {
+        JERRY_DEBUG_MSG (" %s", cbc_names[CBC_ARITHMETIC_SET_IDENT_GET_OPCODE (context_p->last_cbc.byte_argument)]);
+      }
       else
       {
         JERRY_DEBUG_MSG (" byte_arg:%d", (int) context_p->last_cbc.value);
@@ -445,6 +458,118 @@ parser_emit_line_info (parser_context_t *context_p, /**< context */
 
 #endif /* ENABLED (JERRY_LINE_INFO) */
 
+JERRY_STATIC_ASSERT (CBC_BRANCH_IF_COMPARE_BACKWARD
+                     == CBC_BRANCH_IF_COMPARE_FORWARD + CBC_COMPARE_BRANCH_BACKWARD_DISTANCE
+                     && CBC_BRANCH_IF_COMPARE_RIGHT_LITERAL_FORWARD
+                        == CBC_BRANCH_IF_COMPARE_FORWARD + CBC_BINARY_WITH_LITERAL * CBC_COMPARE_BRANCH_FORM_DISTANCE
+                     && CBC_BRANCH_IF_COMPARE_TWO_LITERALS_FORWARD
+                        == CBC_BRANCH_IF_COMPARE_FORWARD
+                           + CBC_BINARY_WITH_TWO_LITERALS * CBC_COMPARE_BRANCH_FORM_DISTANCE,
+                     compare_and_branch_opcodes_must_be_in_the_order_of_the_comparison_forms);
+
+JERRY_STATIC_ASSERT (CBC_COMPARE_BRANCH_GET_COMPARE (CBC_COMPARE_BRANCH_CREATE_ARG (CBC_GREATER_EQUAL_TWO_LITERALS))
+                     == CBC_GREATER_EQUAL
+                     && CBC_COMPARE_BRANCH_CREATE_ARG (CBC_GREATER_EQUAL) < CBC_COMPARE_BRANCH_IF_FALSE,
+                     compare_and_branch_byte_argument_must_encode_all_comparisons);
+
+/**
+ * Fuse the last comparison byte code with a conditional branch.
+ *
+ * Note:
+ *   the comparison remains the last byte code, and its arguments
+ *   are appended by parser_emit_compare_branch_arguments
+ *
+ * @return compare and branch opcode - if the byte codes can be fused
+ *         opcode - otherwise
+ */
+static uint16_t
+parser_fuse_compare_branch (parser_context_t *context_p, /**< context */
+                            uint16_t opcode, /**< branch opcode */
+                            uint8_t *compare_argument_p) /**< [out] byte argument of the fused opcode */
+{
+  uint16_t compare_opcode = context_p->last_cbc_opcode;
+
+  if (!CBC_IS_COMPARE_OPERATION (compare_opcode))
+  {
+    return opcode;
+  }
+
+  uint8_t compare_argument = CBC_COMPARE_BRANCH_CREATE_ARG (compare_opcode);
+  uint32_t form = (uint32_t) (compare_opcode - CBC_EQUAL) % (CBC_BINARY_WITH_TWO_LITERALS + 1);
+  uint16_t fused_opcode = (uint16_t) (CBC_BRANCH_IF_COMPARE_FORWARD + form * CBC_COMPARE_BRANCH_FORM_DISTANCE);
+
+  switch (opcode)
+  {
+    case CBC_BRANCH_IF_TRUE_FORWARD:
+    {
+      break;
+    }
+    case CBC_BRANCH_IF_FALSE_FORWARD:
+    {
+      compare_argument |= CBC_COMPARE_BRANCH_IF_FALSE;
+      break;
+    }
+    case CBC_BRANCH_IF_TRUE_BACKWARD:
+    {
+      fused_opcode = (uint16_t) (fused_opcode + CBC_COMPARE_BRANCH_BACKWARD_DISTANCE);
+      break;
+    }
+    case CBC_BRANCH_IF_FALSE_BACKWARD:
+    {
+      fused_opcode = (uint16_t) (fused_opcode + CBC_COMPARE_BRANCH_BACKWARD_DISTANCE);
+      compare_argument |= CBC_COMPARE_BRANCH_IF_FALSE;
+      break;
+    }
+    default:
+    {
+      return opcode;
+    }
+  }
+
+  *compare_argument_p = compare_argument;
+  return fused_opcode;
+} /* parser_fuse_compare_branch */
+
+/**
+ * Append the arguments of a comparison fused into a compare and branch byte code.
+ *
+ * @return number of appended bytes
+ */
+static uint32_t
+parser_emit_compare_branch_arguments (parser_context_t *context_p, /**< context */
+                                      uint8_t flags, /**< flags of the compare and branch opcode */
+                                      uint8_t compare_argument) /**< byte argument */
+{
+  uint32_t length = 1;
+
+  JERRY_ASSERT (CBC_IS_COMPARE_OPERATION (context_p->last_cbc_opcode));
+
+  if (flags & CBC_HAS_LITERAL_ARG)
+  {
+    uint16_t literal_index = context_p->last_cbc.literal_index;
+
+    parser_emit_two_bytes (context_p,
+                           (uint8_t) (literal_index & 0xff),
+                           (uint8_t) (literal_index >> 8));
+    length += 2;
+  }
+
+  if (flags & CBC_HAS_LITERAL_ARG2)
+  {
+    uint16_t literal_index = context_p->last_cbc.value;
+
+    parser_emit_two_bytes (context_p,
+                           (uint8_t) (literal_index & 0xff),
+                           (uint8_t) (literal_index >> 8));
+    length += 2;
+  }
+
+  PARSER_APPEND_TO_BYTE_CODE (context_p, compare_argument);
+
+  context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+  return length;
+} /* parser_emit_compare_branch_arguments */
+
 /**
  * Append a byte code with a branch argument
  */
@@ -455,10 +580,18 @@ parser_emit_cbc_forward_branch (parser_context_t *context_p, /**< context */
 {
   uint8_t flags;
   uint32_t extra_byte_code_increase;
+  uint8_t compare_argument = 0;
 
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
-    parser_flush_cbc (context_p);
+    uint16_t fused_opcode = parser_fuse_compare_branch (context_p, opcode, &compare_argument);
+
+    if (fused_opcode == opcode)
+    {
+      parser_flush_cbc (context_p);
+    }
+
+    opcode = fused_opcode;
   }
 
   context_p->status_flags |= PARSER_NO_END_LABEL;
@@ -503,7 +636,18 @@ parser_emit_cbc_forward_branch (parser_context_t *context_p, /**< context */
   PARSER_PLUS_EQUAL_U16 (opcode, 2);
 #endif /* PARSER_MAXIMUM_CODE_SIZE <= 65535 */
 
-  parser_emit_two_bytes (context_p, (uint8_t) opcode, 0);
+  if (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE)
+  {
+    parser_emit_two_bytes (context_p, (uint8_t) opcode, 0);
+  }
+  else
+  {
+    /* The arguments of the fused comparison precede the branch offset. */
+    PARSER_APPEND_TO_BYTE_CODE (context_p, (uint8_t) opcode);
+    extra_byte_code_increase += parser_emit_compare_branch_arguments (context_p, flags, compare_argument);
+    PARSER_APPEND_TO_BYTE_CODE (context_p, 0);
+  }
+
   branch_p->page_p = context_p->byte_code.last_p;
   branch_p->offset = (context_p->byte_code.last_position - 1) | (context_p->byte_code_size << 8);
 
@@ -559,13 +703,21 @@ parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
                                  uint32_t offset) /**< destination offset */
 {
   uint8_t flags;
+  uint8_t compare_argument = 0;
 #if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
   const char *name;
 #endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
 
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
-    parser_flush_cbc (context_p);
+    uint16_t fused_opcode = parser_fuse_compare_branch (context_p, opcode, &compare_argument);
+
+    if (fused_opcode == opcode)
+    {
+      parser_flush_cbc (context_p);
+    }
+
+    opcode = fused_opcode;
   }
 
   context_p->status_flags |= PARSER_NO_END_LABEL;
@@ -633,6 +785,11 @@ parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
 
   PARSER_APPEND_TO_BYTE_CODE (context_p, (uint8_t) opcode);
 
+  if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
+  {
+    context_p->byte_code_size += parser_emit_compare_branch_arguments (context_p, flags, compare_argument);
+  }
+
 #if PARSER_MAXIMUM_CODE_SIZE > 65535
   if (offset > 65535)
   {
@@ -20,6 +20,7 @@
 #include "ecma-module.h"
 #include "jcontext.h"
 #include "js-parser-internal.h"
+#include "lit-char-helpers.h"
 
 #if ENABLED (JERRY_PARSER)
 
@@ -55,6 +56,21 @@ parser_copy_identifiers (parser_context_t *context_p) /**< context */
     return;
   }
 
+  if (context_p->status_flags & PARSER_HAS_LAZY_FUNCTION)
+  {
+    /* The lazily compiled functions may access the variables of all parent functions. */
+    if (!(parent_p->status_flags & PARSER_HAS_LAZY_FUNCTION))
+    {
+      memset (parent_p->lazy_filter, 0, sizeof (parent_p->lazy_filter));
+      parent_p->status_flags |= PARSER_HAS_LAZY_FUNCTION;
+    }
+
+    for (uint32_t i = 0; i < SCANNER_LAZY_FILTER_WORDS; i++)
+    {
+      parent_p->lazy_filter[i] |= context_p->lazy_filter[i];
+    }
+  }
+
   if (context_p->status_flags & PARSER_NO_REG_STORE)
   {
     /* This flag must affect all parent functions. */
@@ -184,6 +200,15 @@ parser_compute_indicies (parser_context_t *context_p, /**< context */
       continue;
     }
 
+    if ((status_flags & PARSER_HAS_LAZY_FUNCTION)
+        && literal_p->type == LEXER_IDENT_LITERAL
+        && (literal_p->status_flags & LEXER_FLAG_VAR)
+        && scanner_lazy_filter_contains (context_p->lazy_filter, literal_p->u.char_p, literal_p->prop.length))
+    {
+      /* This variable may be accessed by a lazily compiled function. */
+      literal_p->status_flags |= LEXER_FLAG_NO_REG_STORE;
+    }
+
 #if !ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
     if (literal_p->type == LEXER_IDENT_LITERAL
         || literal_p->type == LEXER_STRING_LITERAL)
@@ -829,7 +854,9 @@ parser_update_backward_branch (parser_mem_page_t *page_p, /**< current page */
  */
 static void
 parse_update_branches (parser_context_t *context_p, /**< context */
-                       uint8_t *byte_code_p) /**< byte code */
+                       uint8_t *byte_code_p, /**< byte code */
+                       uint16_t literal_one_byte_limit) /**< maximum value of a literal
+                                                          *   encoded in one byte */
 {
   parser_mem_page_t *page_p = context_p->byte_code.first_p;
   parser_mem_page_t *prev_page_p = NULL;
@@ -876,6 +903,22 @@ parse_update_branches (parser_context_t *context_p, /**< context */
       branch_argument_length = CBC_BRANCH_OFFSET_LENGTH (*bytes_p);
       bytes_p++;
 
+      if (flags & CBC_HAS_BYTE_ARG)
+      {
+        /* Compare and branch opcodes: the arguments of the comparison precede the branch offset. */
+        if (flags & CBC_HAS_LITERAL_ARG)
+        {
+          bytes_p += (*bytes_p > literal_one_byte_limit) ? 2 : 1;
+        }
+
+        if (flags & CBC_HAS_LITERAL_ARG2)
+        {
+          bytes_p += (*bytes_p > literal_one_byte_limit) ? 2 : 1;
+        }
+
+        bytes_p++;
+      }
+
       /* Decoding target. */
       length = branch_argument_length;
       target_distance = 0;
@@ -1342,6 +1385,16 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
       {
         JERRY_DEBUG_MSG (" number:%d", -((int) *byte_code_p + 1));
       }
+      else if (CBC_IS_COMPARE_BRANCH_OPERATION (opcode))
+      {
+        JERRY_DEBUG_MSG (" %s%s",
+                         cbc_names[CBC_COMPARE_BRANCH_GET_COMPARE (*byte_code_p)],
+                         (*byte_code_p & CBC_COMPARE_BRANCH_IF_FALSE) ? " is_false" : "");
+      }
+      else if (CBC_IS_ARITHMETIC_SET_IDENT_OPERATION (opcode))
+      {
+        JERRY_DEBUG_MSG (" %s", cbc_names[CBC_ARITHMETIC_SET_IDENT_GET_OPCODE (*byte_code_p)]);
+      }
       else
       {
         JERRY_DEBUG_MSG (" byte_arg:%d", *byte_code_p);
@@ -1634,13 +1687,14 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
       if (flags & CBC_HAS_LITERAL_ARG2)
       {
+        /* The other argument flags are kept. */
         if (flags & CBC_HAS_LITERAL_ARG)
         {
-          flags = CBC_HAS_LITERAL_ARG;
+          flags = (uint8_t) (flags & ~CBC_HAS_LITERAL_ARG2);
         }
         else
         {
-          flags = CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2;
+          flags = (uint8_t) (flags | CBC_HAS_LITERAL_ARG);
         }
       }
       else
@@ -1955,9 +2009,10 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 #endif /* ENABLED (JERRY_LINE_INFO) */
     }
 
-    /* Only literal and call arguments can be combined. */
+    /* Only literal and call arguments, or the arguments of compare and branch opcodes can be combined. */
     JERRY_ASSERT (!(flags & CBC_HAS_BRANCH_ARG)
-                   || !(flags & (CBC_HAS_BYTE_ARG | CBC_HAS_LITERAL_ARG)));
+                   || !(flags & (CBC_HAS_BYTE_ARG | CBC_HAS_LITERAL_ARG))
+                   || CBC_IS_COMPARE_BRANCH_OPERATION (opcode));
 
     while (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
     {
@@ -1982,13 +2037,14 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
       if (flags & CBC_HAS_LITERAL_ARG2)
       {
+        /* The other argument flags are kept. */
         if (flags & CBC_HAS_LITERAL_ARG)
         {
-          flags = CBC_HAS_LITERAL_ARG;
+          flags = (uint8_t) (flags & ~CBC_HAS_LITERAL_ARG2);
         }
         else
         {
-          flags = CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2;
+          flags = (uint8_t) (flags | CBC_HAS_LITERAL_ARG);
         }
       }
       else
@@ -2008,7 +2064,6 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       *dst_p++ = page_p->bytes[offset];
       real_offset++;
       PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
-      continue;
     }
 
     if (flags & CBC_HAS_BRANCH_ARG)
@@ -2060,7 +2115,8 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   JERRY_ASSERT (dst_p == byte_code_p + length);
 
   parse_update_branches (context_p,
-                         byte_code_p + initializers_length);
+                         byte_code_p + initializers_length,
+                         literal_one_byte_limit);
 
   parser_cbc_stream_free (&context_p->byte_code);
 
@@ -2367,6 +2423,144 @@ parser_parse_function_arguments (parser_context_t *context_p, /**< context */
   context_p->register_count = context_p->argument_count;
 } /* parser_parse_function_arguments */
 
+/**
+ * Parse the argument list and the body of a function.
+ *
+ * Note:
+ *      the current token must be the opening bracket of the argument list
+ */
+static void
+parser_parse_function_arguments_and_body (parser_context_t *context_p) /**< context */
+{
+  if (context_p->token.type != LEXER_LEFT_PAREN)
+  {
+    parser_raise_error (context_p, PARSER_ERR_ARGUMENT_LIST_EXPECTED);
+  }
+
+  lexer_next_token (context_p);
+
+  parser_parse_function_arguments (context_p, LEXER_RIGHT_PAREN);
+  lexer_next_token (context_p);
+
+  if ((context_p->status_flags & PARSER_IS_PROPERTY_GETTER)
+      && context_p->argument_count != 0)
+  {
+    parser_raise_error (context_p, PARSER_ERR_NO_ARGUMENTS_EXPECTED);
+  }
+
+  if ((context_p->status_flags & PARSER_IS_PROPERTY_SETTER)
+      && context_p->argument_count != 1)
+  {
+    parser_raise_error (context_p, PARSER_ERR_ONE_ARGUMENT_EXPECTED);
+  }
+
+#if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
+  if (context_p->is_show_opcodes
+      && (context_p->status_flags & PARSER_HAS_NON_STRICT_ARG))
+  {
+    JERRY_DEBUG_MSG ("  Note: legacy (non-strict) argument definition\n\n");
+  }
+#endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
+
+  if (context_p->token.type != LEXER_LEFT_BRACE)
+  {
+    parser_raise_error (context_p, PARSER_ERR_LEFT_BRACE_EXPECTED);
+  }
+
+  lexer_next_token (context_p);
+
+#if ENABLED (JERRY_ES2015_CLASS)
+  if ((context_p->status_flags & PARSER_CLASS_CONSTRUCTOR_SUPER) == PARSER_CLASS_CONSTRUCTOR_SUPER)
+  {
+    context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
+  }
+#endif /* ENABLED (JERRY_ES2015_CLASS) */
+  parser_parse_statements (context_p);
+} /* parser_parse_function_arguments_and_body */
+
+/**
+ * Create the source code shared by the lazily compiled functions of a script.
+ *
+ * Note:
+ *      unless the source code is kept alive by the application, it is copied
+ *      and the script is parsed from the copy
+ *
+ * @return shared source code - if lazy compilation is possible
+ *         NULL - otherwise
+ */
+static cbc_lazy_source_t *
+parser_create_lazy_source (const uint8_t **source_p, /**< [in, out] source code */
+                           size_t source_size, /**< size of the source code */
+                           uint32_t parse_opts) /**< ecma_parse_opts_t option bits */
+{
+#if ENABLED (JERRY_DEBUGGER)
+  if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+  {
+    /* The debugger client needs the byte code of all functions. */
+    return NULL;
+  }
+#endif /* ENABLED (JERRY_DEBUGGER) */
+
+  size_t size = sizeof (cbc_lazy_source_t);
+
+  if (!(parse_opts & ECMA_PARSE_STATIC_SOURCE))
+  {
+    size += source_size;
+  }
+
+  if (size < source_size || size > UINT32_MAX)
+  {
+    return NULL;
+  }
+
+  cbc_lazy_source_t *lazy_source_p = (cbc_lazy_source_t *) jmem_heap_alloc_block_null_on_error (size);
+
+  if (lazy_source_p == NULL)
+  {
+    /* The functions are compiled immediately when there is no memory for the copy. */
+    return NULL;
+  }
+
+  lazy_source_p->refs = 1;
+  lazy_source_p->size = (uint32_t) size;
+  lazy_source_p->source_p = *source_p;
+
+  if (!(parse_opts & ECMA_PARSE_STATIC_SOURCE))
+  {
+    uint8_t *copy_p = (uint8_t *) (lazy_source_p + 1);
+
+    memcpy (copy_p, *source_p, source_size);
+    lazy_source_p->source_p = copy_p;
+    *source_p = copy_p;
+  }
+
+#if ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ERROR_MESSAGES) || ENABLED (JERRY_ES2015_MODULE_SYSTEM)
+  lazy_source_p->resource_name = ecma_copy_value (JERRY_CONTEXT (resource_name));
+#endif /* ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ERROR_MESSAGES) || ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
+
+  return lazy_source_p;
+} /* parser_create_lazy_source */
+
+/**
+ * Decrease the reference counter of the shared source code of lazily compiled functions.
+ */
+static void
+parser_lazy_source_deref (cbc_lazy_source_t *lazy_source_p) /**< shared source code */
+{
+  JERRY_ASSERT (lazy_source_p->refs > 0);
+
+  if (--lazy_source_p->refs > 0)
+  {
+    return;
+  }
+
+#if ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ERROR_MESSAGES) || ENABLED (JERRY_ES2015_MODULE_SYSTEM)
+  ecma_free_value (lazy_source_p->resource_name);
+#endif /* ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ERROR_MESSAGES) || ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
+
+  jmem_heap_free_block (lazy_source_p, lazy_source_p->size);
+} /* parser_lazy_source_deref */
+
 /**
  * Parse and compile EcmaScript source code
  *
@@ -2380,20 +2574,35 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
                      const uint8_t *source_p, /**< valid UTF-8 source code */
                      size_t source_size, /**< size of the source code */
                      uint32_t parse_opts, /**< ecma_parse_opts_t option bits */
+                     cbc_lazy_function_t *lazy_function_p, /**< lazily compiled function
+                                                            *   (NULL if a script is parsed) */
                      parser_error_location_t *error_location_p) /**< error location */
 {
   parser_context_t context;
   ecma_compiled_code_t *compiled_code_p;
+  parser_line_counter_t start_line = 1;
+  parser_line_counter_t start_column = 1;
 
   context.error = PARSER_ERR_NO_ERROR;
   context.allocated_buffer_p = NULL;
+  context.scanner_lazy_info_p = NULL;
+  context.lazy_source_p = NULL;
 
   if (error_location_p != NULL)
   {
     error_location_p->error = PARSER_ERR_NO_ERROR;
   }
 
-  if (arg_list_p == NULL)
+  if (lazy_function_p != NULL)
+  {
+    JERRY_ASSERT (arg_list_p == NULL && parse_opts == 0);
+
+    context.status_flags = lazy_function_p->status_flags;
+    context.lazy_source_p = lazy_function_p->source_p;
+    start_line = (parser_line_counter_t) lazy_function_p->line;
+    start_column = (parser_line_counter_t) lazy_function_p->column;
+  }
+  else if (arg_list_p == NULL)
   {
     context.status_flags = PARSER_NO_REG_STORE | PARSER_LEXICAL_ENV_NEEDED | PARSER_ARGUMENTS_NOT_NEEDED;
   }
@@ -2430,8 +2639,13 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   context.status_flags |= parse_opts & PARSER_STRICT_MODE_MASK;
 
   context.token.flags = 0;
-  context.line = 1;
-  context.column = 1;
+  context.line = start_line;
+  context.column = start_column;
+
+  if ((parse_opts & (ECMA_PARSE_LAZY_FUNCTIONS | ECMA_PARSE_EVAL)) == ECMA_PARSE_LAZY_FUNCTIONS)
+  {
+    context.lazy_source_p = parser_create_lazy_source (&source_p, source_size, parse_opts);
+  }
 
   scanner_info_t scanner_info_end;
   scanner_info_end.next_p = NULL;
@@ -2465,8 +2679,8 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   if (context.is_show_opcodes)
   {
     JERRY_DEBUG_MSG ("\n--- %s parsing start ---\n\n",
-                     (arg_list_p == NULL) ? "Script"
-                                          : "Function");
+                     (lazy_function_p != NULL) ? "Lazy function"
+                                               : ((arg_list_p == NULL) ? "Script" : "Function"));
   }
 #endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
 
@@ -2486,6 +2700,11 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
       error_location_p->line = context.token.line;
       error_location_p->column = context.token.column;
     }
+
+    if (lazy_function_p == NULL && context.lazy_source_p != NULL)
+    {
+      parser_lazy_source_deref (context.lazy_source_p);
+    }
     return NULL;
   }
 
@@ -2500,8 +2719,8 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
     context.source_end_p = arg_list_p + arg_list_size;
   }
 
-  context.line = 1;
-  context.column = 1;
+  context.line = start_line;
+  context.column = start_column;
 
   parser_stack_init (&context);
 
@@ -2519,7 +2738,11 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
      * lexer_next_token() must be immediately called. */
     lexer_next_token (&context);
 
-    if (arg_list_p != NULL)
+    if (lazy_function_p != NULL)
+    {
+      parser_parse_function_arguments_and_body (&context);
+    }
+    else if (arg_list_p != NULL)
     {
       parser_parse_function_arguments (&context, LEXER_EOS);
 
@@ -2534,7 +2757,10 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
       lexer_next_token (&context);
     }
 
-    parser_parse_statements (&context);
+    if (lazy_function_p == NULL)
+    {
+      parser_parse_statements (&context);
+    }
 
     /* When the parsing is successful, only the
      * dummy value can be remained on the stack. */
@@ -2559,8 +2785,8 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
     if (context.is_show_opcodes)
     {
       JERRY_DEBUG_MSG ("\n%s parsing successfully completed. Total byte code size: %d bytes\n",
-                       (arg_list_p == NULL) ? "Script"
-                                            : "Function",
+                       (lazy_function_p != NULL) ? "Lazy function"
+                                                 : ((arg_list_p == NULL) ? "Script" : "Function"),
                        (int) context.total_byte_code_size);
     }
 #endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
@@ -2604,13 +2830,19 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   if (context.is_show_opcodes)
   {
     JERRY_DEBUG_MSG ("\n--- %s parsing end ---\n\n",
-                     (arg_list_p == NULL) ? "Script"
-                                          : "Function");
+                     (lazy_function_p != NULL) ? "Lazy function"
+                                               : ((arg_list_p == NULL) ? "Script" : "Function"));
   }
 #endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
 
   parser_stack_free (&context);
 
+  if (lazy_function_p == NULL && context.lazy_source_p != NULL)
+  {
+    /* The source code is kept alive by the lazily compiled functions of the script. */
+    parser_lazy_source_deref (context.lazy_source_p);
+  }
+
   return compiled_code_p;
 } /* parser_parse_source */
 
@@ -2648,6 +2880,11 @@ parser_save_context (parser_context_t *context_p, /**< context */
   saved_context_p->byte_code_size = context_p->byte_code_size;
   saved_context_p->literal_pool_data = context_p->literal_pool.data;
 
+  if (context_p->status_flags & PARSER_HAS_LAZY_FUNCTION)
+  {
+    memcpy (saved_context_p->lazy_filter, context_p->lazy_filter, sizeof (context_p->lazy_filter));
+  }
+
 #ifndef JERRY_NDEBUG
   saved_context_p->context_stack_depth = context_p->context_stack_depth;
 #endif /* !JERRY_NDEBUG */
@@ -2700,11 +2937,90 @@ parser_restore_context (parser_context_t *context_p, /**< context */
   context_p->byte_code_size = saved_context_p->byte_code_size;
   context_p->literal_pool.data = saved_context_p->literal_pool_data;
 
+  if (context_p->status_flags & PARSER_HAS_LAZY_FUNCTION)
+  {
+    memcpy (context_p->lazy_filter, saved_context_p->lazy_filter, sizeof (context_p->lazy_filter));
+  }
+
 #ifndef JERRY_NDEBUG
   context_p->context_stack_depth = saved_context_p->context_stack_depth;
 #endif /* !JERRY_NDEBUG */
 } /* parser_restore_context */
 
+/**
+ * Create a stub for a function whose compilation is delayed until its first call,
+ * and skip the source code of the function.
+ *
+ * @return compiled code of the stub
+ */
+static ecma_compiled_code_t *
+parser_create_lazy_function (parser_context_t *context_p, /**< context */
+                             uint32_t status_flags) /**< extra status flags */
+{
+  scanner_lazy_info_t *lazy_info_p = (scanner_lazy_info_t *) context_p->next_scanner_info_p;
+  cbc_lazy_source_t *lazy_source_p = context_p->lazy_source_p;
+  size_t size = JERRY_ALIGNUP (sizeof (cbc_lazy_function_t), JMEM_ALIGNMENT);
+
+  JERRY_ASSERT (lazy_info_p->info.type == SCANNER_TYPE_LAZY_FUNCTION && lazy_source_p != NULL);
+
+  cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) parser_malloc (context_p, size);
+
+  status_flags |= context_p->status_flags & PARSER_IS_STRICT;
+
+  memset (&lazy_function_p->header, 0, sizeof (cbc_uint8_arguments_t));
+  lazy_function_p->header.header.size = (uint16_t) (size >> JMEM_ALIGNMENT_LOG);
+  lazy_function_p->header.header.refs = 1;
+  lazy_function_p->header.header.status_flags = CBC_CODE_FLAGS_FUNCTION | CBC_CODE_FLAGS_LAZY_FUNCTION;
+  lazy_function_p->header.argument_end = (uint8_t) lazy_info_p->argument_count;
+
+  if (status_flags & PARSER_IS_STRICT)
+  {
+    lazy_function_p->header.header.status_flags |= CBC_CODE_FLAGS_STRICT_MODE;
+  }
+
+  lazy_function_p->compiled_code_p = NULL;
+  lazy_function_p->source_p = lazy_source_p;
+  lazy_function_p->start_offset = (uint32_t) (lazy_info_p->info.source_p - lazy_source_p->source_p);
+  lazy_function_p->end_offset = (uint32_t) (lazy_info_p->end_location.source_p - lazy_source_p->source_p);
+  lazy_function_p->line = lazy_info_p->start_location.line;
+  lazy_function_p->column = lazy_info_p->start_location.column;
+  lazy_function_p->status_flags = status_flags;
+  lazy_source_p->refs++;
+
+  if (!(context_p->status_flags & PARSER_HAS_LAZY_FUNCTION))
+  {
+    memset (context_p->lazy_filter, 0, sizeof (context_p->lazy_filter));
+    context_p->status_flags |= PARSER_HAS_LAZY_FUNCTION;
+  }
+
+  for (uint32_t i = 0; i < SCANNER_LAZY_FILTER_WORDS; i++)
+  {
+    context_p->lazy_filter[i] |= lazy_info_p->filter[i];
+  }
+
+  if (lazy_info_p->flags & SCANNER_LAZY_HAS_EVAL)
+  {
+    context_p->status_flags |= PARSER_NO_REG_STORE;
+  }
+
+#if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
+  if (context_p->is_show_opcodes)
+  {
+    JERRY_DEBUG_MSG ("\n--- Function parsing is delayed until the first call ---\n\n");
+  }
+#endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
+
+  /* Continue parsing after the closing brace of the function body. */
+  scanner_set_location (context_p, &lazy_info_p->end_location);
+  context_p->token.type = LEXER_RIGHT_BRACE;
+  context_p->token.flags = 0;
+  context_p->token.line = context_p->line;
+  context_p->token.column = (parser_line_counter_t) (context_p->column - 1);
+
+  scanner_release_next (context_p, sizeof (scanner_lazy_info_t));
+  return (ecma_compiled_code_t *) lazy_function_p;
+} /* parser_create_lazy_function */
+
 /**
  * Parse function code
  *
@@ -2718,6 +3034,14 @@ parser_parse_function (parser_context_t *context_p, /**< context */
   ecma_compiled_code_t *compiled_code_p;
 
   JERRY_ASSERT (status_flags & PARSER_IS_FUNCTION);
+
+  if (context_p->next_scanner_info_p->type == SCANNER_TYPE_LAZY_FUNCTION
+      && lexer_check_next_character (context_p, LIT_CHAR_LEFT_PAREN)
+      && context_p->next_scanner_info_p->source_p == context_p->source_p)
+  {
+    return parser_create_lazy_function (context_p, status_flags);
+  }
+
   parser_save_context (context_p, &saved_context);
   context_p->status_flags |= status_flags;
 
@@ -2745,51 +3069,7 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 #endif /* ENABLED (JERRY_DEBUGGER) */
 
   lexer_next_token (context_p);
-
-  if (context_p->token.type != LEXER_LEFT_PAREN)
-  {
-    parser_raise_error (context_p, PARSER_ERR_ARGUMENT_LIST_EXPECTED);
-  }
-
-  lexer_next_token (context_p);
-
-  parser_parse_function_arguments (context_p, LEXER_RIGHT_PAREN);
-  lexer_next_token (context_p);
-
-  if ((context_p->status_flags & PARSER_IS_PROPERTY_GETTER)
-      && context_p->argument_count != 0)
-  {
-    parser_raise_error (context_p, PARSER_ERR_NO_ARGUMENTS_EXPECTED);
-  }
-
-  if ((context_p->status_flags & PARSER_IS_PROPERTY_SETTER)
-      && context_p->argument_count != 1)
-  {
-    parser_raise_error (context_p, PARSER_ERR_ONE_ARGUMENT_EXPECTED);
-  }
-
-#if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
-  if (context_p->is_show_opcodes
-      && (context_p->status_flags & PARSER_HAS_NON_STRICT_ARG))
-  {
-    JERRY_DEBUG_MSG ("  Note: legacy (non-strict) argument definition\n\n");
-  }
-#endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
-
-  if (context_p->token.type != LEXER_LEFT_BRACE)
-  {
-    parser_raise_error (context_p, PARSER_ERR_LEFT_BRACE_EXPECTED);
-  }
-
-  lexer_next_token (context_p);
-
-#if ENABLED (JERRY_ES2015_CLASS)
-  if ((context_p->status_flags & PARSER_CLASS_CONSTRUCTOR_SUPER) == PARSER_CLASS_CONSTRUCTOR_SUPER)
-  {
-    context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
-  }
-#endif /* ENABLED (JERRY_ES2015_CLASS) */
-  parser_parse_statements (context_p);
+  parser_parse_function_arguments_and_body (context_p);
   compiled_code_p = parser_post_processing (context_p);
 
 #if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
@@ -2967,6 +3247,48 @@ parser_raise_error (parser_context_t *context_p, /**< context */
   JERRY_ASSERT (0);
 } /* parser_raise_error */
 
+/**
+ * Throw the error reported by the parser.
+ *
+ * @return ECMA_VALUE_ERROR
+ */
+static ecma_value_t
+parser_throw_error (const parser_error_location_t *parser_error_p) /**< parser error */
+{
+  if (parser_error_p->error == PARSER_ERR_OUT_OF_MEMORY)
+  {
+    /* It is unlikely that memory can be allocated in an out-of-memory
+     * situation. However, a simple value can still be thrown. */
+    JERRY_CONTEXT (error_value) = ECMA_VALUE_NULL;
+    JERRY_CONTEXT (status_flags) |= ECMA_STATUS_EXCEPTION;
+    return ECMA_VALUE_ERROR;
+  }
+#if ENABLED (JERRY_ERROR_MESSAGES)
+  const lit_utf8_byte_t *err_bytes_p = (const lit_utf8_byte_t *) parser_error_to_string (parser_error_p->error);
+  lit_utf8_size_t err_bytes_size = lit_zt_utf8_string_size (err_bytes_p);
+
+  ecma_string_t *err_str_p = ecma_new_ecma_string_from_utf8 (err_bytes_p, err_bytes_size);
+  ecma_value_t err_str_val = ecma_make_string_value (err_str_p);
+  ecma_value_t line_str_val = ecma_make_uint32_value (parser_error_p->line);
+  ecma_value_t col_str_val = ecma_make_uint32_value (parser_error_p->column);
+
+  ecma_value_t error_value = ecma_raise_standard_error_with_format (ECMA_ERROR_SYNTAX,
+                                                                    "% [%:%:%]",
+                                                                    err_str_val,
+                                                                    JERRY_CONTEXT (resource_name),
+                                                                    line_str_val,
+                                                                    col_str_val);
+
+  ecma_free_value (col_str_val);
+  ecma_free_value (line_str_val);
+  ecma_free_value (err_str_val);
+
+  return error_value;
+#else /* !ENABLED (JERRY_ERROR_MESSAGES) */
+  return ecma_raise_syntax_error ("");
+#endif /* ENABLED (JERRY_ERROR_MESSAGES) */
+} /* parser_throw_error */
+
 #endif /* ENABLED (JERRY_PARSER) */
 
 /**
@@ -3005,6 +3327,7 @@ parser_parse_script (const uint8_t *arg_list_p, /**< function argument list */
                                           source_p,
                                           source_size,
                                           parse_opts,
+                                          NULL,
                                           &parser_error);
 
   if (!*bytecode_data_p)
@@ -3022,38 +3345,7 @@ parser_parse_script (const uint8_t *arg_list_p, /**< function argument list */
     }
 #endif /* ENABLED (JERRY_DEBUGGER) */
 
-    if (parser_error.error == PARSER_ERR_OUT_OF_MEMORY)
-    {
-      /* It is unlikely that memory can be allocated in an out-of-memory
-       * situation. However, a simple value can still be thrown. */
-      JERRY_CONTEXT (error_value) = ECMA_VALUE_NULL;
-      JERRY_CONTEXT (status_flags) |= ECMA_STATUS_EXCEPTION;
-      return ECMA_VALUE_ERROR;
-    }
-#if ENABLED (JERRY_ERROR_MESSAGES)
-    const lit_utf8_byte_t *err_bytes_p = (const lit_utf8_byte_t *) parser_error_to_string (parser_error.error);
-    lit_utf8_size_t err_bytes_size = lit_zt_utf8_string_size (err_bytes_p);
-
-    ecma_string_t *err_str_p = ecma_new_ecma_string_from_utf8 (err_bytes_p, err_bytes_size);
-    ecma_value_t err_str_val = ecma_make_string_value (err_str_p);
-    ecma_value_t line_str_val = ecma_make_uint32_value (parser_error.line);
-    ecma_value_t col_str_val = ecma_make_uint32_value (parser_error.column);
-
-    ecma_value_t error_value = ecma_raise_standard_error_with_format (ECMA_ERROR_SYNTAX,
-                                                                      "% [%:%:%]",
-                                                                      err_str_val,
-                                                                      JERRY_CONTEXT (resource_name),
-                                                                      line_str_val,
-                                                                      col_str_val);
-
-    ecma_free_value (col_str_val);
-    ecma_free_value (line_str_val);
-    ecma_free_value (err_str_val);
-
-    return error_value;
-#else /* !ENABLED (JERRY_ERROR_MESSAGES) */
-    return ecma_raise_syntax_error ("");
-#endif /* ENABLED (JERRY_ERROR_MESSAGES) */
+    return parser_throw_error (&parser_error);
   }
 
 #if ENABLED (JERRY_ES2015_MODULE_SYSTEM)
@@ -3106,6 +3398,80 @@ parser_parse_script (const uint8_t *arg_list_p, /**< function argument list */
 #endif /* ENABLED (JERRY_PARSER) */
 } /* parser_parse_script */
 
+#if ENABLED (JERRY_PARSER)
+
+/**
+ * Compile the byte code of a function whose compilation was delayed until its first call.
+ *
+ * Note:
+ *      the compiled byte code is stored in the stub, and it is released with the stub
+ *
+ * @return true - if success
+ *         syntax error - otherwise
+ */
+ecma_value_t
+parser_compile_lazy_function (ecma_compiled_code_t *bytecode_p) /**< lazy function stub */
+{
+  cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+  cbc_lazy_source_t *lazy_source_p = lazy_function_p->source_p;
+  parser_error_location_t parser_error;
+
+  JERRY_ASSERT ((bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION)
+                && lazy_function_p->compiled_code_p == NULL);
+
+#if ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ERROR_MESSAGES) || ENABLED (JERRY_ES2015_MODULE_SYSTEM)
+  ecma_value_t resource_name = JERRY_CONTEXT (resource_name);
+  JERRY_CONTEXT (resource_name) = lazy_source_p->resource_name;
+#endif /* ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ERROR_MESSAGES) || ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
+
+  ecma_compiled_code_t *compiled_code_p;
+  compiled_code_p = parser_parse_source (NULL,
+                                         0,
+                                         lazy_source_p->source_p + lazy_function_p->start_offset,
+                                         lazy_function_p->end_offset - lazy_function_p->start_offset,
+                                         ECMA_PARSE_NO_OPTS,
+                                         lazy_function_p,
+                                         &parser_error);
+
+  ecma_value_t result = ECMA_VALUE_TRUE;
+
+  if (JERRY_UNLIKELY (compiled_code_p == NULL))
+  {
+    result = parser_throw_error (&parser_error);
+  }
+  else
+  {
+    lazy_function_p->compiled_code_p = compiled_code_p;
+  }
+
+#if ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ERROR_MESSAGES) || ENABLED (JERRY_ES2015_MODULE_SYSTEM)
+  JERRY_CONTEXT (resource_name) = resource_name;
+#endif /* ENABLED (JERRY_LINE_INFO) || ENABLED (JERRY_ERROR_MESSAGES) || ENABLED (JERRY_ES2015_MODULE_SYSTEM) */
+
+  return result;
+} /* parser_compile_lazy_function */
+
+/**
+ * Free a lazy function stub whose reference counter is zero.
+ */
+void
+parser_free_lazy_function (ecma_compiled_code_t *bytecode_p) /**< lazy function stub */
+{
+  cbc_lazy_function_t *lazy_function_p = (cbc_lazy_function_t *) bytecode_p;
+
+  JERRY_ASSERT ((bytecode_p->status_flags & CBC_CODE_FLAGS_LAZY_FUNCTION) && bytecode_p->refs == 0);
+
+  if (lazy_function_p->compiled_code_p != NULL)
+  {
+    ecma_bytecode_deref (lazy_function_p->compiled_code_p);
+  }
+
+  parser_lazy_source_deref (lazy_function_p->source_p);
+  jmem_heap_free_block (lazy_function_p, ((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG);
+} /* parser_free_lazy_function */
+
+#endif /* ENABLED (JERRY_PARSER) */
+
 /**
  * @}
  * @}
@@ -169,6 +169,11 @@ ecma_value_t parser_parse_script (const uint8_t *arg_list_p, size_t arg_list_siz
                                   const uint8_t *source_p, size_t source_size,
                                   uint32_t parse_opts, ecma_compiled_code_t **bytecode_data_p);
 
+#if ENABLED (JERRY_PARSER)
+ecma_value_t parser_compile_lazy_function (ecma_compiled_code_t *bytecode_p);
+void parser_free_lazy_function (ecma_compiled_code_t *bytecode_p);
+#endif /* ENABLED (JERRY_PARSER) */
+
 #if ENABLED (JERRY_ERROR_MESSAGES)
 const char *parser_error_to_string (parser_error_t);
 #endif /* ENABLED (JERRY_ERROR_MESSAGES) */
@@ -62,6 +62,9 @@ typedef struct
 {
   uint8_t mode; /**< scanner mode */
   scanner_switch_statement_t active_switch_statement; /**< currently active switch statement */
+  scanner_location_t lazy_start_location; /**< start of the function whose arguments are scanned if the
+                                           *   function can be compiled lazily, source_p is NULL otherwise */
+  uint16_t lazy_argument_count; /**< number of arguments of the function */
 } scanner_context_t;
 
 /**
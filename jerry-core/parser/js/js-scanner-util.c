@@ -15,6 +15,7 @@
 
 #include "js-parser-internal.h"
 #include "js-scanner-internal.h"
+#include "lit-strings.h"
 
 #if ENABLED (JERRY_PARSER)
 
@@ -253,6 +254,57 @@ scanner_reverse_info_list (parser_context_t *context_p) /**< context */
   context_p->next_scanner_info_p = last_scanner_info_p;
 } /* scanner_reverse_info_list */
 
+/**
+ * Release a scanner info block which is not part of the scanner info chain anymore.
+ */
+void
+scanner_free_info (scanner_info_t *scanner_info_p) /**< scanner info */
+{
+  size_t size = sizeof (scanner_info_t);
+
+  switch (scanner_info_p->type)
+  {
+    case SCANNER_TYPE_WHILE:
+    case SCANNER_TYPE_FOR_IN:
+#if ENABLED (JERRY_ES2015_FOR_OF)
+    case SCANNER_TYPE_FOR_OF:
+#endif /* ENABLED (JERRY_ES2015_FOR_OF) */
+    case SCANNER_TYPE_CASE:
+    {
+      size = sizeof (scanner_location_info_t);
+      break;
+    }
+    case SCANNER_TYPE_FOR:
+    {
+      size = sizeof (scanner_for_info_t);
+      break;
+    }
+    case SCANNER_TYPE_SWITCH:
+    {
+      scanner_release_switch_cases (((scanner_switch_info_t *) scanner_info_p)->case_p);
+      size = sizeof (scanner_switch_info_t);
+      break;
+    }
+    case SCANNER_TYPE_LAZY_FUNCTION:
+    {
+      size = sizeof (scanner_lazy_info_t);
+      break;
+    }
+    default:
+    {
+#if ENABLED (JERRY_ES2015_ARROW_FUNCTION)
+      JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS
+                    || scanner_info_p->type == SCANNER_TYPE_ARROW);
+#else /* !ENABLED (JERRY_ES2015_ARROW_FUNCTION) */
+      JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS);
+#endif /* ENABLED (JERRY_ES2015_ARROW_FUNCTION) */
+      break;
+    }
+  }
+
+  scanner_free (scanner_info_p, size);
+} /* scanner_free_info */
+
 /**
  * Release unused scanner info blocks.
  * This should happen only if an error is occured.
@@ -271,51 +323,15 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
 
   while (scanner_info_p != NULL)
   {
-    scanner_info_t *next_scanner_info_p = scanner_info_p->next_p;
-
-    size_t size = sizeof (scanner_info_t);
-
-    switch (scanner_info_p->type)
+    if (scanner_info_p->type == SCANNER_TYPE_END)
     {
-      case SCANNER_TYPE_END:
-      {
-        scanner_info_p = context_p->active_scanner_info_p;
-        continue;
-      }
-      case SCANNER_TYPE_WHILE:
-      case SCANNER_TYPE_FOR_IN:
-#if ENABLED (JERRY_ES2015_FOR_OF)
-      case SCANNER_TYPE_FOR_OF:
-#endif /* ENABLED (JERRY_ES2015_FOR_OF) */
-      case SCANNER_TYPE_CASE:
-      {
-        size = sizeof (scanner_location_info_t);
-        break;
-      }
-      case SCANNER_TYPE_FOR:
-      {
-        size = sizeof (scanner_for_info_t);
-        break;
-      }
-      case SCANNER_TYPE_SWITCH:
-      {
-        scanner_release_switch_cases (((scanner_switch_info_t *) scanner_info_p)->case_p);
-        size = sizeof (scanner_switch_info_t);
-        break;
-      }
-      default:
-      {
-#if ENABLED (JERRY_ES2015_ARROW_FUNCTION)
-        JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS
-                      || scanner_info_p->type == SCANNER_TYPE_ARROW);
-#else /* !ENABLED (JERRY_ES2015_ARROW_FUNCTION) */
-        JERRY_ASSERT (scanner_info_p->type == SCANNER_TYPE_END_ARGUMENTS);
-#endif /* ENABLED (JERRY_ES2015_ARROW_FUNCTION) */
-        break;
-      }
+      scanner_info_p = context_p->active_scanner_info_p;
+      continue;
     }
 
-    scanner_free (scanner_info_p, size);
+    scanner_info_t *next_scanner_info_p = scanner_info_p->next_p;
+
+    scanner_free_info (scanner_info_p);
     scanner_info_p = next_scanner_info_p;
   }
 
@@ -323,6 +339,75 @@ scanner_cleanup (parser_context_t *context_p) /**< context */
   context_p->active_scanner_info_p = NULL;
 } /* scanner_cleanup */
 
+/**
+ * Number of bits in the filter of lazily compiled functions.
+ */
+#define SCANNER_LAZY_FILTER_BITS (SCANNER_LAZY_FILTER_WORDS * 32)
+
+/**
+ * Add an identifier to the filter of lazily compiled functions.
+ */
+void
+scanner_lazy_filter_add (uint32_t *filter_p, /**< filter */
+                         const uint8_t *char_p, /**< identifier characters */
+                         size_t length) /**< length of the identifier */
+{
+  lit_string_hash_t hash = lit_utf8_string_calc_hash (char_p, (lit_utf8_size_t) length);
+  uint32_t first_bit = hash % SCANNER_LAZY_FILTER_BITS;
+  uint32_t second_bit = (hash / SCANNER_LAZY_FILTER_BITS) % SCANNER_LAZY_FILTER_BITS;
+
+  filter_p[first_bit >> 5] |= (uint32_t) (1u << (first_bit & 0x1f));
+  filter_p[second_bit >> 5] |= (uint32_t) (1u << (second_bit & 0x1f));
+} /* scanner_lazy_filter_add */
+
+/**
+ * Checks whether an identifier may be used by a lazily compiled function.
+ *
+ * @return true - if the identifier may be used
+ *         false - otherwise
+ */
+bool
+scanner_lazy_filter_contains (const uint32_t *filter_p, /**< filter */
+                              const uint8_t *char_p, /**< identifier characters */
+                              size_t length) /**< length of the identifier */
+{
+  lit_string_hash_t hash = lit_utf8_string_calc_hash (char_p, (lit_utf8_size_t) length);
+  uint32_t first_bit = hash % SCANNER_LAZY_FILTER_BITS;
+  uint32_t second_bit = (hash / SCANNER_LAZY_FILTER_BITS) % SCANNER_LAZY_FILTER_BITS;
+
+  return ((filter_p[first_bit >> 5] & (1u << (first_bit & 0x1f))) != 0
+          && (filter_p[second_bit >> 5] & (1u << (second_bit & 0x1f))) != 0);
+} /* scanner_lazy_filter_contains */
+
+/**
+ * Record the identifier of the current token in the lazily compiled function
+ * whose body is being scanned.
+ */
+void
+scanner_lazy_add_identifier (parser_context_t *context_p) /**< context */
+{
+  scanner_lazy_info_t *lazy_info_p = context_p->scanner_lazy_info_p;
+
+  JERRY_ASSERT (lazy_info_p != NULL && context_p->token.type == LEXER_LITERAL);
+
+  if (context_p->token.lit_location.has_escape)
+  {
+    /* Escape sequences are not resolved by the scanner. */
+    lazy_info_p->flags |= SCANNER_LAZY_REJECTED;
+    return;
+  }
+
+  const uint8_t *char_p = context_p->token.lit_location.char_p;
+  size_t length = context_p->token.lit_location.length;
+
+  if (length == 4 && memcmp (char_p, "eval", 4) == 0)
+  {
+    lazy_info_p->flags |= SCANNER_LAZY_HAS_EVAL;
+  }
+
+  scanner_lazy_filter_add (lazy_info_p->filter, char_p, length);
+} /* scanner_lazy_add_identifier */
+
 /**
  * Get location from context.
  */
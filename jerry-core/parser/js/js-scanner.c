@@ -64,6 +64,7 @@ typedef enum
   SCAN_STACK_FUNCTION_STATEMENT,           /**< function statement */
   SCAN_STACK_FUNCTION_EXPRESSION,          /**< function expression */
   SCAN_STACK_FUNCTION_PROPERTY,            /**< function expression in an object literal or class */
+  SCAN_STACK_LAZY_FUNCTION,                /**< the following function is compiled lazily */
   SCAN_STACK_SWITCH_BLOCK,                 /**< block part of "switch" statement */
   SCAN_STACK_IF_STATEMENT,                 /**< statement part of "if" statements */
   SCAN_STACK_DO_STATEMENT,                 /**< statement part of "do" statements */
@@ -1349,6 +1350,101 @@ scanner_scan_statement (parser_context_t *context_p, /**< context */
   return SCAN_KEEP_TOKEN;
 } /* scanner_scan_statement */
 
+/**
+ * Start scanning the body of a function which can be compiled lazily.
+ *
+ * Note:
+ *      the current token is the opening brace of the body, and the first
+ *      token of the body is the current token after the function returns
+ */
+static void
+scanner_start_lazy_function (parser_context_t *context_p, /**< context */
+                             scanner_context_t *scanner_context_p) /**< scanner context */
+{
+  JERRY_ASSERT (context_p->token.type == LEXER_LEFT_BRACE
+                && context_p->scanner_lazy_info_p == NULL
+                && scanner_context_p->lazy_start_location.source_p != NULL);
+
+  scanner_lazy_info_t *lazy_info_p;
+  lazy_info_p = (scanner_lazy_info_t *) scanner_malloc (context_p, sizeof (scanner_lazy_info_t));
+
+  lazy_info_p->info.source_p = scanner_context_p->lazy_start_location.source_p;
+  lazy_info_p->info.type = SCANNER_TYPE_LAZY_FUNCTION;
+  lazy_info_p->start_location = scanner_context_p->lazy_start_location;
+  lazy_info_p->argument_count = scanner_context_p->lazy_argument_count;
+  lazy_info_p->flags = 0;
+  memset (lazy_info_p->filter, 0, sizeof (lazy_info_p->filter));
+
+  scanner_context_p->lazy_start_location.source_p = NULL;
+  context_p->scanner_lazy_info_p = lazy_info_p;
+
+  lexer_next_token (context_p);
+
+  if (context_p->token.type == LEXER_LITERAL
+      && context_p->token.lit_location.type == LEXER_STRING_LITERAL)
+  {
+    /* The body may start with a directive prologue, which may change the strict
+     * mode of the function. These functions are compiled immediately. */
+    context_p->scanner_lazy_info_p = NULL;
+    scanner_free (lazy_info_p, sizeof (scanner_lazy_info_t));
+    return;
+  }
+
+  uint8_t stack_top = context_p->stack_top_uint8;
+
+  JERRY_ASSERT (stack_top == SCAN_STACK_FUNCTION_STATEMENT
+                || stack_top == SCAN_STACK_FUNCTION_EXPRESSION);
+
+  parser_stack_pop_uint8 (context_p);
+  parser_stack_push_uint8 (context_p, SCAN_STACK_LAZY_FUNCTION);
+  parser_stack_push_uint8 (context_p, stack_top);
+} /* scanner_start_lazy_function */
+
+/**
+ * Finish scanning the body of a function which can be compiled lazily.
+ *
+ * Note:
+ *      the current token is the closing brace of the body
+ */
+static void
+scanner_end_lazy_function (parser_context_t *context_p) /**< context */
+{
+  scanner_lazy_info_t *lazy_info_p = context_p->scanner_lazy_info_p;
+
+  JERRY_ASSERT (context_p->stack_top_uint8 == SCAN_STACK_LAZY_FUNCTION
+                && context_p->token.type == LEXER_RIGHT_BRACE
+                && lazy_info_p != NULL);
+
+  parser_stack_pop_uint8 (context_p);
+  context_p->scanner_lazy_info_p = NULL;
+
+  /* The info blocks of the function body are not needed, since the
+   * body is scanned again when the function is compiled. */
+  scanner_info_t *scanner_info_p = context_p->next_scanner_info_p;
+
+  while (scanner_info_p->source_p > lazy_info_p->info.source_p)
+  {
+    scanner_info_t *next_scanner_info_p = scanner_info_p->next_p;
+
+    scanner_free_info (scanner_info_p);
+    scanner_info_p = next_scanner_info_p;
+  }
+
+  context_p->next_scanner_info_p = scanner_info_p;
+
+  if (lazy_info_p->flags & SCANNER_LAZY_REJECTED)
+  {
+    scanner_free (lazy_info_p, sizeof (scanner_lazy_info_t));
+    return;
+  }
+
+  scanner_get_location (&lazy_info_p->end_location, context_p);
+
+  /* All info blocks after the start of the function are released, so the new block is the first. */
+  lazy_info_p->info.next_p = scanner_info_p;
+  context_p->next_scanner_info_p = &lazy_info_p->info;
+} /* scanner_end_lazy_function */
+
 /**
  * Scan statement terminator.
  *
@@ -1395,6 +1491,12 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
 
         terminator_found = true;
         parser_stack_pop_uint8 (context_p);
+
+        if (context_p->stack_top_uint8 == SCAN_STACK_LAZY_FUNCTION)
+        {
+          scanner_end_lazy_function (context_p);
+        }
+
         lexer_next_token (context_p);
         continue;
       }
@@ -1407,6 +1509,11 @@ scanner_scan_statement_end (parser_context_t *context_p, /**< context */
 
         scanner_context_p->mode = SCAN_MODE_POST_PRIMARY_EXPRESSION;
         parser_stack_pop_uint8 (context_p);
+
+        if (context_p->stack_top_uint8 == SCAN_STACK_LAZY_FUNCTION)
+        {
+          scanner_end_lazy_function (context_p);
+        }
         return SCAN_NEXT_TOKEN;
       }
       case SCAN_STACK_FUNCTION_PROPERTY:
@@ -1607,16 +1714,30 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 #endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
 
   scanner_context.active_switch_statement.last_case_p = NULL;
+  scanner_context.lazy_start_location.source_p = NULL;
 
   parser_stack_init (context_p);
 
   PARSER_TRY (context_p->try_buffer)
   {
-    context_p->line = 1;
-    context_p->column = 1;
+    if (arg_list_p == NULL && (context_p->status_flags & PARSER_IS_FUNCTION))
+    {
+      /* Compiling a lazy function: the line and column are set by the caller. */
+      JERRY_ASSERT (context_p->lazy_source_p != NULL);
 
-    if (arg_list_p == NULL)
+      context_p->source_p = source_p;
+      context_p->source_end_p = source_end_p;
+
+      scanner_context.mode = SCAN_MODE_FUNCTION_ARGUMENTS;
+      parser_stack_push_uint8 (context_p, SCAN_STACK_SCRIPT);
+      parser_stack_push_uint8 (context_p, SCAN_STACK_FUNCTION_STATEMENT);
+
+      lexer_next_token (context_p);
+    }
+    else if (arg_list_p == NULL)
     {
+      context_p->line = 1;
+      context_p->column = 1;
       context_p->source_p = source_p;
       context_p->source_end_p = source_end_p;
 
@@ -1627,6 +1748,8 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
     }
     else
     {
+      context_p->line = 1;
+      context_p->column = 1;
       context_p->source_p = arg_list_p;
       context_p->source_end_p = arg_list_end_p;
       scanner_context.mode = SCAN_MODE_FUNCTION_ARGUMENTS;
@@ -1837,6 +1960,21 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
           {
             scanner_raise_error (context_p);
           }
+
+          /* Only the function statements and expressions of the source code are compiled lazily. The
+           * function which starts at the beginning of the source is the lazy function being compiled. */
+          if ((stack_top == SCAN_STACK_FUNCTION_STATEMENT || stack_top == SCAN_STACK_FUNCTION_EXPRESSION)
+              && context_p->lazy_source_p != NULL
+              && context_p->scanner_lazy_info_p == NULL
+              && context_p->source_end_p == source_end_p
+              && context_p->source_p - 1 != source_p)
+          {
+            scanner_context.lazy_start_location.source_p = context_p->source_p - 1;
+            scanner_context.lazy_start_location.line = context_p->token.line;
+            scanner_context.lazy_start_location.column = context_p->token.column;
+            scanner_context.lazy_argument_count = 0;
+          }
+
           lexer_next_token (context_p);
 
 #if ENABLED (JERRY_ES2015_FUNCTION_PARAMETER_INITIALIZER)
@@ -1853,6 +1991,7 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 #if ENABLED (JERRY_ES2015_FUNCTION_REST_PARAMETER)
               if (context_p->token.type == LEXER_THREE_DOTS)
               {
+                scanner_context.lazy_start_location.source_p = NULL;
                 lexer_next_token (context_p);
               }
 #endif /* ENABLED (JERRY_ES2015_FUNCTION_REST_PARAMETER) */
@@ -1862,6 +2001,12 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
               {
                 scanner_raise_error (context_p);
               }
+
+              if (++scanner_context.lazy_argument_count > CBC_MAXIMUM_BYTE_VALUE)
+              {
+                scanner_context.lazy_start_location.source_p = NULL;
+              }
+
               lexer_next_token (context_p);
 
               if (context_p->token.type != LEXER_COMMA)
@@ -1875,6 +2020,7 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
 #if ENABLED (JERRY_ES2015_FUNCTION_PARAMETER_INITIALIZER)
           if (context_p->token.type == LEXER_ASSIGN)
           {
+            scanner_context.lazy_start_location.source_p = NULL;
             parser_stack_push_uint8 (context_p, SCAN_STACK_FUNCTION_PARAMETERS);
             scanner_context.mode = SCAN_MODE_PRIMARY_EXPRESSION;
             break;
@@ -1912,6 +2058,12 @@ scanner_scan_all (parser_context_t *context_p, /**< context */
             scanner_raise_error (context_p);
           }
           scanner_context.mode = SCAN_MODE_STATEMENT_OR_TERMINATOR;
+
+          if (scanner_context.lazy_start_location.source_p != NULL)
+          {
+            scanner_start_lazy_function (context_p, &scanner_context);
+            continue;
+          }
           break;
         }
         case SCAN_MODE_PROPERTY_NAME:
@@ -2037,6 +2189,12 @@ scan_completed:
   }
   PARSER_CATCH
   {
+    if (context_p->scanner_lazy_info_p != NULL)
+    {
+      scanner_free (context_p->scanner_lazy_info_p, sizeof (scanner_lazy_info_t));
+      context_p->scanner_lazy_info_p = NULL;
+    }
+
     /* Ignore the errors thrown by the lexer. */
     if (context_p->error != PARSER_ERR_OUT_OF_MEMORY)
     {
@@ -2130,6 +2288,18 @@ scan_completed:
           break;
         }
 #endif /* ENABLED (JERRY_ES2015_ARROW_FUNCTION) */
+        case SCANNER_TYPE_LAZY_FUNCTION:
+        {
+          scanner_lazy_info_t *lazy_info_p = (scanner_lazy_info_t *) info_p;
+          JERRY_DEBUG_MSG ("  LAZY_FUNCTION: source:%d end:%d[%d:%d] arguments:%d%s\n",
+                           (int) (lazy_info_p->info.source_p - source_start_p),
+                           (int) (lazy_info_p->end_location.source_p - source_start_p),
+                           (int) lazy_info_p->end_location.line,
+                           (int) lazy_info_p->end_location.column,
+                           (int) lazy_info_p->argument_count,
+                           (lazy_info_p->flags & SCANNER_LAZY_HAS_EVAL) ? " eval" : "");
+          break;
+        }
       }
 
       if (print_location)
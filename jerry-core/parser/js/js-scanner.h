@@ -45,6 +45,7 @@ typedef enum
 #if ENABLED (JERRY_ES2015_ARROW_FUNCTION)
   SCANNER_TYPE_ARROW, /**< arrow function */
 #endif /* ENABLED (JERRY_ES2015_ARROW_FUNCTION) */
+  SCANNER_TYPE_LAZY_FUNCTION, /**< function whose compilation is delayed until its first call */
 } scanner_info_type_t;
 
 /**
@@ -104,6 +105,37 @@ typedef struct
   scanner_case_info_t *case_p; /**< list of switch cases */
 } scanner_switch_info_t;
 
+/**
+ * Number of 32 bit words in the identifier filter of lazily compiled functions.
+ */
+#define SCANNER_LAZY_FILTER_WORDS 16
+
+/**
+ * Flags of lazily compiled functions.
+ */
+typedef enum
+{
+  SCANNER_LAZY_HAS_EVAL = (1u << 0), /**< the function body contains an eval identifier */
+  SCANNER_LAZY_REJECTED = (1u << 1), /**< the function must be compiled immediately */
+} scanner_lazy_flags_t;
+
+/**
+ * Scanner info for functions whose compilation is delayed until their first call.
+ *
+ * Instead of the exact list of the free variables, the identifiers of the function
+ * are stored in a bloom filter: the variables of the enclosing functions which may
+ * be accessed by the lazily compiled function cannot be stored in registers.
+ */
+typedef struct
+{
+  scanner_info_t info; /**< header */
+  scanner_location_t start_location; /**< location of the opening bracket of the argument list */
+  scanner_location_t end_location; /**< location after the closing brace of the function body */
+  uint16_t argument_count; /**< number of arguments */
+  uint8_t flags; /**< scanner_lazy_flags_t flags */
+  uint32_t filter[SCANNER_LAZY_FILTER_WORDS]; /**< bloom filter of the identifiers of the function */
+} scanner_lazy_info_t;
+
 /**
  * @}
  * @}
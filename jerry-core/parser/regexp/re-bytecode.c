@@ -244,6 +244,40 @@ re_append_jump_offset (re_bytecode_ctx_t *bc_ctx_p, /**< RegExp bytecode context
   re_append_u32 (bc_ctx_p, value);
 } /* re_append_jump_offset */
 
+/**
+ * Append a block of raw data to the RegExp bytecode, aligned to 4 bytes
+ *
+ * @return offset of the data from the start of the RegExp bytecode
+ */
+uint32_t
+re_append_aligned_data (re_bytecode_ctx_t *bc_ctx_p, /**< RegExp bytecode context */
+                        const void *data_p, /**< data */
+                        size_t size) /**< size of the data */
+{
+  const size_t bytecode_size = (size_t) (bc_ctx_p->current_p - bc_ctx_p->block_start_p);
+  const size_t padding = JERRY_ALIGNUP (bytecode_size, sizeof (uint32_t)) - bytecode_size;
+
+  if (padding > 0)
+  {
+    memset (re_bytecode_reserve (bc_ctx_p, padding), 0, padding);
+  }
+
+  const uint32_t offset = (uint32_t) (bytecode_size + padding);
+  const uint8_t *src_p = (const uint8_t *) data_p;
+
+  while (size > 0)
+  {
+    const size_t chunk_size = JERRY_MIN (size, REGEXP_BYTECODE_BLOCK_SIZE);
+    uint8_t *dest_p = re_bytecode_reserve (bc_ctx_p, chunk_size);
+
+    memcpy (dest_p, src_p, chunk_size);
+    src_p += chunk_size;
+    size -= chunk_size;
+  }
+
+  return offset;
+} /* re_append_aligned_data */
+
 /**
  * Insert a RegExp opcode
  */
@@ -469,6 +503,48 @@ re_dump_bytecode (re_bytecode_ctx_t *bc_ctx_p) /**< RegExp bytecode context */
     }
   }
   JERRY_DEBUG_MSG ("EOF\n");
+
+  if (compiled_code_p->prefilter_offset != 0)
+  {
+    const re_prefilter_t *prefilter_p;
+    prefilter_p = (const re_prefilter_t *) (bc_ctx_p->block_start_p + compiled_code_p->prefilter_offset);
+
+    JERRY_DEBUG_MSG ("Prefilter: prefix size %d, first bytes", (int) prefilter_p->prefix_size);
+
+    for (uint32_t i = 0; i < 256 / 32; i++)
+    {
+      JERRY_DEBUG_MSG (" %08x", (unsigned int) prefilter_p->first_bytes[i]);
+    }
+
+    JERRY_DEBUG_MSG ("\n");
+  }
+
+  if (compiled_code_p->linear_length == 0)
+  {
+    return;
+  }
+
+  static const char * const linear_opcode_names[] =
+  {
+    "CHAR", "PERIOD", "CHAR_CLASS", "INV_CHAR_CLASS", "MATCH", "JUMP", "SPLIT", "SPLIT_LAZY", "SAVE",
+    "ASSERT_START", "ASSERT_END", "ASSERT_WORD_BOUNDARY", "ASSERT_NOT_WORD_BOUNDARY"
+  };
+
+  const re_linear_instruction_t *instruction_p;
+  instruction_p = (const re_linear_instruction_t *) (bc_ctx_p->block_start_p + compiled_code_p->linear_offset);
+
+  JERRY_DEBUG_MSG ("Linear program: ");
+
+  for (uint32_t i = 0; i < compiled_code_p->linear_length; i++, instruction_p++)
+  {
+    JERRY_DEBUG_MSG ("%d: %s %d %d, ",
+                     (int) i,
+                     linear_opcode_names[instruction_p->opcode],
+                     (int) instruction_p->argument,
+                     (int) instruction_p->target);
+  }
+
+  JERRY_DEBUG_MSG ("\n");
 } /* re_dump_bytecode */
 #endif /* ENABLED (JERRY_REGEXP_DUMP_BYTE_CODE) */
 
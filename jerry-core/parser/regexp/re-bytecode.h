@@ -33,7 +33,17 @@
 /**
   * Size of the RegExp bytecode cache
   */
-#define RE_CACHE_SIZE 8u
+#define RE_CACHE_SIZE ((uint32_t) JERRY_REGEXP_CACHE_SIZE)
+
+/**
+  * Number of entries in a RegExp bytecode cache set
+  */
+#define RE_CACHE_WAYS (RE_CACHE_SIZE < 4 ? RE_CACHE_SIZE : 4u)
+
+/**
+  * Number of sets in the RegExp bytecode cache
+  */
+#define RE_CACHE_SETS (RE_CACHE_SIZE / RE_CACHE_WAYS)
 
 /**
   * RegExp flags mask (first 10 bits are for reference count and the rest for the actual RegExp flags)
@@ -79,6 +89,82 @@ typedef enum
   RE_OP_INV_CHAR_CLASS                            /**< "[^ ]" */
 } re_opcode_t;
 
+/**
+ * Check if a RegExp opcode is a capture group or not
+ */
+#define RE_IS_CAPTURE_GROUP(x) (((x) < RE_OP_NON_CAPTURE_GROUP_START) ? 1 : 0)
+
+/**
+ * Check if a RegExp opcode is a zero-width assertion (except lookaheads)
+ */
+#define RE_IS_ASSERTION(x) ((x) >= RE_OP_ASSERT_START && (x) <= RE_OP_ASSERT_NOT_WORD_BOUNDARY)
+
+/**
+ * Maximum size of the literal prefix of a prefilter in bytes
+ */
+#define RE_PREFILTER_MAX_PREFIX 12u
+
+/**
+ * Prefilter which finds the possible start positions of a match.
+ *
+ * Every match starts with the literal prefix (if its size is not zero), and the
+ * first byte of every match is in the first byte set.
+ */
+typedef struct
+{
+  uint32_t first_bytes[256 / 32];                 /**< bit set of the first bytes (CESU-8) of the matches */
+  uint8_t prefix_size;                            /**< size of the literal prefix */
+  uint8_t prefix[RE_PREFILTER_MAX_PREFIX];        /**< literal prefix (CESU-8) */
+} re_prefilter_t;
+
+/**
+ * Maximum number of instructions of a linear program
+ */
+#define RE_LINEAR_MAX_INSTRUCTIONS 256u
+
+/**
+ * Maximum number of capture slots of all threads of a linear program
+ * (number of instructions multiplied by the number of capture slots)
+ */
+#define RE_LINEAR_MAX_THREAD_SLOTS 2048u
+
+/**
+ * Opcodes of the linear program.
+ *
+ * Patterns without backreferences and lookaheads are also compiled to a linear program,
+ * which is executed by a backtracking free matcher (Pike VM). Its running time is linear
+ * in the length of the input, regardless of the pattern.
+ */
+typedef enum
+{
+  /* Opcodes which consume a character. */
+  RE_LINEAR_CHAR,                                 /**< match a character */
+  RE_LINEAR_PERIOD,                               /**< match any character except line terminators */
+  RE_LINEAR_CHAR_CLASS,                           /**< match a character class */
+  RE_LINEAR_INV_CHAR_CLASS,                       /**< match an inverted character class */
+  RE_LINEAR_MATCH,                                /**< the pattern is matched */
+  /* Opcodes which are executed without consuming a character. */
+  RE_LINEAR_JUMP,                                 /**< continue at the target */
+  RE_LINEAR_SPLIT,                                /**< continue at the next instruction, then at the target */
+  RE_LINEAR_SPLIT_LAZY,                           /**< continue at the target, then at the next instruction */
+  RE_LINEAR_SAVE,                                 /**< store the current position in a capture slot */
+  RE_LINEAR_ASSERT_START,                         /**< "^" */
+  RE_LINEAR_ASSERT_END,                           /**< "$" */
+  RE_LINEAR_ASSERT_WORD_BOUNDARY,                 /**< "\b" */
+  RE_LINEAR_ASSERT_NOT_WORD_BOUNDARY              /**< "\B" */
+} re_linear_opcode_t;
+
+/**
+ * Instruction of the linear program.
+ */
+typedef struct
+{
+  uint16_t opcode;                   /**< re_linear_opcode_t */
+  uint16_t argument;                 /**< character of RE_LINEAR_CHAR or slot index of RE_LINEAR_SAVE */
+  uint32_t target;                   /**< jump target, or the offset of the character class ranges
+                                      *   from the start of the RegExp bytecode */
+} re_linear_instruction_t;
+
 /**
  * Compiled byte code data.
  */
@@ -88,6 +174,11 @@ typedef struct
   ecma_value_t source;               /**< original RegExp pattern */
   uint32_t captures_count;           /**< number of capturing brackets */
   uint32_t non_captures_count;       /**< number of non capturing brackets */
+  uint32_t linear_offset;            /**< offset of the linear program from the start of the RegExp bytecode */
+  uint32_t linear_length;            /**< number of instructions of the linear program
+                                      *   (0 if the pattern can only be matched by backtracking) */
+  uint32_t prefilter_offset;         /**< offset of the re_prefilter_t from the start of the RegExp bytecode
+                                      *   (0 if every position can be the start of a match) */
 } re_compiled_code_t;
 
 /**
@@ -111,6 +202,7 @@ void re_append_opcode (re_bytecode_ctx_t *bc_ctx_p, const re_opcode_t opcode);
 void re_append_u32 (re_bytecode_ctx_t *bc_ctx_p, const uint32_t value);
 void re_append_char (re_bytecode_ctx_t *bc_ctx_p, const ecma_char_t input_char);
 void re_append_jump_offset (re_bytecode_ctx_t *bc_ctx_p, uint32_t value);
+uint32_t re_append_aligned_data (re_bytecode_ctx_t *bc_ctx_p, const void *data_p, size_t size);
 
 void re_insert_opcode (re_bytecode_ctx_t *bc_ctx_p, const uint32_t offset, const re_opcode_t opcode);
 void re_insert_u32 (re_bytecode_ctx_t *bc_ctx_p, const uint32_t offset, const uint32_t value);
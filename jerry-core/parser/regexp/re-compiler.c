@@ -715,19 +715,876 @@ re_parse_alternative (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context
   return ret_value;
 } /* re_parse_alternative */
 
+/**
+ * Context of the linear program compiler
+ */
+typedef struct
+{
+  const uint8_t *bytecode_start_p;   /**< start of the RegExp bytecode */
+  re_linear_instruction_t *program_p; /**< instruction buffer */
+  uint32_t length;                   /**< number of instructions (RE_LINEAR_MAX_INSTRUCTIONS + 1 on overflow) */
+} re_linear_ctx_t;
+
+/**
+ * A term of an alternative with its quantifier
+ */
+typedef struct
+{
+  const uint8_t *body_p;             /**< start of the atom, or the alternatives of a group */
+  const uint8_t *next_p;             /**< bytecode after the term */
+  uint32_t min;                      /**< minimum number of iterations */
+  uint32_t max;                      /**< maximum number of iterations */
+  uint32_t capture_idx;              /**< index of the capture group, 0 if the term is not a capture group */
+  bool is_group;                     /**< the term is a group */
+  bool is_greedy;                    /**< the quantifier is greedy */
+} re_term_t;
+
+/**
+ * Skip the alternatives of a group or a pattern
+ *
+ * @return pointer to the opcode after the last alternative
+ */
+static const uint8_t *
+re_skip_alternatives (const uint8_t *bc_p) /**< start of the alternatives */
+{
+  while (true)
+  {
+    const uint32_t length = re_get_value (&bc_p);
+    bc_p += length;
+
+    if (*bc_p != RE_OP_ALTERNATIVE)
+    {
+      return bc_p;
+    }
+
+    bc_p++;
+  }
+} /* re_skip_alternatives */
+
+/**
+ * Decode the next term of an alternative
+ *
+ * @return true - if successful
+ *         false - for backreferences and lookaheads
+ */
+static bool
+re_decode_term (const uint8_t *bc_p, /**< start of the term */
+                re_term_t *term_p) /**< [out] decoded term */
+{
+  term_p->body_p = bc_p;
+  term_p->min = 1;
+  term_p->max = 1;
+  term_p->capture_idx = 0;
+  term_p->is_group = false;
+  term_p->is_greedy = true;
+
+  const re_opcode_t op = re_get_opcode (&bc_p);
+
+  switch (op)
+  {
+    case RE_OP_CHAR:
+    {
+      term_p->next_p = bc_p + sizeof (ecma_char_t);
+      return true;
+    }
+    case RE_OP_CHAR_CLASS:
+    case RE_OP_INV_CHAR_CLASS:
+    {
+      const uint32_t range_count = re_get_value (&bc_p);
+      term_p->next_p = bc_p + range_count * 2 * sizeof (ecma_char_t);
+      return true;
+    }
+    case RE_OP_PERIOD:
+    case RE_OP_ASSERT_START:
+    case RE_OP_ASSERT_END:
+    case RE_OP_ASSERT_WORD_BOUNDARY:
+    case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+    {
+      term_p->next_p = bc_p;
+      return true;
+    }
+    case RE_OP_GREEDY_ITERATOR:
+    case RE_OP_NON_GREEDY_ITERATOR:
+    {
+      term_p->min = re_get_value (&bc_p);
+      term_p->max = re_get_value (&bc_p);
+      const uint32_t length = re_get_value (&bc_p);
+
+      term_p->body_p = bc_p;
+      term_p->next_p = bc_p + length;
+      term_p->is_greedy = (op == RE_OP_GREEDY_ITERATOR);
+      return true;
+    }
+    case RE_OP_CAPTURE_GROUP_START:
+    case RE_OP_CAPTURE_GREEDY_ZERO_GROUP_START:
+    case RE_OP_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+    case RE_OP_NON_CAPTURE_GROUP_START:
+    case RE_OP_NON_CAPTURE_GREEDY_ZERO_GROUP_START:
+    case RE_OP_NON_CAPTURE_NON_GREEDY_ZERO_GROUP_START:
+    {
+      const uint32_t idx = re_get_value (&bc_p);
+
+      if (op != RE_OP_CAPTURE_GROUP_START && op != RE_OP_NON_CAPTURE_GROUP_START)
+      {
+        re_get_value (&bc_p); /* end offset */
+      }
+
+      term_p->body_p = bc_p;
+      bc_p = re_skip_alternatives (bc_p);
+
+      const re_opcode_t end_op = re_get_opcode (&bc_p);
+      JERRY_ASSERT (end_op >= RE_OP_CAPTURE_GREEDY_GROUP_END && end_op <= RE_OP_NON_CAPTURE_NON_GREEDY_GROUP_END);
+
+      re_get_value (&bc_p); /* group index */
+      term_p->min = re_get_value (&bc_p);
+      term_p->max = re_get_value (&bc_p);
+      re_get_value (&bc_p); /* start offset */
+
+      term_p->next_p = bc_p;
+      term_p->capture_idx = RE_IS_CAPTURE_GROUP (op) ? idx : 0;
+      term_p->is_group = true;
+      term_p->is_greedy = (end_op == RE_OP_CAPTURE_GREEDY_GROUP_END || end_op == RE_OP_NON_CAPTURE_GREEDY_GROUP_END);
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* re_decode_term */
+
+/**
+ * Checks whether any of the alternatives can match an empty string
+ *
+ * @return true - if an empty match is possible
+ *         false - otherwise
+ */
+static bool
+re_is_nullable (const uint8_t *bc_p) /**< start of the alternatives */
+{
+#if (JERRY_STACK_LIMIT != 0)
+  if (JERRY_UNLIKELY (ecma_get_current_stack_usage () > CONFIG_MEM_STACK_LIMIT))
+  {
+    return true;
+  }
+#endif /* JERRY_STACK_LIMIT != 0 */
+
+  while (true)
+  {
+    const uint32_t length = re_get_value (&bc_p);
+    const uint8_t *const end_p = bc_p + length;
+    bool is_nullable = true;
+
+    while (bc_p < end_p && is_nullable)
+    {
+      re_term_t term;
+
+      if (!re_decode_term (bc_p, &term))
+      {
+        return true;
+      }
+
+      if (term.min > 0)
+      {
+        if (term.is_group)
+        {
+          is_nullable = re_is_nullable (term.body_p);
+        }
+        else
+        {
+          re_opcode_t op = (re_opcode_t) *term.body_p;
+          is_nullable = RE_IS_ASSERTION (op);
+        }
+      }
+
+      bc_p = term.next_p;
+    }
+
+    if (is_nullable)
+    {
+      return true;
+    }
+
+    bc_p = end_p;
+
+    if (*bc_p != RE_OP_ALTERNATIVE)
+    {
+      return false;
+    }
+
+    bc_p++;
+  }
+} /* re_is_nullable */
+
+/**
+ * Append an instruction to the linear program
+ *
+ * @return index of the instruction
+ */
+static uint32_t
+re_linear_emit (re_linear_ctx_t *ctx_p, /**< linear program compiler context */
+                re_linear_opcode_t opcode, /**< opcode */
+                uint32_t argument, /**< argument */
+                uint32_t target) /**< target */
+{
+  uint32_t idx = ctx_p->length;
+
+  if (idx < RE_LINEAR_MAX_INSTRUCTIONS)
+  {
+    ctx_p->length++;
+  }
+  else
+  {
+    /* The last item of the buffer is a scratch area after an overflow. */
+    idx = RE_LINEAR_MAX_INSTRUCTIONS;
+    ctx_p->length = RE_LINEAR_MAX_INSTRUCTIONS + 1;
+  }
+
+  JERRY_ASSERT (argument <= UINT16_MAX);
+
+  re_linear_instruction_t *instruction_p = ctx_p->program_p + idx;
+  instruction_p->opcode = (uint16_t) opcode;
+  instruction_p->argument = (uint16_t) argument;
+  instruction_p->target = target;
+  return idx;
+} /* re_linear_emit */
+
+static bool re_linear_compile_alternatives (re_linear_ctx_t *ctx_p, const uint8_t *bc_p);
+
+/**
+ * Compile a single iteration of a term to the linear program
+ *
+ * @return true - if successful
+ *         false - otherwise
+ */
+static bool
+re_linear_compile_iteration (re_linear_ctx_t *ctx_p, /**< linear program compiler context */
+                             const re_term_t *term_p) /**< term */
+{
+  if (term_p->is_group)
+  {
+    if (term_p->capture_idx != 0)
+    {
+      re_linear_emit (ctx_p, RE_LINEAR_SAVE, term_p->capture_idx * 2, 0);
+    }
+
+    if (!re_linear_compile_alternatives (ctx_p, term_p->body_p))
+    {
+      return false;
+    }
+
+    if (term_p->capture_idx != 0)
+    {
+      re_linear_emit (ctx_p, RE_LINEAR_SAVE, term_p->capture_idx * 2 + 1, 0);
+    }
+
+    return true;
+  }
+
+  const uint8_t *bc_p = term_p->body_p;
+
+  switch (re_get_opcode (&bc_p))
+  {
+    case RE_OP_CHAR:
+    {
+      re_linear_emit (ctx_p, RE_LINEAR_CHAR, re_get_char (&bc_p), 0);
+      break;
+    }
+    case RE_OP_PERIOD:
+    {
+      re_linear_emit (ctx_p, RE_LINEAR_PERIOD, 0, 0);
+      break;
+    }
+    case RE_OP_CHAR_CLASS:
+    case RE_OP_INV_CHAR_CLASS:
+    {
+      re_linear_opcode_t opcode = ((*term_p->body_p == RE_OP_CHAR_CLASS) ? RE_LINEAR_CHAR_CLASS
+                                                                          : RE_LINEAR_INV_CHAR_CLASS);
+      re_linear_emit (ctx_p, opcode, 0, (uint32_t) (bc_p - ctx_p->bytecode_start_p));
+      break;
+    }
+    case RE_OP_ASSERT_START:
+    {
+      re_linear_emit (ctx_p, RE_LINEAR_ASSERT_START, 0, 0);
+      break;
+    }
+    case RE_OP_ASSERT_END:
+    {
+      re_linear_emit (ctx_p, RE_LINEAR_ASSERT_END, 0, 0);
+      break;
+    }
+    case RE_OP_ASSERT_WORD_BOUNDARY:
+    {
+      re_linear_emit (ctx_p, RE_LINEAR_ASSERT_WORD_BOUNDARY, 0, 0);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (*term_p->body_p == RE_OP_ASSERT_NOT_WORD_BOUNDARY);
+      re_linear_emit (ctx_p, RE_LINEAR_ASSERT_NOT_WORD_BOUNDARY, 0, 0);
+      break;
+    }
+  }
+
+  return true;
+} /* re_linear_compile_iteration */
+
+/**
+ * Compile a term with its quantifier to the linear program
+ *
+ * The iterations are unrolled, only the infinite tail of the quantifier is compiled to a loop.
+ *
+ * @return true - if successful
+ *         false - otherwise
+ */
+static bool
+re_linear_compile_term (re_linear_ctx_t *ctx_p, /**< linear program compiler context */
+                        const re_term_t *term_p) /**< term */
+{
+  /* Iterations of empty groups produce no instructions, so the length limit is not enough. */
+  if (term_p->min > RE_LINEAR_MAX_INSTRUCTIONS
+      || (term_p->max != RE_ITERATOR_INFINITE && term_p->max > RE_LINEAR_MAX_INSTRUCTIONS))
+  {
+    return false;
+  }
+
+  if (term_p->capture_idx != 0 && term_p->min == 0)
+  {
+    /* The backtracking matcher sets the start of a capture
+     * group even if zero iterations are matched. */
+    re_linear_emit (ctx_p, RE_LINEAR_SAVE, term_p->capture_idx * 2, 0);
+  }
+
+  for (uint32_t i = 0; i < term_p->min; i++)
+  {
+    if (ctx_p->length > RE_LINEAR_MAX_INSTRUCTIONS
+        || !re_linear_compile_iteration (ctx_p, term_p))
+    {
+      return false;
+    }
+  }
+
+  if (term_p->max == term_p->min)
+  {
+    return true;
+  }
+
+  /* Empty iterations must fail, which depends on the path of a thread, not only on its position.
+   * Without nullable iterations a thread reaching an instruction at the same position as a higher
+   * priority thread cannot produce a better match, so it can be dropped by the matcher. */
+  if (term_p->is_group ? re_is_nullable (term_p->body_p) : RE_IS_ASSERTION (*term_p->body_p))
+  {
+    return false;
+  }
+
+  const re_linear_opcode_t split_opcode = term_p->is_greedy ? RE_LINEAR_SPLIT : RE_LINEAR_SPLIT_LAZY;
+
+  if (term_p->max == RE_ITERATOR_INFINITE)
+  {
+    const uint32_t loop_start = re_linear_emit (ctx_p, split_opcode, 0, 0);
+
+    if (!re_linear_compile_iteration (ctx_p, term_p))
+    {
+      return false;
+    }
+
+    re_linear_emit (ctx_p, RE_LINEAR_JUMP, 0, loop_start);
+    ctx_p->program_p[loop_start].target = ctx_p->length;
+    return true;
+  }
+
+  uint32_t first_split = ctx_p->length;
+
+  for (uint32_t i = term_p->min; i < term_p->max; i++)
+  {
+    if (ctx_p->length > RE_LINEAR_MAX_INSTRUCTIONS)
+    {
+      return false;
+    }
+
+    re_linear_emit (ctx_p, split_opcode, 0, 0);
+
+    if (!re_linear_compile_iteration (ctx_p, term_p))
+    {
+      return false;
+    }
+  }
+
+  if (ctx_p->length > RE_LINEAR_MAX_INSTRUCTIONS)
+  {
+    return false;
+  }
+
+  /* All optional iterations continue after the last iteration when they are skipped. */
+  for (uint32_t i = first_split; i < ctx_p->length; i++)
+  {
+    if (ctx_p->program_p[i].opcode == split_opcode && ctx_p->program_p[i].target == 0)
+    {
+      ctx_p->program_p[i].target = ctx_p->length;
+    }
+  }
+
+  return true;
+} /* re_linear_compile_term */
+
+/**
+ * Compile the alternatives of a group or a pattern to the linear program
+ *
+ * @return true - if successful
+ *         false - otherwise
+ */
+static bool
+re_linear_compile_alternatives (re_linear_ctx_t *ctx_p, /**< linear program compiler context */
+                                const uint8_t *bc_p) /**< start of the alternatives */
+{
+#if (JERRY_STACK_LIMIT != 0)
+  if (JERRY_UNLIKELY (ecma_get_current_stack_usage () > CONFIG_MEM_STACK_LIMIT))
+  {
+    return false;
+  }
+#endif /* JERRY_STACK_LIMIT != 0 */
+
+  /* The jumps to the end of the alternatives are chained through their targets. */
+  uint32_t jump_chain = 0;
+
+  while (true)
+  {
+    const uint32_t length = re_get_value (&bc_p);
+    const uint8_t *const end_p = bc_p + length;
+    const bool has_next = (*end_p == RE_OP_ALTERNATIVE);
+    uint32_t split = 0;
+
+    if (has_next)
+    {
+      split = re_linear_emit (ctx_p, RE_LINEAR_SPLIT, 0, 0);
+    }
+
+    while (bc_p < end_p)
+    {
+      re_term_t term;
+
+      if (ctx_p->length > RE_LINEAR_MAX_INSTRUCTIONS
+          || !re_decode_term (bc_p, &term)
+          || !re_linear_compile_term (ctx_p, &term))
+      {
+        return false;
+      }
+
+      bc_p = term.next_p;
+    }
+
+    if (!has_next)
+    {
+      break;
+    }
+
+    jump_chain = re_linear_emit (ctx_p, RE_LINEAR_JUMP, 0, jump_chain);
+
+    if (ctx_p->length > RE_LINEAR_MAX_INSTRUCTIONS)
+    {
+      return false;
+    }
+
+    ctx_p->program_p[split].target = ctx_p->length;
+    bc_p = end_p + 1;
+  }
+
+  if (ctx_p->length > RE_LINEAR_MAX_INSTRUCTIONS)
+  {
+    return false;
+  }
+
+  while (jump_chain != 0)
+  {
+    const uint32_t next = ctx_p->program_p[jump_chain].target;
+    ctx_p->program_p[jump_chain].target = ctx_p->length;
+    jump_chain = next;
+  }
+
+  return true;
+} /* re_linear_compile_alternatives */
+
+/**
+ * Compile a linear program from the RegExp bytecode and append it to the bytecode
+ *
+ * The program is executed by a breadth-first matcher in linear time. Patterns which
+ * contain backreferences or lookaheads, and too large patterns are only matched
+ * by the backtracking matcher.
+ */
+static void
+re_compile_linear_program (re_bytecode_ctx_t *bc_ctx_p) /**< RegExp bytecode context */
+{
+  re_compiled_code_t *re_compiled_code_p = (re_compiled_code_t *) bc_ctx_p->block_start_p;
+  re_compiled_code_p->linear_offset = 0;
+  re_compiled_code_p->linear_length = 0;
+
+  const size_t program_size = (RE_LINEAR_MAX_INSTRUCTIONS + 1) * sizeof (re_linear_instruction_t);
+  re_linear_ctx_t ctx;
+
+  ctx.bytecode_start_p = bc_ctx_p->block_start_p;
+  ctx.program_p = (re_linear_instruction_t *) jmem_heap_alloc_block (program_size);
+  ctx.length = 0;
+
+  const uint8_t *bc_p = bc_ctx_p->block_start_p + sizeof (re_compiled_code_t);
+  JERRY_ASSERT (*bc_p == RE_OP_SAVE_AT_START);
+  bc_p++;
+
+  re_linear_emit (&ctx, RE_LINEAR_SAVE, 0, 0);
+  bool is_linear = re_linear_compile_alternatives (&ctx, bc_p);
+
+  if (is_linear)
+  {
+    re_linear_emit (&ctx, RE_LINEAR_SAVE, 1, 0);
+    re_linear_emit (&ctx, RE_LINEAR_MATCH, 0, 0);
+
+    /* Each thread of the matcher keeps its own copy of the capture slots. */
+    const uint32_t slot_count = re_compiled_code_p->captures_count * 2;
+    is_linear = (ctx.length <= RE_LINEAR_MAX_INSTRUCTIONS
+                 && ctx.length * slot_count <= RE_LINEAR_MAX_THREAD_SLOTS);
+  }
+
+  if (is_linear)
+  {
+    const uint32_t linear_offset = re_append_aligned_data (bc_ctx_p,
+                                                           ctx.program_p,
+                                                           ctx.length * sizeof (re_linear_instruction_t));
+
+    /* The bytecode might be reallocated. */
+    re_compiled_code_p = (re_compiled_code_t *) bc_ctx_p->block_start_p;
+    re_compiled_code_p->linear_offset = linear_offset;
+    re_compiled_code_p->linear_length = ctx.length;
+  }
+
+  jmem_heap_free_block (ctx.program_p, program_size);
+} /* re_compile_linear_program */
+
+/**
+ * Add all non-ASCII characters to the first byte set of a prefilter
+ */
+static void
+re_prefilter_add_non_ascii (re_prefilter_t *prefilter_p) /**< prefilter */
+{
+  /* Lead bytes of the multi-byte sequences. */
+  prefilter_p->first_bytes[6] = UINT32_MAX;
+  prefilter_p->first_bytes[7] = UINT32_MAX;
+} /* re_prefilter_add_non_ascii */
+
+/**
+ * Add the first bytes of the characters matched by an atom to the first byte set of a prefilter
+ */
+static void
+re_prefilter_add_atom (re_prefilter_t *prefilter_p, /**< prefilter */
+                       const uint8_t *bc_p, /**< atom */
+                       bool is_ignorecase) /**< IgnoreCase flag */
+{
+  const re_opcode_t op = re_get_opcode (&bc_p);
+
+  if (op == RE_OP_CHAR && !is_ignorecase)
+  {
+    lit_utf8_byte_t buf[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
+    lit_code_unit_to_utf8 (re_get_char (&bc_p), buf);
+    prefilter_p->first_bytes[buf[0] >> 5] |= (uint32_t) 1 << (buf[0] & 0x1f);
+    return;
+  }
+
+  ecma_char_t ch = 0;
+  uint32_t range_count = 0;
+  const uint8_t *ranges_p = bc_p;
+
+  if (op == RE_OP_CHAR)
+  {
+    ch = re_get_char (&bc_p);
+  }
+  else if (op == RE_OP_CHAR_CLASS || op == RE_OP_INV_CHAR_CLASS)
+  {
+    range_count = re_get_value (&ranges_p);
+  }
+
+  /* The canonical form of an ASCII character is always an ASCII character. */
+  for (ecma_char_t byte = 0; byte <= LIT_UTF8_1_BYTE_CODE_POINT_MAX; byte++)
+  {
+    const ecma_char_t canonical_ch = ecma_regexp_canonicalize (byte, is_ignorecase);
+    bool is_match;
+
+    if (op == RE_OP_CHAR)
+    {
+      is_match = (canonical_ch == ch);
+    }
+    else if (op == RE_OP_PERIOD)
+    {
+      is_match = !lit_char_is_line_terminator (byte);
+    }
+    else
+    {
+      JERRY_ASSERT (op == RE_OP_CHAR_CLASS || op == RE_OP_INV_CHAR_CLASS);
+
+      const uint8_t *range_p = ranges_p;
+      is_match = false;
+
+      for (uint32_t i = 0; i < range_count && !is_match; i++)
+      {
+        const ecma_char_t ch1 = re_get_char (&range_p);
+        const ecma_char_t ch2 = re_get_char (&range_p);
+        is_match = (canonical_ch >= ch1 && canonical_ch <= ch2);
+      }
+
+      is_match = (is_match == (op == RE_OP_CHAR_CLASS));
+    }
+
+    if (is_match)
+    {
+      prefilter_p->first_bytes[byte >> 5] |= (uint32_t) 1 << (byte & 0x1f);
+    }
+  }
+
+  if (op == RE_OP_CHAR && ch <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    return;
+  }
+
+  if (op == RE_OP_CHAR_CLASS)
+  {
+    bool has_non_ascii = false;
+
+    for (uint32_t i = 0; i < range_count; i++)
+    {
+      re_get_char (&ranges_p);
+      has_non_ascii = has_non_ascii || (re_get_char (&ranges_p) > LIT_UTF8_1_BYTE_CODE_POINT_MAX);
+    }
+
+    if (!has_non_ascii)
+    {
+      return;
+    }
+  }
+
+  re_prefilter_add_non_ascii (prefilter_p);
+} /* re_prefilter_add_atom */
+
+/**
+ * Add the first bytes of the matches of the alternatives to the first byte set of a prefilter
+ *
+ * @return true - if the alternatives can match an empty string, or the first bytes are unknown
+ *         false - otherwise
+ */
+static bool
+re_prefilter_add_alternatives (re_prefilter_t *prefilter_p, /**< prefilter */
+                               const uint8_t *bc_p, /**< start of the alternatives */
+                               bool is_ignorecase) /**< IgnoreCase flag */
+{
+#if (JERRY_STACK_LIMIT != 0)
+  if (JERRY_UNLIKELY (ecma_get_current_stack_usage () > CONFIG_MEM_STACK_LIMIT))
+  {
+    return true;
+  }
+#endif /* JERRY_STACK_LIMIT != 0 */
+
+  bool is_nullable = false;
+
+  while (true)
+  {
+    const uint32_t length = re_get_value (&bc_p);
+    const uint8_t *const end_p = bc_p + length;
+    bool is_alternative_nullable = true;
+
+    while (bc_p < end_p && is_alternative_nullable)
+    {
+      re_term_t term;
+
+      if (!re_decode_term (bc_p, &term))
+      {
+        return true;
+      }
+
+      if (term.is_group)
+      {
+        is_alternative_nullable = (re_prefilter_add_alternatives (prefilter_p, term.body_p, is_ignorecase)
+                                   || term.min == 0);
+      }
+      else if (RE_IS_ASSERTION (*term.body_p))
+      {
+        is_alternative_nullable = true;
+      }
+      else
+      {
+        re_prefilter_add_atom (prefilter_p, term.body_p, is_ignorecase);
+        is_alternative_nullable = (term.min == 0);
+      }
+
+      bc_p = term.next_p;
+    }
+
+    is_nullable = is_nullable || is_alternative_nullable;
+    bc_p = end_p;
+
+    if (*bc_p != RE_OP_ALTERNATIVE)
+    {
+      return is_nullable;
+    }
+
+    bc_p++;
+  }
+} /* re_prefilter_add_alternatives */
+
+/**
+ * Append the literal characters which start every match of the alternatives to the prefix of a prefilter
+ *
+ * @return true - if the prefix may continue after the alternatives
+ *         false - otherwise
+ */
+static bool
+re_prefilter_add_prefix (re_prefilter_t *prefilter_p, /**< prefilter */
+                         const uint8_t *bc_p) /**< start of the alternatives */
+{
+  const uint32_t length = re_get_value (&bc_p);
+  const uint8_t *const end_p = bc_p + length;
+
+  if (*end_p == RE_OP_ALTERNATIVE)
+  {
+    return false;
+  }
+
+  while (bc_p < end_p)
+  {
+    re_term_t term;
+
+    if (!re_decode_term (bc_p, &term))
+    {
+      return false;
+    }
+
+    bc_p = term.next_p;
+
+    /* Assertions do not change the position. */
+    if (!term.is_group && RE_IS_ASSERTION (*term.body_p))
+    {
+      continue;
+    }
+
+    if (term.min != 1 || term.max != 1)
+    {
+      return false;
+    }
+
+    if (term.is_group)
+    {
+      if (!re_prefilter_add_prefix (prefilter_p, term.body_p))
+      {
+        return false;
+      }
+      continue;
+    }
+
+    if (*term.body_p != RE_OP_CHAR)
+    {
+      return false;
+    }
+
+    const uint8_t *char_p = term.body_p + 1;
+    lit_utf8_byte_t buf[LIT_UTF8_MAX_BYTES_IN_CODE_UNIT];
+    const lit_utf8_size_t size = lit_code_unit_to_utf8 (re_get_char (&char_p), buf);
+
+    if (prefilter_p->prefix_size + size > RE_PREFILTER_MAX_PREFIX)
+    {
+      return false;
+    }
+
+    memcpy (prefilter_p->prefix + prefilter_p->prefix_size, buf, size);
+    prefilter_p->prefix_size = (uint8_t) (prefilter_p->prefix_size + size);
+  }
+
+  return true;
+} /* re_prefilter_add_prefix */
+
+/**
+ * Compute the prefilter of a RegExp and append it to the bytecode
+ *
+ * The prefilter is omitted if the pattern can match an empty string,
+ * or any character can start a match.
+ */
+static void
+re_compile_prefilter (re_bytecode_ctx_t *bc_ctx_p) /**< RegExp bytecode context */
+{
+  re_compiled_code_t *re_compiled_code_p = (re_compiled_code_t *) bc_ctx_p->block_start_p;
+  re_compiled_code_p->prefilter_offset = 0;
+
+  const bool is_ignorecase = (re_compiled_code_p->header.status_flags & RE_FLAG_IGNORE_CASE) != 0;
+  const uint8_t *bc_p = bc_ctx_p->block_start_p + sizeof (re_compiled_code_t);
+  JERRY_ASSERT (*bc_p == RE_OP_SAVE_AT_START);
+  bc_p++;
+
+  re_prefilter_t prefilter;
+  memset (&prefilter, 0, sizeof (re_prefilter_t));
+
+  if (re_prefilter_add_alternatives (&prefilter, bc_p, is_ignorecase))
+  {
+    return;
+  }
+
+  if (!is_ignorecase)
+  {
+    re_prefilter_add_prefix (&prefilter, bc_p);
+  }
+
+  uint32_t first_byte_count = 0;
+  uint32_t first_byte = 0;
+
+  for (uint32_t byte = 0; byte < 256; byte++)
+  {
+    if (prefilter.first_bytes[byte >> 5] & ((uint32_t) 1 << (byte & 0x1f)))
+    {
+      first_byte_count++;
+      first_byte = byte;
+    }
+  }
+
+  /* Continuation bytes are never in the set. */
+  if (prefilter.prefix_size == 0 && first_byte_count == 256 - 64)
+  {
+    return;
+  }
+
+  /* A single ASCII first character is searched as a prefix. */
+  if (prefilter.prefix_size == 0 && first_byte_count == 1 && first_byte <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    prefilter.prefix[0] = (uint8_t) first_byte;
+    prefilter.prefix_size = 1;
+  }
+
+  const uint32_t prefilter_offset = re_append_aligned_data (bc_ctx_p, &prefilter, sizeof (re_prefilter_t));
+
+  /* The bytecode might be reallocated. */
+  re_compiled_code_p = (re_compiled_code_t *) bc_ctx_p->block_start_p;
+  re_compiled_code_p->prefilter_offset = prefilter_offset;
+} /* re_compile_prefilter */
+
+/**
+ * Get the first entry of the RegExp cache set assigned to the given pattern and flags
+ *
+ * @return index of the first entry of the cache set
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+re_cache_get_set_start (ecma_string_t *pattern_str_p, /**< pattern string */
+                        uint16_t flags) /**< flags */
+{
+  uint32_t hash = (uint32_t) ecma_string_hash (pattern_str_p) ^ ((uint32_t) flags << 5);
+
+  return (hash & (RE_CACHE_SETS - 1)) * RE_CACHE_WAYS;
+} /* re_cache_get_set_start */
+
 /**
  * Search for the given pattern in the RegExp cache
  *
  * @return index of bytecode in cache - if found
  *         RE_CACHE_SIZE              - otherwise
  */
-static uint8_t
+static uint32_t
 re_find_bytecode_in_cache (ecma_string_t *pattern_str_p, /**< pattern string */
                            uint16_t flags) /**< flags */
 {
-  uint8_t free_idx = RE_CACHE_SIZE;
+  uint32_t set_start = re_cache_get_set_start (pattern_str_p, flags);
 
-  for (uint8_t idx = 0u; idx < RE_CACHE_SIZE; idx++)
+  for (uint32_t idx = set_start; idx < set_start + RE_CACHE_WAYS; idx++)
   {
     const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[idx];
 
@@ -739,22 +1596,67 @@ re_find_bytecode_in_cache (ecma_string_t *pattern_str_p, /**< pattern string */
           && ecma_compare_ecma_strings (cached_pattern_str_p, pattern_str_p))
       {
         JERRY_TRACE_MSG ("RegExp is found in cache\n");
+        JERRY_CONTEXT (re_cache_hits)++;
+        JERRY_CONTEXT (re_cache_last_use)[idx] = ++JERRY_CONTEXT (re_cache_time);
         return idx;
       }
     }
-    else
-    {
-      /* mark as free, so it can be overridden if the cache is full */
-      free_idx = idx;
-    }
   }
 
   JERRY_TRACE_MSG ("RegExp is NOT found in cache\n");
-  return free_idx;
+  JERRY_CONTEXT (re_cache_misses)++;
+  return RE_CACHE_SIZE;
 } /* re_find_bytecode_in_cache */
 
+/**
+ * Insert a compiled bytecode into the RegExp cache. A free entry of the cache set
+ * is used if there is one, otherwise the least recently used entry is evicted.
+ */
+static void
+re_insert_bytecode_into_cache (const re_compiled_code_t *bytecode_p, /**< compiled bytecode */
+                               ecma_string_t *pattern_str_p, /**< pattern string */
+                               uint16_t flags) /**< flags */
+{
+  uint32_t set_start = re_cache_get_set_start (pattern_str_p, flags);
+  uint32_t current_time = ++JERRY_CONTEXT (re_cache_time);
+  uint32_t cache_idx = set_start;
+  uint32_t max_age = 0;
+
+  for (uint32_t idx = set_start; idx < set_start + RE_CACHE_WAYS; idx++)
+  {
+    if (JERRY_CONTEXT (re_cache)[idx] == NULL)
+    {
+      cache_idx = idx;
+      break;
+    }
+
+    /* Unsigned subtraction keeps the ages correct when the time overflows. */
+    uint32_t age = current_time - JERRY_CONTEXT (re_cache_last_use)[idx];
+
+    if (age > max_age)
+    {
+      max_age = age;
+      cache_idx = idx;
+    }
+  }
+
+  if (JERRY_CONTEXT (re_cache)[cache_idx] != NULL)
+  {
+    JERRY_TRACE_MSG ("RegExp cache set is full! Remove the element on idx: %d\n", (int) cache_idx);
+    ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[cache_idx]);
+  }
+
+  JERRY_TRACE_MSG ("Insert bytecode into RegExp cache (idx: %d).\n", (int) cache_idx);
+  ecma_bytecode_ref ((ecma_compiled_code_t *) bytecode_p);
+  JERRY_CONTEXT (re_cache)[cache_idx] = bytecode_p;
+  JERRY_CONTEXT (re_cache_last_use)[cache_idx] = current_time;
+} /* re_insert_bytecode_into_cache */
+
 /**
  * Run gerbage collection in RegExp cache
+ *
+ * Note: the bytecodes of short living RegExp objects are kept in the cache until
+ *       this function is called, so it is only called on high memory pressure.
  */
 void
 re_cache_gc_run (void)
@@ -787,17 +1689,13 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
                      uint16_t flags) /**< flags */
 {
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
-  uint8_t cache_idx = re_find_bytecode_in_cache (pattern_str_p, flags);
+  uint32_t cache_idx = re_find_bytecode_in_cache (pattern_str_p, flags);
 
   if (cache_idx < RE_CACHE_SIZE)
   {
     *out_bytecode_p = JERRY_CONTEXT (re_cache)[cache_idx];
-
-    if (*out_bytecode_p != NULL)
-    {
-      ecma_bytecode_ref ((ecma_compiled_code_t *) *out_bytecode_p);
-      return ret_value;
-    }
+    ecma_bytecode_ref ((ecma_compiled_code_t *) *out_bytecode_p);
+    return ret_value;
   }
 
   /* not in the RegExp cache, so compile it */
@@ -849,6 +1747,9 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
     re_compiled_code_p->source = ecma_make_string_value (pattern_str_p);
     re_compiled_code_p->captures_count = re_ctx.captures_count;
     re_compiled_code_p->non_captures_count = re_ctx.non_captures_count;
+
+    re_compile_prefilter (&bc_ctx);
+    re_compile_linear_program (&bc_ctx);
   }
 
   size_t byte_code_size = (size_t) (bc_ctx.block_end_p - bc_ctx.block_start_p);
@@ -872,28 +1773,9 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
     *out_bytecode_p = (re_compiled_code_t *) bc_ctx.block_start_p;
     ((re_compiled_code_t *) bc_ctx.block_start_p)->header.size = (uint16_t) (byte_code_size >> JMEM_ALIGNMENT_LOG);
 
-    if (cache_idx == RE_CACHE_SIZE)
-    {
-      if (JERRY_CONTEXT (re_cache_idx) == RE_CACHE_SIZE)
-      {
-        JERRY_CONTEXT (re_cache_idx) = 0;
-      }
-
-      JERRY_TRACE_MSG ("RegExp cache is full! Remove the element on idx: %d\n", JERRY_CONTEXT (re_cache_idx));
-
-      cache_idx = JERRY_CONTEXT (re_cache_idx)++;
-
-      /* The garbage collector might run during the byte code
-       * allocations above and it may free this entry. */
-      if (JERRY_CONTEXT (re_cache)[cache_idx] != NULL)
-      {
-        ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[cache_idx]);
-      }
-    }
-
-    JERRY_TRACE_MSG ("Insert bytecode into RegExp cache (idx: %d).\n", cache_idx);
-    ecma_bytecode_ref ((ecma_compiled_code_t *) *out_bytecode_p);
-    JERRY_CONTEXT (re_cache)[cache_idx] = *out_bytecode_p;
+    /* The garbage collector might run during the byte code allocations
+     * above and it may free entries, so the cache entry is selected here. */
+    re_insert_bytecode_into_cache (*out_bytecode_p, pattern_str_p, flags);
   }
 
   return ret_value;
@@ -21,6 +21,7 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "ecma-icache.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
 #include "ecma-try-catch-macro.h"
@@ -51,6 +52,15 @@ vm_var_decl (vm_frame_ctx_t *frame_ctx_p, /**< interpreter context */
   {
     const bool is_configurable_bindings = frame_ctx_p->is_eval_code;
 
+#if ENABLED (JERRY_ICACHE)
+    if (is_configurable_bindings
+        && ecma_get_lex_env_type (frame_ctx_p->lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+    {
+      /* Identifier accesses may have skipped this environment before the binding is created. */
+      ecma_icache_invalidate ();
+    }
+#endif /* ENABLED (JERRY_ICACHE) */
+
     ecma_value_t completion_value = ecma_op_create_mutable_binding (frame_ctx_p->lex_env_p,
                                                                     var_name_str_p,
                                                                     is_configurable_bindings);
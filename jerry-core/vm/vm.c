@@ -24,6 +24,7 @@
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
+#include "ecma-icache.h"
 #include "ecma-iterator-object.h"
 #include "ecma-lcache.h"
 #include "ecma-lex-env.h"
@@ -49,7 +50,8 @@
  * @return ecma value
  */
 static ecma_value_t
-vm_op_get_value (ecma_value_t object, /**< base object */
+vm_op_get_value (const uint8_t *byte_code_p, /**< byte code of the property access */
+                 ecma_value_t object, /**< base object */
                  ecma_value_t property) /**< property name */
 {
   if (ecma_is_value_object (object))
@@ -97,12 +99,27 @@ vm_op_get_value (ecma_value_t object, /**< base object */
 
     if (property_name_p != NULL)
     {
+#if ENABLED (JERRY_ICACHE)
+      ecma_property_t *cached_property_p = ecma_icache_lookup (byte_code_p, object_p, property);
+
+      if (cached_property_p != NULL
+          && ECMA_PROPERTY_GET_TYPE (*cached_property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+      {
+        return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (cached_property_p)->value);
+      }
+#else /* !ENABLED (JERRY_ICACHE) */
+      JERRY_UNUSED (byte_code_p);
+#endif /* ENABLED (JERRY_ICACHE) */
+
 #if ENABLED (JERRY_LCACHE)
       ecma_property_t *property_p = ecma_lcache_lookup (object_p, property_name_p);
 
       if (property_p != NULL &&
           ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
       {
+#if ENABLED (JERRY_ICACHE)
+        ecma_icache_insert (byte_code_p, object_p, property, property_p);
+#endif /* ENABLED (JERRY_ICACHE) */
         return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
       }
 #endif /* ENABLED (JERRY_LCACHE) */
@@ -148,7 +165,8 @@ vm_op_get_value (ecma_value_t object, /**< base object */
  *         if the property setting is unsuccessful
  */
 static ecma_value_t
-vm_op_set_value (ecma_value_t object, /**< base object */
+vm_op_set_value (const uint8_t *byte_code_p, /**< byte code of the property access */
+                 ecma_value_t object, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
                  bool is_strict) /**< strict mode */
@@ -187,6 +205,40 @@ vm_op_set_value (ecma_value_t object, /**< base object */
     object_p = ecma_get_object_from_value (object);
   }
 
+#if ENABLED (JERRY_ICACHE)
+  /* Pseudo arrays are excluded, since they may have properties which are mapped to other storages. */
+  if (ecma_is_value_prop_name (property)
+      && !ecma_is_lexical_environment (object_p)
+      && ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_PSEUDO_ARRAY)
+  {
+    ecma_property_t *cached_property_p = ecma_icache_lookup (byte_code_p, object_p, property);
+
+    if (cached_property_p == NULL)
+    {
+      cached_property_p = ecma_lcache_lookup (object_p, ecma_get_prop_name_from_value (property));
+
+      if (cached_property_p != NULL
+          && ECMA_PROPERTY_GET_TYPE (*cached_property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+      {
+        ecma_icache_insert (byte_code_p, object_p, property, cached_property_p);
+      }
+    }
+
+    if (cached_property_p != NULL
+        && ECMA_PROPERTY_GET_TYPE (*cached_property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+        && ecma_is_property_writable (*cached_property_p))
+    {
+      ecma_named_data_property_assign_value (object_p, ECMA_PROPERTY_VALUE_PTR (cached_property_p), value);
+
+      ecma_deref_object (object_p);
+      ecma_free_value (property);
+      return ECMA_VALUE_TRUE;
+    }
+  }
+#else /* !ENABLED (JERRY_ICACHE) */
+  JERRY_UNUSED (byte_code_p);
+#endif /* ENABLED (JERRY_ICACHE) */
+
   ecma_string_t *property_p;
 
   if (!ecma_is_value_prop_name (property))
@@ -228,6 +280,87 @@ vm_op_set_value (ecma_value_t object, /**< base object */
   return completion_value;
 } /* vm_op_set_value */
 
+/**
+ * Get the value of an identifier which is not stored in a register.
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+vm_op_get_ident_value (const uint8_t *byte_code_p, /**< byte code of the identifier access */
+                       ecma_object_t *lex_env_p, /**< lexical environment */
+                       ecma_string_t *name_p) /**< identifier name */
+{
+#if ENABLED (JERRY_ICACHE)
+  ecma_property_t *property_p = ecma_icache_find_binding (byte_code_p, &lex_env_p, name_p);
+
+  if (property_p != NULL)
+  {
+    return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+  }
+#else /* !ENABLED (JERRY_ICACHE) */
+  JERRY_UNUSED (byte_code_p);
+#endif /* ENABLED (JERRY_ICACHE) */
+
+  return ecma_op_resolve_reference_value (lex_env_p, name_p);
+} /* vm_op_get_ident_value */
+
+/**
+ * Get the value and the base of an identifier which is not stored in a register.
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+vm_op_get_ident_reference (const uint8_t *byte_code_p, /**< byte code of the identifier access */
+                           ecma_object_t *lex_env_p, /**< lexical environment */
+                           ecma_object_t **ref_base_lex_env_p, /**< [out] reference's base (lexical environment) */
+                           ecma_string_t *name_p) /**< identifier name */
+{
+#if ENABLED (JERRY_ICACHE)
+  ecma_property_t *property_p = ecma_icache_find_binding (byte_code_p, &lex_env_p, name_p);
+
+  if (property_p != NULL)
+  {
+    *ref_base_lex_env_p = lex_env_p;
+    return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+  }
+#else /* !ENABLED (JERRY_ICACHE) */
+  JERRY_UNUSED (byte_code_p);
+#endif /* ENABLED (JERRY_ICACHE) */
+
+  return ecma_op_get_value_lex_env_base (lex_env_p, ref_base_lex_env_p, name_p);
+} /* vm_op_get_ident_reference */
+
+/**
+ * Set the value of an identifier which is not stored in a register.
+ *
+ * @return an ecma value which contains an error
+ *         if the assignment is unsuccessful
+ */
+static ecma_value_t
+vm_op_set_ident_value (const uint8_t *byte_code_p, /**< byte code of the identifier access */
+                       ecma_object_t *lex_env_p, /**< lexical environment */
+                       ecma_string_t *name_p, /**< identifier name */
+                       bool is_strict, /**< strict mode */
+                       ecma_value_t value) /**< ecma value */
+{
+#if ENABLED (JERRY_ICACHE)
+  ecma_property_t *property_p = ecma_icache_find_binding (byte_code_p, &lex_env_p, name_p);
+
+  if (property_p != NULL
+      && ecma_is_property_writable (*property_p))
+  {
+    ecma_named_data_property_assign_value (lex_env_p, ECMA_PROPERTY_VALUE_PTR (property_p), value);
+    return ECMA_VALUE_EMPTY;
+  }
+#else /* !ENABLED (JERRY_ICACHE) */
+  JERRY_UNUSED (byte_code_p);
+#endif /* ENABLED (JERRY_ICACHE) */
+
+  return ecma_op_put_value_lex_env_base (lex_env_p, name_p, is_strict, value);
+} /* vm_op_set_ident_value */
+
 /** Compact bytecode define */
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg4,
 
@@ -731,8 +864,9 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       { \
         ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]); \
         \
-        result = ecma_op_resolve_reference_value (frame_ctx_p->lex_env_p, \
-                                                  name_p); \
+        result = vm_op_get_ident_value (byte_code_p, \
+                                        frame_ctx_p->lex_env_p, \
+                                        name_p); \
         \
         if (ECMA_IS_VALUE_ERROR (result)) \
         { \
@@ -754,6 +888,37 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   } \
   while (0)
 
+#if ENABLED (JERRY_VM_THREADED_DISPATCH) && (defined (__GNUC__) || defined (__clang__))
+
+/**
+ * Opcode handlers are selected by jumping through a table of label addresses.
+ */
+#define VM_THREADED_DISPATCH
+
+/**
+ * Label of an opcode handler, which can also be reached from the dispatch table.
+ */
+#define VM_CASE(opcode) case opcode: vm_handler_ ## opcode
+
+/**
+ * Jump to the handler of the opcode group.
+ */
+#define VM_DISPATCH(opcode_data) goto *vm_dispatch_table[VM_OC_GROUP_GET_INDEX (opcode_data)]
+
+#else /* !ENABLED (JERRY_VM_THREADED_DISPATCH) || (!__GNUC__ && !__clang__) */
+
+/**
+ * Label of an opcode handler.
+ */
+#define VM_CASE(opcode) case opcode
+
+/**
+ * The switch statement selects the opcode handler.
+ */
+#define VM_DISPATCH(opcode_data)
+
+#endif /* ENABLED (JERRY_VM_THREADED_DISPATCH) && (__GNUC__ || __clang__) */
+
 /**
  * Run initializer byte codes.
  *
@@ -903,6 +1068,243 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   }
 } /* vm_init_loop */
 
+/**
+ * Compare two numbers for a compare and branch opcode.
+ *
+ * @return result of the comparison
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_compare_numbers (uint32_t compare_opcode, /**< comparison opcode */
+                    ecma_number_t left_number, /**< left operand */
+                    ecma_number_t right_number) /**< right operand */
+{
+  switch (compare_opcode)
+  {
+    case CBC_EQUAL:
+    case CBC_STRICT_EQUAL:
+    {
+      return left_number == right_number;
+    }
+    case CBC_NOT_EQUAL:
+    case CBC_STRICT_NOT_EQUAL:
+    {
+      return left_number != right_number;
+    }
+    case CBC_LESS:
+    {
+      return left_number < right_number;
+    }
+    case CBC_GREATER:
+    {
+      return left_number > right_number;
+    }
+    case CBC_LESS_EQUAL:
+    {
+      return left_number <= right_number;
+    }
+    default:
+    {
+      JERRY_ASSERT (compare_opcode == CBC_GREATER_EQUAL);
+      return left_number >= right_number;
+    }
+  }
+} /* vm_compare_numbers */
+
+/**
+ * Integer fast path of the arithmetic and set identifier opcodes.
+ *
+ * @return result of the operation - if it can be computed without conversions
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
+vm_integer_arithmetic (uint32_t arithmetic_opcode, /**< arithmetic opcode */
+                       ecma_value_t left_value, /**< left integer operand */
+                       ecma_value_t right_value) /**< right integer operand */
+{
+  JERRY_ASSERT (ecma_are_values_integer_numbers (left_value, right_value));
+
+  ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+  ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+  switch (arithmetic_opcode)
+  {
+    case CBC_ADD:
+    {
+      return ecma_make_int32_value ((int32_t) (left_integer + right_integer));
+    }
+    case CBC_SUBTRACT:
+    {
+      return ecma_make_int32_value ((int32_t) (left_integer - right_integer));
+    }
+    case CBC_MULTIPLY:
+    {
+      if (-ECMA_INTEGER_MULTIPLY_MAX <= left_integer
+          && left_integer <= ECMA_INTEGER_MULTIPLY_MAX
+          && -ECMA_INTEGER_MULTIPLY_MAX <= right_integer
+          && right_integer <= ECMA_INTEGER_MULTIPLY_MAX
+          && left_value != 0
+          && right_value != 0)
+      {
+        return ecma_integer_multiply (left_integer, right_integer);
+      }
+
+      return ecma_make_number_value ((ecma_number_t) left_integer * (ecma_number_t) right_integer);
+    }
+    case CBC_MODULO:
+    {
+      if (right_integer != 0)
+      {
+        ecma_integer_value_t mod_result = left_integer % right_integer;
+
+        if (mod_result != 0 || left_integer >= 0)
+        {
+          return ecma_make_integer_value (mod_result);
+        }
+      }
+      return ECMA_VALUE_EMPTY;
+    }
+    case CBC_BIT_OR:
+    {
+      return left_value | right_value;
+    }
+    case CBC_BIT_XOR:
+    {
+      return (left_value ^ right_value) & (ecma_value_t) (~ECMA_DIRECT_TYPE_MASK);
+    }
+    case CBC_BIT_AND:
+    {
+      return left_value & right_value;
+    }
+    case CBC_LEFT_SHIFT:
+    {
+      return ecma_make_int32_value ((int32_t) (left_integer << (right_integer & 0x1f)));
+    }
+    case CBC_RIGHT_SHIFT:
+    {
+      return ecma_make_integer_value (left_integer >> (right_integer & 0x1f));
+    }
+    case CBC_UNS_RIGHT_SHIFT:
+    {
+      return ecma_make_uint32_value ((uint32_t) left_integer >> (right_integer & 0x1f));
+    }
+    default:
+    {
+      JERRY_ASSERT (arithmetic_opcode == CBC_DIVIDE);
+      return ECMA_VALUE_EMPTY;
+    }
+  }
+} /* vm_integer_arithmetic */
+
+/**
+ * Generic path of the arithmetic and set identifier opcodes.
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t JERRY_ATTR_NOINLINE
+vm_arithmetic (uint32_t arithmetic_opcode, /**< arithmetic opcode */
+               ecma_value_t left_value, /**< left operand */
+               ecma_value_t right_value) /**< right operand */
+{
+  switch (arithmetic_opcode)
+  {
+    case CBC_ADD:
+    {
+      return opfunc_addition (left_value, right_value);
+    }
+    case CBC_SUBTRACT:
+    {
+      return do_number_arithmetic (NUMBER_ARITHMETIC_SUBSTRACTION, left_value, right_value);
+    }
+    case CBC_MULTIPLY:
+    {
+      return do_number_arithmetic (NUMBER_ARITHMETIC_MULTIPLICATION, left_value, right_value);
+    }
+    case CBC_DIVIDE:
+    {
+      return do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION, left_value, right_value);
+    }
+    case CBC_MODULO:
+    {
+      return do_number_arithmetic (NUMBER_ARITHMETIC_REMAINDER, left_value, right_value);
+    }
+    case CBC_BIT_OR:
+    {
+      return do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR, left_value, right_value);
+    }
+    case CBC_BIT_XOR:
+    {
+      return do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_XOR, left_value, right_value);
+    }
+    case CBC_BIT_AND:
+    {
+      return do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_AND, left_value, right_value);
+    }
+    case CBC_LEFT_SHIFT:
+    {
+      return do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_LEFT, left_value, right_value);
+    }
+    case CBC_RIGHT_SHIFT:
+    {
+      return do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_RIGHT, left_value, right_value);
+    }
+    default:
+    {
+      JERRY_ASSERT (arithmetic_opcode == CBC_UNS_RIGHT_SHIFT);
+      return do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_URIGHT, left_value, right_value);
+    }
+  }
+} /* vm_arithmetic */
+
+#if ENABLED (JERRY_VM_EXEC_STOP)
+
+/**
+ * Decrease the counter of the execution stop callback, and call
+ * the callback when the counter reaches zero.
+ *
+ * @return true - if the execution must be aborted (the error value is set)
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_check_exec_stop (void)
+{
+  if (JERRY_CONTEXT (vm_exec_stop_cb) == NULL
+      || --JERRY_CONTEXT (vm_exec_stop_counter) != 0)
+  {
+    return false;
+  }
+
+  ecma_value_t result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
+
+  if (ecma_is_value_undefined (result))
+  {
+    JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
+    return false;
+  }
+
+  JERRY_CONTEXT (vm_exec_stop_counter) = 1;
+
+  if (!ecma_is_value_error_reference (result))
+  {
+    JERRY_CONTEXT (error_value) = result;
+  }
+  else
+  {
+    JERRY_CONTEXT (error_value) = ecma_clear_error_reference (result, false);
+  }
+
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_EXCEPTION;
+  return true;
+} /* vm_check_exec_stop */
+
+#endif /* ENABLED (JERRY_VM_EXEC_STOP) */
+
+#ifdef VM_THREADED_DISPATCH
+/* Taking the address of a label is a GNU extension. */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif /* VM_THREADED_DISPATCH */
+
 /**
  * Run generic byte code.
  *
@@ -911,6 +1313,143 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 static ecma_value_t JERRY_ATTR_NOINLINE
 vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 {
+#ifdef VM_THREADED_DISPATCH
+  /* Handler addresses in the order of vm_oc_types. */
+  static const void * const vm_dispatch_table[] =
+  {
+    &&vm_handler_VM_OC_POP,
+    &&vm_handler_VM_OC_POP_BLOCK,
+    &&vm_handler_VM_OC_PUSH,
+    &&vm_handler_VM_OC_PUSH_TWO,
+    &&vm_handler_VM_OC_PUSH_THREE,
+    &&vm_handler_VM_OC_PUSH_UNDEFINED,
+    &&vm_handler_VM_OC_PUSH_TRUE,
+    &&vm_handler_VM_OC_PUSH_FALSE,
+    &&vm_handler_VM_OC_PUSH_NULL,
+    &&vm_handler_VM_OC_PUSH_THIS,
+    &&vm_handler_VM_OC_PUSH_0,
+    &&vm_handler_VM_OC_PUSH_POS_BYTE,
+    &&vm_handler_VM_OC_PUSH_NEG_BYTE,
+    &&vm_handler_VM_OC_PUSH_LIT_0,
+    &&vm_handler_VM_OC_PUSH_LIT_POS_BYTE,
+    &&vm_handler_VM_OC_PUSH_LIT_NEG_BYTE,
+    &&vm_handler_VM_OC_PUSH_OBJECT,
+    &&vm_handler_VM_OC_PUSH_NAMED_FUNC_EXPR,
+    &&vm_handler_VM_OC_SET_PROPERTY,
+#if ENABLED (JERRY_ES2015_OBJECT_INITIALIZER)
+    &&vm_handler_VM_OC_SET_COMPUTED_PROPERTY,
+#endif /* ENABLED (JERRY_ES2015_OBJECT_INITIALIZER) */
+    &&vm_handler_VM_OC_SET_GETTER,
+    &&vm_handler_VM_OC_SET_SETTER,
+    &&vm_handler_VM_OC_PUSH_UNDEFINED_BASE,
+    &&vm_handler_VM_OC_PUSH_ARRAY,
+    &&vm_handler_VM_OC_PUSH_ELISON,
+    &&vm_handler_VM_OC_APPEND_ARRAY,
+    &&vm_handler_VM_OC_IDENT_REFERENCE,
+    &&vm_handler_VM_OC_PROP_REFERENCE,
+    &&vm_handler_VM_OC_PROP_GET,
+    &&vm_handler_VM_OC_PROP_PRE_INCR,
+    &&vm_handler_VM_OC_PROP_PRE_DECR,
+    &&vm_handler_VM_OC_PROP_POST_INCR,
+    &&vm_handler_VM_OC_PROP_POST_DECR,
+    &&vm_handler_VM_OC_PRE_INCR,
+    &&vm_handler_VM_OC_PRE_DECR,
+    &&vm_handler_VM_OC_POST_INCR,
+    &&vm_handler_VM_OC_POST_DECR,
+    &&vm_handler_VM_OC_PROP_DELETE,
+    &&vm_handler_VM_OC_DELETE,
+    &&vm_handler_VM_OC_MOV_IDENT,
+    &&vm_handler_VM_OC_ASSIGN,
+    &&vm_handler_VM_OC_ASSIGN_PROP,
+    &&vm_handler_VM_OC_ASSIGN_PROP_THIS,
+    &&vm_handler_VM_OC_RET,
+    &&vm_handler_VM_OC_THROW,
+    &&vm_handler_VM_OC_THROW_REFERENCE_ERROR,
+    &&vm_handler_VM_OC_EVAL,
+    &&vm_handler_VM_OC_CALL,
+    &&vm_handler_VM_OC_NEW,
+    &&vm_handler_VM_OC_RESOLVE_BASE_FOR_CALL,
+    &&vm_handler_VM_OC_ERROR,
+    &&vm_handler_VM_OC_JUMP,
+    &&vm_handler_VM_OC_BRANCH_IF_STRICT_EQUAL,
+    &&vm_handler_VM_OC_BRANCH_IF_TRUE,
+    &&vm_handler_VM_OC_BRANCH_IF_FALSE,
+    &&vm_handler_VM_OC_BRANCH_IF_LOGICAL_TRUE,
+    &&vm_handler_VM_OC_BRANCH_IF_LOGICAL_FALSE,
+    &&vm_handler_VM_OC_BRANCH_IF_COMPARE,
+    &&vm_handler_VM_OC_PLUS,
+    &&vm_handler_VM_OC_MINUS,
+    &&vm_handler_VM_OC_NOT,
+    &&vm_handler_VM_OC_BIT_NOT,
+    &&vm_handler_VM_OC_VOID,
+    &&vm_handler_VM_OC_TYPEOF_IDENT,
+    &&vm_handler_VM_OC_TYPEOF,
+    &&vm_handler_VM_OC_ADD,
+    &&vm_handler_VM_OC_SUB,
+    &&vm_handler_VM_OC_MUL,
+    &&vm_handler_VM_OC_DIV,
+    &&vm_handler_VM_OC_MOD,
+    &&vm_handler_VM_OC_EQUAL,
+    &&vm_handler_VM_OC_NOT_EQUAL,
+    &&vm_handler_VM_OC_STRICT_EQUAL,
+    &&vm_handler_VM_OC_STRICT_NOT_EQUAL,
+    &&vm_handler_VM_OC_LESS,
+    &&vm_handler_VM_OC_GREATER,
+    &&vm_handler_VM_OC_LESS_EQUAL,
+    &&vm_handler_VM_OC_GREATER_EQUAL,
+    &&vm_handler_VM_OC_IN,
+    &&vm_handler_VM_OC_INSTANCEOF,
+    &&vm_handler_VM_OC_BIT_OR,
+    &&vm_handler_VM_OC_BIT_XOR,
+    &&vm_handler_VM_OC_BIT_AND,
+    &&vm_handler_VM_OC_LEFT_SHIFT,
+    &&vm_handler_VM_OC_RIGHT_SHIFT,
+    &&vm_handler_VM_OC_UNS_RIGHT_SHIFT,
+    &&vm_handler_VM_OC_ARITHMETIC_SET_IDENT,
+    &&vm_handler_VM_OC_WITH,
+    &&vm_handler_VM_OC_FOR_IN_CREATE_CONTEXT,
+    &&vm_handler_VM_OC_FOR_IN_GET_NEXT,
+    &&vm_handler_VM_OC_FOR_IN_HAS_NEXT,
+#if ENABLED (JERRY_ES2015_FOR_OF)
+    &&vm_handler_VM_OC_FOR_OF_CREATE_CONTEXT,
+    &&vm_handler_VM_OC_FOR_OF_GET_NEXT,
+    &&vm_handler_VM_OC_FOR_OF_HAS_NEXT,
+#endif /* ENABLED (JERRY_ES2015_FOR_OF) */
+    &&vm_handler_VM_OC_TRY,
+    &&vm_handler_VM_OC_CATCH,
+    &&vm_handler_VM_OC_FINALLY,
+    &&vm_handler_VM_OC_CONTEXT_END,
+    &&vm_handler_VM_OC_JUMP_AND_EXIT_CONTEXT,
+#if ENABLED (JERRY_ES2015_CLASS)
+    &&vm_handler_VM_OC_CLASS_HERITAGE,
+    &&vm_handler_VM_OC_CLASS_INHERITANCE,
+    &&vm_handler_VM_OC_PUSH_CLASS_CONSTRUCTOR_AND_PROTOTYPE,
+    &&vm_handler_VM_OC_SET_CLASS_CONSTRUCTOR,
+    &&vm_handler_VM_OC_PUSH_IMPL_CONSTRUCTOR,
+    &&vm_handler_VM_OC_CLASS_EXPR_CONTEXT_END,
+    &&vm_handler_VM_OC_CLASS_EVAL,
+    &&vm_handler_VM_OC_SUPER_CALL,
+    &&vm_handler_VM_OC_SUPER_PROP_REFERENCE,
+    &&vm_handler_VM_OC_PUSH_SUPER,
+    &&vm_handler_VM_OC_PUSH_CONSTRUCTOR_SUPER,
+    &&vm_handler_VM_OC_PUSH_CONSTRUCTOR_THIS,
+    &&vm_handler_VM_OC_CONSTRUCTOR_RET,
+#endif /* ENABLED (JERRY_ES2015_CLASS) */
+#if ENABLED (JERRY_DEBUGGER)
+    &&vm_handler_VM_OC_BREAKPOINT_ENABLED,
+    &&vm_handler_VM_OC_BREAKPOINT_DISABLED,
+#endif /* ENABLED (JERRY_DEBUGGER) */
+#if ENABLED (JERRY_LINE_INFO)
+    &&vm_handler_VM_OC_RESOURCE_NAME,
+    &&vm_handler_VM_OC_LINE,
+#endif /* ENABLED (JERRY_LINE_INFO) */
+    &&vm_handler_VM_OC_NONE
+  };
+
+  JERRY_STATIC_ASSERT (sizeof (vm_dispatch_table) / sizeof (vm_dispatch_table[0]) == VM_OC_NONE + 1,
+                       vm_dispatch_table_must_have_a_handler_for_each_opcode_group);
+#endif /* VM_THREADED_DISPATCH */
+
   const ecma_compiled_code_t *bytecode_header_p = frame_ctx_p->bytecode_header_p;
   uint8_t *byte_code_p = frame_ctx_p->byte_code_p;
   ecma_value_t *literal_start_p = frame_ctx_p->literal_start_p;
@@ -1014,6 +1553,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             }
           }
         }
+
+        VM_DISPATCH (opcode_data);
       }
       else if (operands >= VM_OC_GET_STACK)
       {
@@ -1029,6 +1570,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = left_value;
           left_value = *(--stack_top_p);
         }
+
+        VM_DISPATCH (opcode_data);
       }
       else if (operands == VM_OC_GET_BRANCH)
       {
@@ -1052,65 +1595,53 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         if (opcode_data & VM_OC_BACKWARD_BRANCH)
         {
 #if ENABLED (JERRY_VM_EXEC_STOP)
-          if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL
-              && --JERRY_CONTEXT (vm_exec_stop_counter) == 0)
+          if (vm_check_exec_stop ())
           {
-            result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
-
-            if (ecma_is_value_undefined (result))
-            {
-              JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
-            }
-            else
-            {
-              JERRY_CONTEXT (vm_exec_stop_counter) = 1;
-
-              if (!ecma_is_value_error_reference (result))
-              {
-                JERRY_CONTEXT (error_value) = result;
-              }
-              else
-              {
-                JERRY_CONTEXT (error_value) = ecma_clear_error_reference (result, false);
-              }
-
-              JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_EXCEPTION;
-              result = ECMA_VALUE_ERROR;
-              goto error;
-            }
+            result = ECMA_VALUE_ERROR;
+            goto error;
           }
 #endif /* ENABLED (JERRY_VM_EXEC_STOP) */
+#if ENABLED (JERRY_GC_INCREMENTAL)
+          if (JERRY_UNLIKELY (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE))
+          {
+            ecma_gc_step (CONFIG_ECMA_GC_INCREMENTAL_STEP);
+          }
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
 
           branch_offset = -branch_offset;
         }
+
+        VM_DISPATCH (opcode_data);
       }
 
+      VM_DISPATCH (opcode_data);
+
       switch (VM_OC_GROUP_GET_INDEX (opcode_data))
       {
-        case VM_OC_POP:
+        VM_CASE (VM_OC_POP):
         {
           JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end);
           ecma_free_value (*(--stack_top_p));
           continue;
         }
-        case VM_OC_POP_BLOCK:
+        VM_CASE (VM_OC_POP_BLOCK):
         {
           ecma_fast_free_value (frame_ctx_p->block_result);
           frame_ctx_p->block_result = *(--stack_top_p);
           continue;
         }
-        case VM_OC_PUSH:
+        VM_CASE (VM_OC_PUSH):
         {
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_PUSH_TWO:
+        VM_CASE (VM_OC_PUSH_TWO):
         {
           *stack_top_p++ = left_value;
           *stack_top_p++ = right_value;
           continue;
         }
-        case VM_OC_PUSH_THREE:
+        VM_CASE (VM_OC_PUSH_THREE):
         {
           uint16_t literal_index;
 
@@ -1124,56 +1655,56 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_PUSH_UNDEFINED:
+        VM_CASE (VM_OC_PUSH_UNDEFINED):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           continue;
         }
-        case VM_OC_PUSH_TRUE:
+        VM_CASE (VM_OC_PUSH_TRUE):
         {
           *stack_top_p++ = ECMA_VALUE_TRUE;
           continue;
         }
-        case VM_OC_PUSH_FALSE:
+        VM_CASE (VM_OC_PUSH_FALSE):
         {
           *stack_top_p++ = ECMA_VALUE_FALSE;
           continue;
         }
-        case VM_OC_PUSH_NULL:
+        VM_CASE (VM_OC_PUSH_NULL):
         {
           *stack_top_p++ = ECMA_VALUE_NULL;
           continue;
         }
-        case VM_OC_PUSH_THIS:
+        VM_CASE (VM_OC_PUSH_THIS):
         {
           *stack_top_p++ = ecma_copy_value (frame_ctx_p->this_binding);
           continue;
         }
-        case VM_OC_PUSH_0:
+        VM_CASE (VM_OC_PUSH_0):
         {
           *stack_top_p++ = ecma_make_integer_value (0);
           continue;
         }
-        case VM_OC_PUSH_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (number + 1);
           continue;
         }
-        case VM_OC_PUSH_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (-(number + 1));
           continue;
         }
-        case VM_OC_PUSH_LIT_0:
+        VM_CASE (VM_OC_PUSH_LIT_0):
         {
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (0);
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_LIT_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
@@ -1181,7 +1712,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_LIT_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
@@ -1189,7 +1720,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_OBJECT:
+        VM_CASE (VM_OC_PUSH_OBJECT):
         {
           ecma_object_t *obj_p = ecma_create_object (ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE),
                                                      0,
@@ -1198,7 +1729,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_object_value (obj_p);
           continue;
         }
-        case VM_OC_PUSH_NAMED_FUNC_EXPR:
+        VM_CASE (VM_OC_PUSH_NAMED_FUNC_EXPR):
         {
           ecma_object_t *func_p = ecma_get_object_from_value (left_value);
 
@@ -1221,7 +1752,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_ES2015_OBJECT_INITIALIZER)
-        case VM_OC_SET_COMPUTED_PROPERTY:
+        VM_CASE (VM_OC_SET_COMPUTED_PROPERTY):
         {
           /* Swap values. */
           left_value ^= right_value;
@@ -1230,7 +1761,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           /* FALLTHRU */
         }
 #endif /* ENABLED (JERRY_ES2015_OBJECT_INITIALIZER) */
-        case VM_OC_SET_PROPERTY:
+        VM_CASE (VM_OC_SET_PROPERTY):
         {
           JERRY_STATIC_ASSERT (VM_OC_NON_STATIC_FLAG == VM_OC_BACKWARD_BRANCH,
                                vm_oc_non_static_flag_must_be_equal_to_vm_oc_backward_branch);
@@ -1292,8 +1823,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_SET_GETTER:
-        case VM_OC_SET_SETTER:
+        VM_CASE (VM_OC_SET_GETTER):
+        VM_CASE (VM_OC_SET_SETTER):
         {
           JERRY_ASSERT ((opcode_data >> VM_OC_NON_STATIC_SHIFT) <= 0x1);
 
@@ -1327,21 +1858,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PUSH_ARRAY:
+        VM_CASE (VM_OC_PUSH_ARRAY):
         {
           // Note: this operation cannot throw an exception
           *stack_top_p++ = ecma_make_object_value (ecma_op_new_fast_array_object (0));
           continue;
         }
 #if ENABLED (JERRY_ES2015_CLASS)
-        case VM_OC_SUPER_CALL:
+        VM_CASE (VM_OC_SUPER_CALL):
         {
           frame_ctx_p->call_operation = VM_EXEC_SUPER_CALL;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_CLASS_HERITAGE:
+        VM_CASE (VM_OC_CLASS_HERITAGE):
         {
           ecma_value_t super_value = *(--stack_top_p);
           ecma_object_t *super_class_p;
@@ -1391,7 +1922,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_CLASS_INHERITANCE:
+        VM_CASE (VM_OC_CLASS_INHERITANCE):
         {
           ecma_value_t child_value = stack_top_p[-2];
           ecma_value_t child_prototype_value = stack_top_p[-1];
@@ -1424,6 +1955,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             {
               ecma_object_t *super_prototype_class_p = ecma_get_object_from_value (super_prototype_value);
 
+              ECMA_GC_WRITE_BARRIER (child_prototype_class_p);
+              ECMA_GC_WRITE_BARRIER (child_class_p);
               ECMA_SET_NON_NULL_POINTER (child_prototype_class_p->u2.prototype_cp, super_prototype_class_p);
               ECMA_SET_NON_NULL_POINTER (child_class_p->u2.prototype_cp, super_class_p);
 
@@ -1433,7 +1966,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_PUSH_CLASS_CONSTRUCTOR_AND_PROTOTYPE:
+        VM_CASE (VM_OC_PUSH_CLASS_CONSTRUCTOR_AND_PROTOTYPE):
         {
           ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE);
 
@@ -1462,7 +1995,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_SET_CLASS_CONSTRUCTOR:
+        VM_CASE (VM_OC_SET_CLASS_CONSTRUCTOR):
         {
           ecma_object_t *new_constructor_obj_p = ecma_get_object_from_value (left_value);
           ecma_object_t *current_constructor_obj_p = ecma_get_object_from_value (stack_top_p[-2]);
@@ -1486,7 +2019,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_deref_object (new_constructor_obj_p);
           continue;
         }
-        case VM_OC_PUSH_IMPL_CONSTRUCTOR:
+        VM_CASE (VM_OC_PUSH_IMPL_CONSTRUCTOR):
         {
           ecma_object_t *current_constructor_obj_p = ecma_get_object_from_value (stack_top_p[-2]);
 
@@ -1503,7 +2036,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_CLASS_EXPR_CONTEXT_END:
+        VM_CASE (VM_OC_CLASS_EXPR_CONTEXT_END):
         {
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-2]) == VM_CONTEXT_SUPER_CLASS);
           stack_top_p = vm_stack_context_abort (frame_ctx_p, stack_top_p - 1);
@@ -1512,13 +2045,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] = *stack_top_p;
           continue;
         }
-        case VM_OC_CLASS_EVAL:
+        VM_CASE (VM_OC_CLASS_EVAL):
         {
           ECMA_CLEAR_SUPER_EVAL_PARSER_OPTS ();
           ECMA_SET_SUPER_EVAL_PARSER_OPTS (*byte_code_p++);
           continue;
         }
-        case VM_OC_PUSH_CONSTRUCTOR_SUPER:
+        VM_CASE (VM_OC_PUSH_CONSTRUCTOR_SUPER):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE);
 
@@ -1544,7 +2077,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           /* FALLTHRU */
         }
-        case VM_OC_PUSH_SUPER:
+        VM_CASE (VM_OC_PUSH_SUPER):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE);
 
@@ -1573,7 +2106,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_PUSH_CONSTRUCTOR_THIS:
+        VM_CASE (VM_OC_PUSH_CONSTRUCTOR_THIS):
         {
           if (!ecma_op_is_super_called (frame_ctx_p->lex_env_p))
           {
@@ -1585,7 +2118,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_copy_value (ecma_op_get_class_this_binding (frame_ctx_p->lex_env_p));
           continue;
         }
-        case VM_OC_SUPER_PROP_REFERENCE:
+        VM_CASE (VM_OC_SUPER_PROP_REFERENCE):
         {
           /**
            * In case of this VM_OC_SUPER_PROP_REFERENCE the previously pushed 'super' must be replaced
@@ -1633,7 +2166,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[index] = ecma_copy_value (frame_ctx_p->this_binding);
           continue;
         }
-        case VM_OC_CONSTRUCTOR_RET:
+        VM_CASE (VM_OC_CONSTRUCTOR_RET):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
@@ -1659,12 +2192,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto error;
         }
 #endif /* ENABLED (JERRY_ES2015_CLASS) */
-        case VM_OC_PUSH_ELISON:
+        VM_CASE (VM_OC_PUSH_ELISON):
         {
           *stack_top_p++ = ECMA_VALUE_ARRAY_HOLE;
           continue;
         }
-        case VM_OC_APPEND_ARRAY:
+        VM_CASE (VM_OC_APPEND_ARRAY):
         {
           ecma_object_t *array_obj_p;
           uint32_t values_length = *byte_code_p++;
@@ -1729,14 +2262,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_PUSH_UNDEFINED_BASE:
+        VM_CASE (VM_OC_PUSH_UNDEFINED_BASE):
         {
           stack_top_p[0] = stack_top_p[-1];
           stack_top_p[-1] = ECMA_VALUE_UNDEFINED;
           stack_top_p++;
           continue;
         }
-        case VM_OC_IDENT_REFERENCE:
+        VM_CASE (VM_OC_IDENT_REFERENCE):
         {
           uint16_t literal_index;
 
@@ -1756,9 +2289,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
             ecma_object_t *ref_base_lex_env_p;
 
-            result = ecma_op_get_value_lex_env_base (frame_ctx_p->lex_env_p,
-                                                     &ref_base_lex_env_p,
-                                                     name_p);
+            result = vm_op_get_ident_reference (byte_code_p,
+                                                frame_ctx_p->lex_env_p,
+                                                &ref_base_lex_env_p,
+                                                name_p);
 
             if (ECMA_IS_VALUE_ERROR (result))
             {
@@ -1773,9 +2307,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_PROP_GET:
+        VM_CASE (VM_OC_PROP_GET):
         {
-          result = vm_op_get_value (left_value, right_value);
+          result = vm_op_get_value (byte_code_start_p, left_value, right_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -1785,7 +2319,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_PROP_REFERENCE:
+        VM_CASE (VM_OC_PROP_REFERENCE):
         {
           /* Forms with reference requires preserving the base and offset. */
 
@@ -1809,12 +2343,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_PROP_PRE_INCR:
-        case VM_OC_PROP_PRE_DECR:
-        case VM_OC_PROP_POST_INCR:
-        case VM_OC_PROP_POST_DECR:
+        VM_CASE (VM_OC_PROP_PRE_INCR):
+        VM_CASE (VM_OC_PROP_PRE_DECR):
+        VM_CASE (VM_OC_PROP_POST_INCR):
+        VM_CASE (VM_OC_PROP_POST_DECR):
         {
-          result = vm_op_get_value (left_value,
+          result = vm_op_get_value (byte_code_start_p,
+                                    left_value,
                                     right_value);
 
           if (opcode < CBC_PRE_INCR)
@@ -1838,10 +2373,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = ECMA_VALUE_UNDEFINED;
           /* FALLTHRU */
         }
-        case VM_OC_PRE_INCR:
-        case VM_OC_PRE_DECR:
-        case VM_OC_POST_INCR:
-        case VM_OC_POST_DECR:
+        VM_CASE (VM_OC_PRE_INCR):
+        VM_CASE (VM_OC_PRE_DECR):
+        VM_CASE (VM_OC_POST_INCR):
+        VM_CASE (VM_OC_POST_DECR):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
 
@@ -1904,7 +2439,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                 }
               }
 
-              result = (ecma_value_t) (int_value + int_increase);
+              result = (ecma_value_t) (uint32_t) (int_value + int_increase);
               break;
             }
           }
@@ -1977,13 +2512,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_ASSIGN:
+        VM_CASE (VM_OC_ASSIGN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_MOV_IDENT:
+        VM_CASE (VM_OC_MOV_IDENT):
         {
           uint16_t literal_index;
 
@@ -1996,14 +2531,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->registers_p[literal_index] = left_value;
           continue;
         }
-        case VM_OC_ASSIGN_PROP:
+        VM_CASE (VM_OC_ASSIGN_PROP):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_ASSIGN_PROP_THIS:
+        VM_CASE (VM_OC_ASSIGN_PROP_THIS):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = ecma_copy_value (frame_ctx_p->this_binding);
@@ -2011,7 +2546,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_RET:
+        VM_CASE (VM_OC_RET):
         {
           JERRY_ASSERT (opcode == CBC_RETURN
                         || opcode == CBC_RETURN_WITH_BLOCK
@@ -2027,7 +2562,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW:
+        VM_CASE (VM_OC_THROW):
         {
           JERRY_CONTEXT (error_value) = left_value;
           JERRY_CONTEXT (status_flags) |= ECMA_STATUS_EXCEPTION;
@@ -2036,32 +2571,32 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW_REFERENCE_ERROR:
+        VM_CASE (VM_OC_THROW_REFERENCE_ERROR):
         {
           result = ecma_raise_reference_error (ECMA_ERR_MSG ("Undefined reference."));
           goto error;
         }
-        case VM_OC_EVAL:
+        VM_CASE (VM_OC_EVAL):
         {
           JERRY_CONTEXT (status_flags) |= ECMA_STATUS_DIRECT_EVAL;
           JERRY_ASSERT (*byte_code_p >= CBC_CALL && *byte_code_p <= CBC_CALL2_PROP_BLOCK);
           continue;
         }
-        case VM_OC_CALL:
+        VM_CASE (VM_OC_CALL):
         {
           frame_ctx_p->call_operation = VM_EXEC_CALL;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_NEW:
+        VM_CASE (VM_OC_NEW):
         {
           frame_ctx_p->call_operation = VM_EXEC_CONSTRUCT;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ERROR:
+        VM_CASE (VM_OC_ERROR):
         {
           JERRY_ASSERT (frame_ctx_p->byte_code_p[1] == CBC_EXT_ERROR);
 #if ENABLED (JERRY_DEBUGGER)
@@ -2071,7 +2606,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = ECMA_VALUE_ERROR;
           goto error;
         }
-        case VM_OC_RESOLVE_BASE_FOR_CALL:
+        VM_CASE (VM_OC_RESOLVE_BASE_FOR_CALL):
         {
           ecma_value_t this_value = stack_top_p[-3];
 
@@ -2089,7 +2624,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_PROP_DELETE:
+        VM_CASE (VM_OC_PROP_DELETE):
         {
           result = vm_op_delete_prop (left_value, right_value, is_strict);
 
@@ -2103,7 +2638,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DELETE:
+        VM_CASE (VM_OC_DELETE):
         {
           uint16_t literal_index;
 
@@ -2128,12 +2663,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_JUMP:
+        VM_CASE (VM_OC_JUMP):
         {
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_BRANCH_IF_STRICT_EQUAL:
+        VM_CASE (VM_OC_BRANCH_IF_STRICT_EQUAL):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -2147,10 +2682,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (value);
           continue;
         }
-        case VM_OC_BRANCH_IF_TRUE:
-        case VM_OC_BRANCH_IF_FALSE:
-        case VM_OC_BRANCH_IF_LOGICAL_TRUE:
-        case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+        VM_CASE (VM_OC_BRANCH_IF_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_FALSE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_FALSE):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_TRUE;
           ecma_value_t value = *(--stack_top_p);
@@ -2176,8 +2711,174 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_fast_free_value (value);
           continue;
         }
-        case VM_OC_PLUS:
-        case VM_OC_MINUS:
+        VM_CASE (VM_OC_BRANCH_IF_COMPARE):
+        {
+          uint8_t compare_argument = *byte_code_p++;
+          bool is_true;
+
+          branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
+          JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
+
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
+            ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
+
+            switch (CBC_COMPARE_BRANCH_GET_COMPARE (compare_argument))
+            {
+              case CBC_EQUAL:
+              case CBC_STRICT_EQUAL:
+              {
+                is_true = (left_integer == right_integer);
+                break;
+              }
+              case CBC_NOT_EQUAL:
+              case CBC_STRICT_NOT_EQUAL:
+              {
+                is_true = (left_integer != right_integer);
+                break;
+              }
+              case CBC_LESS:
+              {
+                is_true = (left_integer < right_integer);
+                break;
+              }
+              case CBC_GREATER:
+              {
+                is_true = (left_integer > right_integer);
+                break;
+              }
+              case CBC_LESS_EQUAL:
+              {
+                is_true = (left_integer <= right_integer);
+                break;
+              }
+              default:
+              {
+                JERRY_ASSERT (CBC_COMPARE_BRANCH_GET_COMPARE (compare_argument) == CBC_GREATER_EQUAL);
+                is_true = (left_integer >= right_integer);
+                break;
+              }
+            }
+          }
+          else if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            is_true = vm_compare_numbers (CBC_COMPARE_BRANCH_GET_COMPARE (compare_argument),
+                                          ecma_get_number_from_value (left_value),
+                                          ecma_get_number_from_value (right_value));
+
+            ecma_fast_free_value (left_value);
+            ecma_fast_free_value (right_value);
+          }
+          else
+          {
+            switch (CBC_COMPARE_BRANCH_GET_COMPARE (compare_argument))
+            {
+              case CBC_EQUAL:
+              case CBC_NOT_EQUAL:
+              {
+                result = opfunc_equality (left_value, right_value);
+                break;
+              }
+              case CBC_STRICT_EQUAL:
+              case CBC_STRICT_NOT_EQUAL:
+              {
+                result = ecma_make_boolean_value (ecma_op_strict_equality_compare (left_value, right_value));
+                break;
+              }
+              case CBC_LESS:
+              {
+                result = opfunc_relation (left_value, right_value, true, false);
+                break;
+              }
+              case CBC_GREATER:
+              {
+                result = opfunc_relation (left_value, right_value, false, false);
+                break;
+              }
+              case CBC_LESS_EQUAL:
+              {
+                result = opfunc_relation (left_value, right_value, false, true);
+                break;
+              }
+              default:
+              {
+                JERRY_ASSERT (CBC_COMPARE_BRANCH_GET_COMPARE (compare_argument) == CBC_GREATER_EQUAL);
+                result = opfunc_relation (left_value, right_value, true, true);
+                break;
+              }
+            }
+
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
+
+            is_true = ecma_is_value_true (result);
+
+            if (CBC_COMPARE_BRANCH_GET_COMPARE (compare_argument) == CBC_NOT_EQUAL
+                || CBC_COMPARE_BRANCH_GET_COMPARE (compare_argument) == CBC_STRICT_NOT_EQUAL)
+            {
+              is_true = !is_true;
+            }
+
+            ecma_fast_free_value (left_value);
+            ecma_fast_free_value (right_value);
+          }
+
+          if (compare_argument & CBC_COMPARE_BRANCH_IF_FALSE)
+          {
+            is_true = !is_true;
+          }
+
+          if (!is_true)
+          {
+            byte_code_p += branch_offset_length;
+            continue;
+          }
+
+          branch_offset = *(byte_code_p++);
+
+          if (JERRY_UNLIKELY (branch_offset_length != 1))
+          {
+            branch_offset <<= 8;
+            branch_offset |= *(byte_code_p++);
+
+            if (JERRY_UNLIKELY (branch_offset_length == 3))
+            {
+              branch_offset <<= 8;
+              branch_offset |= *(byte_code_p++);
+            }
+          }
+
+          if (!(opcode_data & VM_OC_BACKWARD_BRANCH))
+          {
+            byte_code_p = byte_code_start_p + branch_offset;
+            continue;
+          }
+
+          byte_code_p = byte_code_start_p - branch_offset;
+
+#if ENABLED (JERRY_VM_EXEC_STOP)
+          if (vm_check_exec_stop ())
+          {
+            /* The values are already released. */
+            left_value = ECMA_VALUE_UNDEFINED;
+            right_value = ECMA_VALUE_UNDEFINED;
+            result = ECMA_VALUE_ERROR;
+            goto error;
+          }
+#endif /* ENABLED (JERRY_VM_EXEC_STOP) */
+#if ENABLED (JERRY_GC_INCREMENTAL)
+          if (JERRY_UNLIKELY (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE))
+          {
+            ecma_gc_step (CONFIG_ECMA_GC_INCREMENTAL_STEP);
+          }
+#endif /* ENABLED (JERRY_GC_INCREMENTAL) */
+          continue;
+        }
+        VM_CASE (VM_OC_PLUS):
+        VM_CASE (VM_OC_MINUS):
         {
           result = opfunc_unary_operation (left_value, VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_PLUS);
 
@@ -2189,20 +2890,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_NOT:
+        VM_CASE (VM_OC_NOT):
         {
           *stack_top_p++ = ecma_make_boolean_value (!ecma_op_to_boolean (left_value));
           JERRY_ASSERT (ecma_is_value_boolean (stack_top_p[-1]));
           goto free_left_value;
         }
-        case VM_OC_BIT_NOT:
+        VM_CASE (VM_OC_BIT_NOT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
 
           if (ecma_is_value_integer_number (left_value))
           {
-            *stack_top_p++ = (~left_value) & (ecma_value_t) (~ECMA_DIRECT_TYPE_MASK);
+            *stack_top_p++ = (ecma_value_t) ((~(uint32_t) left_value) & ~ECMA_DIRECT_TYPE_MASK);
             goto free_left_value;
           }
 
@@ -2218,12 +2919,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_VOID:
+        VM_CASE (VM_OC_VOID):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           goto free_left_value;
         }
-        case VM_OC_TYPEOF_IDENT:
+        VM_CASE (VM_OC_TYPEOF_IDENT):
         {
           uint16_t literal_index;
 
@@ -2259,7 +2960,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_TYPEOF:
+        VM_CASE (VM_OC_TYPEOF):
         {
           result = opfunc_typeof (left_value);
 
@@ -2271,7 +2972,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_ADD:
+        VM_CASE (VM_OC_ADD):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -2312,7 +3013,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_SUB:
+        VM_CASE (VM_OC_SUB):
         {
           JERRY_STATIC_ASSERT (ECMA_INTEGER_NUMBER_MAX * 2 <= INT32_MAX
                                && ECMA_INTEGER_NUMBER_MIN * 2 >= INT32_MIN,
@@ -2362,7 +3063,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MUL:
+        VM_CASE (VM_OC_MUL):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -2425,7 +3126,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DIV:
+        VM_CASE (VM_OC_DIV):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -2442,7 +3143,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MOD:
+        VM_CASE (VM_OC_MOD):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -2476,7 +3177,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_EQUAL:
+        VM_CASE (VM_OC_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -2488,7 +3189,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_NOT_EQUAL:
+        VM_CASE (VM_OC_NOT_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -2500,7 +3201,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_invert_boolean_value (result);
           goto free_both_values;
         }
-        case VM_OC_STRICT_EQUAL:
+        VM_CASE (VM_OC_STRICT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
@@ -2509,7 +3210,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_STRICT_NOT_EQUAL:
+        VM_CASE (VM_OC_STRICT_NOT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
@@ -2518,7 +3219,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_OR:
+        VM_CASE (VM_OC_BIT_OR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -2541,7 +3242,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_XOR:
+        VM_CASE (VM_OC_BIT_XOR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -2564,7 +3265,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_AND:
+        VM_CASE (VM_OC_BIT_AND):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -2587,7 +3288,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LEFT_SHIFT:
+        VM_CASE (VM_OC_LEFT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -2612,7 +3313,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_RIGHT_SHIFT:
+        VM_CASE (VM_OC_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -2637,7 +3338,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_UNS_RIGHT_SHIFT:
+        VM_CASE (VM_OC_UNS_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -2662,47 +3363,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS:
+        VM_CASE (VM_OC_LESS):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
-            bool is_less = (ecma_integer_value_t) left_value < (ecma_integer_value_t) right_value;
-#if !ENABLED (JERRY_VM_EXEC_STOP)
-            /* This is a lookahead to the next opcode to improve performance.
-             * If it is CBC_BRANCH_IF_TRUE_BACKWARD, execute it. */
-            if (*byte_code_p <= CBC_BRANCH_IF_TRUE_BACKWARD_3 && *byte_code_p >= CBC_BRANCH_IF_TRUE_BACKWARD)
-            {
-              byte_code_start_p = byte_code_p++;
-              branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (*byte_code_start_p);
-              JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
-
-              if (is_less)
-              {
-                branch_offset = *(byte_code_p++);
-
-                if (JERRY_UNLIKELY (branch_offset_length != 1))
-                {
-                  branch_offset <<= 8;
-                  branch_offset |= *(byte_code_p++);
-                  if (JERRY_UNLIKELY (branch_offset_length == 3))
-                  {
-                    branch_offset <<= 8;
-                    branch_offset |= *(byte_code_p++);
-                  }
-                }
-
-                /* Note: The opcode is a backward branch. */
-                byte_code_p = byte_code_start_p - branch_offset;
-              }
-              else
-              {
-                byte_code_p += branch_offset_length;
-              }
+            ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
+            ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
 
-              continue;
-            }
-#endif /* !ENABLED (JERRY_VM_EXEC_STOP) */
-            *stack_top_p++ = ecma_make_boolean_value (is_less);
+            *stack_top_p++ = ecma_make_boolean_value (left_integer < right_integer);
             continue;
           }
 
@@ -2725,7 +3393,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_GREATER:
+        VM_CASE (VM_OC_GREATER):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -2755,7 +3423,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS_EQUAL:
+        VM_CASE (VM_OC_LESS_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -2785,7 +3453,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_GREATER_EQUAL:
+        VM_CASE (VM_OC_GREATER_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -2815,7 +3483,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_IN:
+        VM_CASE (VM_OC_IN):
         {
           result = opfunc_in (left_value, right_value);
 
@@ -2827,7 +3495,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_INSTANCEOF:
+        VM_CASE (VM_OC_INSTANCEOF):
         {
           result = opfunc_instanceof (left_value, right_value);
 
@@ -2839,7 +3507,73 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_WITH:
+        VM_CASE (VM_OC_ARITHMETIC_SET_IDENT):
+        {
+          uint16_t literal_index;
+
+          READ_LITERAL_INDEX (literal_index);
+
+          uint32_t arithmetic_opcode = CBC_ARITHMETIC_SET_IDENT_GET_OPCODE (*byte_code_p++);
+
+          result = ECMA_VALUE_EMPTY;
+
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            result = vm_integer_arithmetic (arithmetic_opcode, left_value, right_value);
+          }
+
+          if (result == ECMA_VALUE_EMPTY)
+          {
+            result = vm_arithmetic (arithmetic_opcode, left_value, right_value);
+
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
+          }
+
+          if (literal_index < register_end)
+          {
+            ecma_fast_free_value (frame_ctx_p->registers_p[literal_index]);
+
+            frame_ctx_p->registers_p[literal_index] = result;
+
+            if (!(opcode_data & (VM_OC_PUT_STACK | VM_OC_PUT_BLOCK)))
+            {
+              goto free_both_values;
+            }
+
+            result = ecma_fast_copy_value (result);
+          }
+          else
+          {
+            ecma_string_t *var_name_str_p = ecma_get_string_from_value (literal_start_p[literal_index]);
+
+            ecma_value_t put_value_result = vm_op_set_ident_value (byte_code_p,
+                                                                   frame_ctx_p->lex_env_p,
+                                                                   var_name_str_p,
+                                                                   is_strict,
+                                                                   result);
+
+            if (ECMA_IS_VALUE_ERROR (put_value_result))
+            {
+              ecma_free_value (result);
+              result = put_value_result;
+              goto error;
+            }
+
+            if (!(opcode_data & (VM_OC_PUT_STACK | VM_OC_PUT_BLOCK)))
+            {
+              ecma_fast_free_value (result);
+              goto free_both_values;
+            }
+          }
+
+          /* The identifier is already updated. */
+          opcode_data &= (uint32_t) ~VM_OC_PUT_IDENT;
+          break;
+        }
+        VM_CASE (VM_OC_WITH):
         {
           ecma_value_t value = *(--stack_top_p);
           ecma_object_t *object_p;
@@ -2872,7 +3606,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = with_env_p;
           continue;
         }
-        case VM_OC_FOR_IN_CREATE_CONTEXT:
+        VM_CASE (VM_OC_FOR_IN_CREATE_CONTEXT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -2900,7 +3634,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_FOR_IN_GET_NEXT:
+        VM_CASE (VM_OC_FOR_IN_GET_NEXT):
         {
           ecma_value_t *context_top_p = frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth;
 
@@ -2909,14 +3643,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_IN);
 
-          uint32_t index = context_top_p[-3];
+          uint32_t index = (uint32_t) context_top_p[-3];
           ecma_value_t *buffer_p = collection_p->buffer_p;
 
           *stack_top_p++ = buffer_p[index];
           context_top_p[-3]++;
           continue;
         }
-        case VM_OC_FOR_IN_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_IN_HAS_NEXT):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -2927,7 +3661,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           ecma_value_t *buffer_p = collection_p->buffer_p;
           ecma_object_t *object_p = ecma_get_object_from_value (stack_top_p[-4]);
-          uint32_t index = stack_top_p[-3];
+          uint32_t index = (uint32_t) stack_top_p[-3];
 
           while (index < collection_p->item_count)
           {
@@ -2957,7 +3691,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_ES2015_FOR_OF)
-        case VM_OC_FOR_OF_CREATE_CONTEXT:
+        VM_CASE (VM_OC_FOR_OF_CREATE_CONTEXT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -2999,7 +3733,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_FOR_OF_GET_NEXT:
+        VM_CASE (VM_OC_FOR_OF_GET_NEXT):
         {
           ecma_value_t *context_top_p = frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth;
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_OF);
@@ -3015,7 +3749,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = next_value;
           continue;
         }
-        case VM_OC_FOR_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_OF_HAS_NEXT):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -3043,7 +3777,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* ENABLED (JERRY_ES2015_FOR_OF) */
-        case VM_OC_TRY:
+        VM_CASE (VM_OC_TRY):
         {
           /* Try opcode simply creates the try context. */
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -3056,7 +3790,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] = (ecma_value_t) VM_CREATE_CONTEXT (VM_CONTEXT_TRY, branch_offset);
           continue;
         }
-        case VM_OC_CATCH:
+        VM_CASE (VM_OC_CATCH):
         {
           /* Catches are ignored and turned to jumps. */
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
@@ -3065,7 +3799,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_FINALLY:
+        VM_CASE (VM_OC_FINALLY):
         {
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
 
@@ -3086,7 +3820,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-2] = (ecma_value_t) branch_offset;
           continue;
         }
-        case VM_OC_CONTEXT_END:
+        VM_CASE (VM_OC_CONTEXT_END):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -3094,7 +3828,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             case VM_CONTEXT_FINALLY_JUMP:
             {
-              uint32_t jump_target = stack_top_p[-2];
+              uint32_t jump_target = (uint32_t) stack_top_p[-2];
 
               VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth,
                                   PARSER_TRY_CONTEXT_STACK_ALLOCATION);
@@ -3148,7 +3882,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
           continue;
         }
-        case VM_OC_JUMP_AND_EXIT_CONTEXT:
+        VM_CASE (VM_OC_JUMP_AND_EXIT_CONTEXT):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -3172,7 +3906,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_DEBUGGER)
-        case VM_OC_BREAKPOINT_ENABLED:
+        VM_CASE (VM_OC_BREAKPOINT_ENABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
@@ -3193,7 +3927,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_BREAKPOINT_DISABLED:
+        VM_CASE (VM_OC_BREAKPOINT_DISABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
@@ -3247,7 +3981,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
 #endif /* ENABLED (JERRY_DEBUGGER) */
 #if ENABLED (JERRY_LINE_INFO)
-        case VM_OC_RESOURCE_NAME:
+        VM_CASE (VM_OC_RESOURCE_NAME):
         {
           ecma_length_t formal_params_number = 0;
 
@@ -3276,7 +4010,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->resource_name = resource_name_p[-1];
           continue;
         }
-        case VM_OC_LINE:
+        VM_CASE (VM_OC_LINE):
         {
           uint32_t value = 0;
           uint8_t byte;
@@ -3292,6 +4026,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* ENABLED (JERRY_LINE_INFO) */
+        VM_CASE (VM_OC_NONE):
         default:
         {
           JERRY_ASSERT (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_NONE);
@@ -3323,10 +4058,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           ecma_string_t *var_name_str_p = ecma_get_string_from_value (literal_start_p[literal_index]);
 
-          ecma_value_t put_value_result = ecma_op_put_value_lex_env_base (frame_ctx_p->lex_env_p,
-                                                                          var_name_str_p,
-                                                                          is_strict,
-                                                                          result);
+          ecma_value_t put_value_result = vm_op_set_ident_value (byte_code_p,
+                                                                 frame_ctx_p->lex_env_p,
+                                                                 var_name_str_p,
+                                                                 is_strict,
+                                                                 result);
 
           if (ECMA_IS_VALUE_ERROR (put_value_result))
           {
@@ -3360,7 +4096,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         else
         {
-          ecma_value_t set_value_result = vm_op_set_value (object,
+          ecma_value_t set_value_result = vm_op_set_value (byte_code_start_p,
+                                                           object,
                                                            property,
                                                            result,
                                                            is_strict);
@@ -3544,6 +4281,10 @@ error:
   }
 } /* vm_loop */
 
+#ifdef VM_THREADED_DISPATCH
+#pragma GCC diagnostic pop
+#endif /* VM_THREADED_DISPATCH */
+
 #undef READ_LITERAL
 #undef READ_LITERAL_INDEX
 
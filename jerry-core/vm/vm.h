@@ -100,6 +100,8 @@ typedef enum
 
 /**
  * Opcodes.
+ *
+ * Note: vm_dispatch_table in vm.c must follow the order of this list.
  */
 typedef enum
 {
@@ -171,6 +173,7 @@ typedef enum
   VM_OC_BRANCH_IF_FALSE,         /**< branch if false */
   VM_OC_BRANCH_IF_LOGICAL_TRUE,  /**< branch if logical true */
   VM_OC_BRANCH_IF_LOGICAL_FALSE, /**< branch if logical false */
+  VM_OC_BRANCH_IF_COMPARE,       /**< compare and branch */
 
   VM_OC_PLUS,                    /**< unary plus */
   VM_OC_MINUS,                   /**< unary minus */
@@ -203,6 +206,7 @@ typedef enum
   VM_OC_LEFT_SHIFT,              /**< left shift */
   VM_OC_RIGHT_SHIFT,             /**< right shift */
   VM_OC_UNS_RIGHT_SHIFT,         /**< unsigned right shift */
+  VM_OC_ARITHMETIC_SET_IDENT,    /**< arithmetic operation and assignment to an identifier */
 
   VM_OC_WITH,                    /**< with */
   VM_OC_FOR_IN_CREATE_CONTEXT,   /**< for in create context */
@@ -314,6 +314,7 @@ typedef enum
   OPT_VERSION,
   OPT_MEM_STATS,
   OPT_PARSE_ONLY,
+  OPT_LAZY_FUNCTIONS,
   OPT_SHOW_OP,
   OPT_SHOW_RE_OP,
   OPT_DEBUG_SERVER,
@@ -341,6 +342,8 @@ static const cli_opt_t main_opts[] =
                .help = "dump memory statistics"),
   CLI_OPT_DEF (.id = OPT_PARSE_ONLY, .longopt = "parse-only",
                .help = "don't execute JS input"),
+  CLI_OPT_DEF (.id = OPT_LAZY_FUNCTIONS, .longopt = "lazy-functions",
+               .help = "compile functions on their first call"),
   CLI_OPT_DEF (.id = OPT_SHOW_OP, .longopt = "show-opcodes",
                .help = "dump parser byte-code"),
   CLI_OPT_DEF (.id = OPT_SHOW_RE_OP, .longopt = "show-regexp-opcodes",
@@ -475,7 +478,12 @@ main (int argc,
   JERRY_VLA (uint32_t, exec_snapshot_file_indices, argc);
   int exec_snapshots_count = 0;
 
+  JERRY_VLA (const uint8_t *, mapped_snapshots, argc);
+  JERRY_VLA (size_t, mapped_snapshot_sizes, argc);
+  int mapped_snapshots_count = 0;
+
   bool is_parse_only = false;
+  uint32_t parse_opts = JERRY_PARSE_NO_OPTS;
 
   bool start_debug_server = false;
   uint16_t debug_port = 5001;
@@ -520,6 +528,11 @@ main (int argc,
         is_parse_only = true;
         break;
       }
+      case OPT_LAZY_FUNCTIONS:
+      {
+        parse_opts |= JERRY_PARSE_LAZY_FUNCTIONS;
+        break;
+      }
       case OPT_SHOW_OP:
       {
         if (check_feature (JERRY_FEATURE_PARSER_DUMP, cli_state.arg))
@@ -684,7 +697,7 @@ main (int argc,
     for (int i = 0; i < exec_snapshots_count; i++)
     {
       size_t snapshot_size;
-      const uint32_t *snapshot_p = read_file (exec_snapshot_file_names[i], &snapshot_size);
+      const uint8_t *snapshot_p = jerry_port_default_map_file (exec_snapshot_file_names[i], &snapshot_size);
 
       if (snapshot_p == NULL)
       {
@@ -692,10 +705,14 @@ main (int argc,
       }
       else
       {
-        ret_value = jerry_exec_snapshot (snapshot_p,
+        /* The byte code is executed in place, so the file is unmapped after the engine is cleaned up. */
+        mapped_snapshots[mapped_snapshots_count] = snapshot_p;
+        mapped_snapshot_sizes[mapped_snapshots_count++] = snapshot_size;
+
+        ret_value = jerry_exec_snapshot ((const uint32_t *) snapshot_p,
                                          snapshot_size,
                                          exec_snapshot_file_indices[i],
-                                         JERRY_SNAPSHOT_EXEC_COPY_DATA);
+                                         JERRY_SNAPSHOT_EXEC_ALLOW_STATIC);
       }
 
       if (jerry_value_is_error (ret_value))
@@ -731,7 +748,7 @@ main (int argc,
                                  strlen (file_names[i]),
                                  source_p,
                                  source_size,
-                                 JERRY_PARSE_NO_OPTS);
+                                 parse_opts);
 
         if (!jerry_value_is_error (ret_value) && !is_parse_only)
         {
@@ -935,6 +952,12 @@ main (int argc,
   jerry_release_value (ret_value);
 
   jerry_cleanup ();
+
+  for (int i = 0; i < mapped_snapshots_count; i++)
+  {
+    jerry_port_default_unmap_file (mapped_snapshots[i], mapped_snapshot_sizes[i]);
+  }
+
 #if defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1)
   free (context_p);
 #endif /* defined (JERRY_EXTERNAL_CONTEXT) && (JERRY_EXTERNAL_CONTEXT == 1) */
@@ -0,0 +1,94 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef HAVE_SYS_MMAN_H
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* HAVE_SYS_MMAN_H */
+
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+
+/**
+ * Map the contents of a file into the memory as read-only data.
+ *
+ * The pages of a mapping are loaded on demand and they are shared by all processes
+ * which map the same file, so snapshots executed in place from a mapped file are
+ * neither read nor copied before they are used.
+ *
+ * Note:
+ *      if memory mapping is not available, the file is read into a newly allocated buffer
+ *
+ * @return contents of the file - if successful
+ *         NULL - otherwise
+ */
+const uint8_t *
+jerry_port_default_map_file (const char *file_name_p, /**< file name */
+                             size_t *out_size_p) /**< [out] size of the file */
+{
+#ifdef HAVE_SYS_MMAN_H
+  int fd = open (file_name_p, O_RDONLY);
+
+  if (fd < 0)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to open file: %s\n", file_name_p);
+    return NULL;
+  }
+
+  struct stat file_stat;
+
+  if (fstat (fd, &file_stat) != 0 || file_stat.st_size <= 0)
+  {
+    close (fd);
+
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to read file: %s\n", file_name_p);
+    return NULL;
+  }
+
+  size_t file_size = (size_t) file_stat.st_size;
+  void *buffer_p = mmap (NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  /* The mapping remains valid after the file is closed. */
+  close (fd);
+
+  if (buffer_p == MAP_FAILED)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to map file: %s\n", file_name_p);
+    return NULL;
+  }
+
+  *out_size_p = file_size;
+  return (const uint8_t *) buffer_p;
+#else /* !HAVE_SYS_MMAN_H */
+  return jerry_port_read_source (file_name_p, out_size_p);
+#endif /* HAVE_SYS_MMAN_H */
+} /* jerry_port_default_map_file */
+
+/**
+ * Release a file mapped by jerry_port_default_map_file.
+ */
+void
+jerry_port_default_unmap_file (const uint8_t *buffer_p, /**< contents of the file */
+                               size_t size) /**< size of the file */
+{
+#ifdef HAVE_SYS_MMAN_H
+  munmap ((void *) buffer_p, size);
+#else /* !HAVE_SYS_MMAN_H */
+  (void) size;
+  jerry_port_release_source ((uint8_t *) buffer_p);
+#endif /* HAVE_SYS_MMAN_H */
+} /* jerry_port_default_unmap_file */
@@ -36,6 +36,9 @@ void jerry_port_default_set_log_level (jerry_log_level_t level);
 
 void jerry_port_default_set_current_context (jerry_context_t *context_p);
 
+const uint8_t *jerry_port_default_map_file (const char *file_name_p, size_t *out_size_p);
+void jerry_port_default_unmap_file (const uint8_t *buffer_p, size_t size);
+
 /**
  * @}
  */
@@ -98,7 +98,9 @@ def build_jerry_data(jerry_path):
         '-DJERRY_BUILTIN_ANNEXB=0',
         '-DJERRY_ES2015=0',
         '-DJERRY_LCACHE=0',
+        '-DJERRY_ICACHE=0',
         '-DJERRY_PROPRETY_HASHMAP=0',
+        '-DJERRY_PROPERTY_SHAPES=0',
     ]
 
     return {
@@ -0,0 +1,65 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Measures the pause time of the garbage collector for object
+ * graphs of different sizes and depths. Every object is allocated
+ * after its parent, which is the worst case for list rescanning. */
+
+function create_graph (size, depth)
+{
+  var roots = [];
+  var chains = size / depth;
+
+  for (var i = 0; i < chains; i++)
+  {
+    var obj = {};
+    roots.push (obj);
+
+    for (var j = 1; j < depth; j++)
+    {
+      obj.next = {};
+      obj = obj.next;
+    }
+  }
+
+  return roots;
+}
+
+function measure (size, depth)
+{
+  var repeat = 10;
+  var pause = 0;
+
+  for (var i = 0; i < repeat; i++)
+  {
+    var graph = create_graph (size, depth);
+    var start = Date.now ();
+    gc ();
+    pause += Date.now () - start;
+    graph = null;
+  }
+
+  print ("objects: " + size + "\tdepth: " + depth + "\tpause: " + (pause / repeat) + " ms");
+}
+
+var sizes = [1000, 2000, 4000, 8000];
+var depths = [1, 10, 100, 1000];
+
+for (var i = 0; i < sizes.length; i++)
+{
+  for (var j = 0; j < depths.length; j++)
+  {
+    measure (sizes[i], depths[j]);
+  }
+}
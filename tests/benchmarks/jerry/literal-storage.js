@@ -0,0 +1,58 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Measures the parse time of generated scripts with many distinct
+ * identifiers and floating point numbers, which are all stored in
+ * the literal storage. The identifiers are split between functions
+ * to stay below the literal limit of a single function. The largest
+ * script needs a bigger heap than the default, e.g.
+ * --cpointer-32bit=on --mem-heap=16384 */
+
+function generate_source (count, prefix)
+{
+  var lines = [];
+  var per_function = 5000;
+
+  for (var i = 0; i < count; i++)
+  {
+    if (i % per_function == 0)
+    {
+      lines.push ((i == 0 ? "" : "}\n") + "function " + prefix + "f" + (i / per_function) + " () {");
+    }
+
+    lines.push ("var " + prefix + i + " = " + (i + 0.5) + ";");
+  }
+
+  lines.push ("}");
+  return lines.join ("\n");
+}
+
+function measure (count, prefix)
+{
+  var source = generate_source (count, prefix);
+
+  var start = Date.now ();
+  var func = new Function (source);
+  var time = Date.now () - start;
+
+  print ("identifiers: " + count + "\tparse: " + time + " ms");
+}
+
+var counts = [1000, 5000, 10000, 50000];
+
+for (var i = 0; i < counts.length; i++)
+{
+  /* Each script uses new identifiers, so none of them are stored already. */
+  measure (counts[i], "id" + i + "_");
+}
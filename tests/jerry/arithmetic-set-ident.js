@@ -0,0 +1,154 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Arithmetic operations assigned to local variables (registers) */
+function local_arithmetic (a, b) {
+  var results = [];
+  var o = { a: a, b: b };
+  var r;
+
+  r = a + b; results.push (r);
+  r = a - b; results.push (r);
+  r = a * b; results.push (r);
+  r = a / b; results.push (r);
+  r = a % b; results.push (r);
+  r = a | b; results.push (r);
+  r = a ^ b; results.push (r);
+  r = a & b; results.push (r);
+  r = a << b; results.push (r);
+  r = a >> b; results.push (r);
+  r = a >>> b; results.push (r);
+
+  /* A stack value and a literal */
+  r = o.a + b; results.push (r);
+  r = o.a * b; results.push (r);
+  r = o.a >>> b; results.push (r);
+
+  /* Two stack values */
+  r = o.a - o.b; results.push (r);
+  r = o.a % o.b; results.push (r);
+  r = o.a ^ o.b; results.push (r);
+
+  return results.join ();
+}
+
+assert (local_arithmetic (7, 2) === "9,5,14,3.5,1,7,5,2,28,1,1,9,14,1,5,1,5");
+assert (local_arithmetic (-7, 2) === "-5,-9,-14,-3.5,-1,-5,-5,0,-28,-2,1073741822,-5,-14,1073741822,-9,-1,-5");
+assert (local_arithmetic (0.5, 2) === "2.5,-1.5,1,0.25,0.5,2,2,0,0,0,0,2.5,1,0,-1.5,0.5,2");
+assert (local_arithmetic ("3", 2) === "32,1,6,1.5,1,3,1,2,12,0,0,32,6,0,1,1,1");
+assert (local_arithmetic (65536, 65536) === "131072,0,4294967296,1,0,65536,0,65536,65536,65536,65536,131072,4294967296,65536,0,0,0");
+
+/* Negative zero */
+function negative_zero (a, b) {
+  var r = a * b;
+  var s = a % b;
+  return (1 / r) + "," + (1 / s);
+}
+
+assert (negative_zero (0, -5) === "-Infinity,Infinity");
+assert (negative_zero (-4, 2) === "-0.125,-Infinity");
+
+/* Compound assignments */
+function compound (n) {
+  var s = 0;
+  var t = 1;
+  var str = "";
+
+  for (var i = 0; i < n; i++) {
+    s += i;
+    t *= 2;
+    t -= 1;
+    str += i;
+  }
+
+  s <<= 2;
+  s >>= 1;
+  s |= 1;
+  s &= 0xff;
+  s ^= 3;
+  s %= 100;
+  s /= 2;
+
+  return s + "," + t + "," + str;
+}
+
+assert (compound (10) === "44," + 1 + ",0123456789");
+
+/* The result of the assignment is used */
+function push_result (a) {
+  var x, y;
+  y = (x = a + 1) * 2;
+  var z = [x = x - a, x += 5];
+  return x + "," + y + "," + z.join (":");
+}
+
+assert (push_result (4) === "6,10,1:6");
+
+/* Global variables and eval */
+var g = 5;
+g += 2;
+g = g * 3;
+assert (g === 21);
+assert (eval ("g -= 1") === 20);
+assert (eval ("var h = 4; h = h + g") === 24);
+assert (h === 24);
+
+/* The left operand is read before the right operand is evaluated */
+var counter = 10;
+var side_effect = { valueOf: function () { counter = 100; return 1; } };
+counter += side_effect;
+assert (counter === 11);
+
+function local_side_effect () {
+  var c = 10;
+  function inc () { c = 100; return 1; }
+  c += inc ();
+  return c;
+}
+
+assert (local_side_effect () === 11);
+
+/* Exceptions */
+var error = { valueOf: function () { throw new Error ("arithmetic"); } };
+
+function throws (a) {
+  var r = 1;
+  try {
+    r = r - a;
+    assert (false);
+  } catch (e) {
+    assert (e.message === "arithmetic");
+  }
+  return r;
+}
+
+assert (throws (error) === 1);
+
+(function () {
+  "use strict";
+  try {
+    undeclared_variable += 1;
+    assert (false);
+  } catch (e) {
+    assert (e instanceof ReferenceError);
+  }
+}) ();
+
+/* Variables of a with statement */
+var with_object = { w: 1 };
+with (with_object) {
+  w += 2;
+  w = w * 3;
+}
+assert (with_object.w === 9);
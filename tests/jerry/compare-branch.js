@@ -0,0 +1,180 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Comparisons in conditions: two literals, a literal and a stack value, two stack values */
+function compare (a, b) {
+  var result = "";
+  var o = { a: a, b: b };
+
+  if (a == b) { result += "1"; } else { result += "0"; }
+  if (a != b) { result += "1"; } else { result += "0"; }
+  if (a === b) { result += "1"; } else { result += "0"; }
+  if (a !== b) { result += "1"; } else { result += "0"; }
+  if (a < b) { result += "1"; } else { result += "0"; }
+  if (a > b) { result += "1"; } else { result += "0"; }
+  if (a <= b) { result += "1"; } else { result += "0"; }
+  if (a >= b) { result += "1"; } else { result += "0"; }
+
+  result += "|";
+
+  if (o.a == b) { result += "1"; } else { result += "0"; }
+  if (o.a != b) { result += "1"; } else { result += "0"; }
+  if (o.a === b) { result += "1"; } else { result += "0"; }
+  if (o.a !== b) { result += "1"; } else { result += "0"; }
+  if (o.a < b) { result += "1"; } else { result += "0"; }
+  if (o.a > b) { result += "1"; } else { result += "0"; }
+  if (o.a <= b) { result += "1"; } else { result += "0"; }
+  if (o.a >= b) { result += "1"; } else { result += "0"; }
+
+  result += "|";
+
+  result += (o.a == o.b) ? "1" : "0";
+  result += (o.a != o.b) ? "1" : "0";
+  result += (o.a === o.b) ? "1" : "0";
+  result += (o.a !== o.b) ? "1" : "0";
+  result += (o.a < o.b) ? "1" : "0";
+  result += (o.a > o.b) ? "1" : "0";
+  result += (o.a <= o.b) ? "1" : "0";
+  result += (o.a >= o.b) ? "1" : "0";
+
+  return result;
+}
+
+function check (a, b, expected) {
+  assert (compare (a, b) === expected + "|" + expected + "|" + expected);
+}
+
+check (1, 2, "01011010");
+check (2, 1, "01010101");
+check (2, 2, "10100011");
+check (-5, 3, "01011010");
+check (1.5, 2.5, "01011010");
+check (2.5, 2.5, "10100011");
+check (NaN, 1, "01010000");
+check (NaN, NaN, "01010000");
+check (Infinity, 1e308, "01010101");
+check ("a", "b", "01011010");
+check ("b", "b", "10100011");
+check ("10", 9, "01010101");
+check ("1", 1, "10010011");
+check (null, undefined, "10010000");
+check (null, 0, "01010011");
+check (true, 1, "10010011");
+
+var value_of_calls = [];
+var left = { valueOf: function () { value_of_calls.push ("left"); return 1; } };
+var right = { valueOf: function () { value_of_calls.push ("right"); return 2; } };
+
+if (left < right) {
+  value_of_calls.push ("taken");
+}
+if (left > right) {
+  value_of_calls.push ("not taken");
+}
+assert (value_of_calls.join () === "left,right,taken,left,right");
+
+/* Exceptions thrown by the comparison */
+var error = { valueOf: function () { throw new Error ("compare"); } };
+
+try {
+  if (error < 5) {
+    assert (false);
+  }
+  assert (false);
+} catch (e) {
+  assert (e.message === "compare");
+}
+
+var count = 0;
+try {
+  for (var i = 0; i < error; i++) {
+    count++;
+  }
+  assert (false);
+} catch (e) {
+  assert (e.message === "compare" && count === 0);
+}
+
+/* Loop conditions */
+var sum = 0;
+for (var i = 0; i < 100; i++) {
+  sum += i;
+}
+assert (sum === 4950);
+
+sum = 0;
+for (var i = 100; i >= 0.5; i -= 0.5) {
+  sum++;
+}
+assert (sum === 200);
+
+var j = 0;
+while (j !== 10) {
+  j++;
+}
+assert (j === 10);
+
+j = 10;
+do {
+  j--;
+} while (j > 3);
+assert (j === 3);
+
+var limits = { n: 5 };
+for (j = 0; j <= limits.n; j++) {
+}
+assert (j === 6);
+
+/* Strings compared in a loop */
+var str = "";
+while (str < "aaaa") {
+  str += "a";
+}
+assert (str === "aaaa");
+
+/* Long branches */
+function long_branches (n) {
+  var result = 0;
+
+  for (var i = 0; i < n; i++) {
+    if (i != 3) {
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+      result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1; result += i * 2 + 1;
+    }
+  }
+
+  return result;
+}
+
+assert (long_branches (5) === 52 * (1 + 3 + 5 + 9));
+
+/* Comparisons with many literals */
+var source = "var r = 0;";
+for (var i = 0; i < 300; i++) {
+  source += "var v" + i + " = " + i + ";";
+}
+source += "for (var k = 0; k < 3; k++) { if (v299 > v0) r++; if (v1 === 1.5) r += 10; }";
+source += "r;";
+assert (eval (source) === 3);
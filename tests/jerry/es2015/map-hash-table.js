@@ -0,0 +1,133 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* SameValueZero keys */
+var m = new Map();
+m.set(-0, "zero");
+assert(m.get(0) === "zero");
+assert(m.get(-0) === "zero");
+assert(1 / m.keys().next().value === Infinity);
+
+m.set(NaN, "nan");
+assert(m.get(NaN) === "nan");
+assert(m.get(0 / 0) === "nan");
+assert(m.size === 2);
+
+m.set(1.5, "a");
+m.set(3 / 2, "b");
+assert(m.get(1.5) === "b");
+m.set(2.5 - 0.5, "two");
+assert(m.get(2) === "two");
+m.set("2", "string");
+assert(m.get(2) === "two");
+assert(m.get("2") === "string");
+assert(m.size === 5);
+
+var o1 = {};
+var o2 = {};
+m.set(o1, 1);
+m.set(o2, 2);
+assert(m.get(o1) === 1);
+assert(m.get(o2) === 2);
+assert(m.get({}) === undefined);
+assert(Object.getOwnPropertyNames(o1).length === 0);
+
+var s = new Set([0, -0, NaN, NaN, "a", "a" + ""]);
+assert(s.size === 3);
+assert(s.has(-0));
+
+/* Deleting while iterating */
+m = new Map();
+for (var i = 0; i < 100; i++) {
+  m.set(i, i * 2);
+}
+
+var iter = m.entries();
+var visited = 0;
+var result = iter.next();
+
+while (!result.done) {
+  assert(result.value[1] === result.value[0] * 2);
+  assert(result.value[0] % 2 === 0);
+  m.delete(result.value[0] + 1);
+  visited++;
+  result = iter.next();
+}
+assert(visited === 50);
+assert(m.size === 50);
+
+/* Iterators keep their position when the table is rebuilt */
+s = new Set();
+for (i = 0; i < 64; i++) {
+  s.add(i);
+}
+
+iter = s.values();
+for (i = 0; i < 10; i++) {
+  assert(iter.next().value === i);
+}
+
+for (i = 0; i < 60; i++) {
+  s.delete(i);
+}
+
+for (i = 100; i < 200; i++) {
+  s.add(i);
+}
+
+var expected = [60, 61, 62, 63];
+for (i = 100; i < 200; i++) {
+  expected.push(i);
+}
+
+for (i = 0; i < expected.length; i++) {
+  assert(iter.next().value === expected[i]);
+}
+assert(iter.next().done);
+
+/* Entries added during forEach are visited */
+m = new Map([[1, 1]]);
+var keys = [];
+m.forEach(function (value, key) {
+  keys.push(key);
+  if (key < 50) {
+    m.delete(key);
+    m.set(key + 1, value);
+  }
+});
+assert(keys.length === 50);
+assert(m.size === 1);
+assert(m.get(50) === 1);
+
+/* Clear restarts the iterators */
+s = new Set([1, 2, 3]);
+iter = s.keys();
+assert(iter.next().value === 1);
+s.clear();
+assert(s.size === 0);
+s.add(4);
+assert(iter.next().value === 4);
+assert(iter.next().done);
+s.add(5);
+assert(iter.next().done);
+
+/* Nested forEach on the same map */
+m = new Map([["a", 1], ["b", 2]]);
+var pairs = "";
+m.forEach(function (v1, k1) {
+  m.forEach(function (v2, k2) {
+    pairs += k1 + k2;
+  });
+});
+assert(pairs === "aaabbabb");
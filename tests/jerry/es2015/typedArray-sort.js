@@ -72,3 +72,29 @@ i.sort(function (lhs, rhs) {
   return { valueOf: function() { return rhs - lhs; } };
 });
 assert(i.toString() === '3,2,1');
+
+// Signed single byte elements.
+var j = new Int8Array([5, -3, 127, -128, 0, -1, 5]);
+assert(j.sort().toString() === '-128,-3,-1,0,5,5,127');
+
+// Arrays which are long enough to be partitioned.
+var k = new Int32Array(1000);
+for (var idx = 0; idx < k.length; idx++) {
+  k[idx] = (idx * 2654435761) | 0;
+}
+k.sort();
+for (var idx = 1; idx < k.length; idx++) {
+  assert(k[idx - 1] <= k[idx]);
+}
+
+var l = new Float64Array(100);
+for (var idx = 0; idx < l.length; idx++) {
+  l[idx] = (idx % 10 === 0) ? NaN : 100 - idx;
+}
+l.sort();
+for (var idx = 1; idx < 90; idx++) {
+  assert(l[idx - 1] < l[idx]);
+}
+for (var idx = 90; idx < 100; idx++) {
+  assert(isNaN(l[idx]));
+}
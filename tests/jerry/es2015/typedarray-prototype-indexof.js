@@ -102,3 +102,18 @@ var empty_typedarrays = [
 empty_typedarrays.forEach(function(e){
   assert(e.indexOf(0) === -1);
 });
+
+// Values which cannot be stored in the array are not found
+var values = new Uint8Array([0, 255, 1, 0]);
+assert(values.indexOf(256) === -1);
+assert(values.indexOf(-1) === -1);
+assert(values.indexOf(1.5) === -1);
+assert(values.indexOf(NaN) === -1);
+assert(values.indexOf(-0) === 0);
+assert(values.indexOf(0, 1) === 3);
+assert(new Uint8ClampedArray([255]).indexOf(300) === -1);
+assert(new Float32Array([0.1]).indexOf(0.1) === -1);
+
+// Positive and negative zeros are equal
+assert(new Float32Array([1, -0, 0]).indexOf(0) === 1);
+assert(new Float64Array([1, 0, -0]).indexOf(-0) === 1);
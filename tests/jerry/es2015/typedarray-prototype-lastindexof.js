@@ -100,3 +100,16 @@ var empty_typedarrays = [
 empty_typedarrays.forEach(function(e){
   assert(e.lastIndexOf(0) === -1);
 });
+
+// Values which cannot be stored in the array are not found
+var values = new Int16Array([7, 0, 7, 65543]);
+assert(values.lastIndexOf(65543) === -1);
+assert(values.lastIndexOf(7) === 3);
+assert(values.lastIndexOf(7, 2) === 2);
+assert(values.lastIndexOf(7, 100) === 3);
+assert(values.lastIndexOf(7, -Infinity) === -1);
+assert(values.lastIndexOf(0) === 1);
+
+// Positive and negative zeros are equal
+assert(new Float64Array([-0, 1]).lastIndexOf(0) === 0);
+assert(new Float32Array([0, 1]).lastIndexOf(-0, 1) === 0);
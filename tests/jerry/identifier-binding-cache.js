@@ -0,0 +1,182 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Closure variables of different environments
+function counter (start) {
+  var value = start;
+  return function () {
+    return value++;
+  };
+}
+
+var c1 = counter (0);
+var c2 = counter (10);
+for (var i = 0; i < 5; i++) {
+  assert (c1 () === i);
+  assert (c2 () === 10 + i);
+}
+
+// Bindings added by eval shadow the outer bindings
+var shadowed = "global";
+function outer () {
+  var shadowed = "outer";
+  function middle (code) {
+    function inner () {
+      return shadowed;
+    }
+
+    var results = [inner (), inner ()];
+    eval (code);
+    results.push (inner ());
+    return results;
+  }
+  return middle;
+}
+
+var middle = outer ();
+var results = middle ("");
+assert (results[0] === "outer" && results[1] === "outer" && results[2] === "outer");
+results = middle ("var shadowed = 'eval'");
+assert (results[0] === "outer" && results[1] === "outer" && results[2] === "eval");
+results = middle ("results.push (inner ()); var shadowed = 'eval'; results.push (inner ())");
+assert (results[2] === undefined && results[3] === "eval" && results[4] === "eval");
+
+// Deleted eval bindings
+function deleted () {
+  eval ("var x = 1");
+  function get () {
+    return typeof x === "undefined" ? "undefined" : x;
+  }
+  var before = get ();
+  delete x;
+  return [before, get ()];
+}
+
+var x = 5;
+results = deleted ();
+assert (results[0] === 1 && results[1] === 5);
+
+// Object environments are searched every time
+var obj = {};
+with (obj) {
+  var read = function () {
+    return x;
+  };
+}
+
+assert (read () === 5);
+obj.x = 6;
+assert (read () === 6);
+delete obj.x;
+assert (read () === 5);
+
+// Global bindings are found after the declarative environments
+function globalAccess () {
+  var local = 1;
+  return function () {
+    return local + globalValue;
+  };
+}
+
+this.globalValue = 1;
+var g = globalAccess ();
+assert (g () === 2);
+globalValue = 2;
+assert (g () === 3);
+delete this.globalValue;
+
+try {
+  g ();
+  assert (false);
+} catch (e) {
+  assert (e instanceof ReferenceError);
+}
+
+// Catch bindings
+function catchBinding (n) {
+  var e = "outer";
+  var read;
+  try {
+    throw n;
+  } catch (e) {
+    read = function () {
+      return e;
+    };
+  }
+  return [read (), e];
+}
+
+for (var i = 0; i < 3; i++) {
+  results = catchBinding (i);
+  assert (results[0] === i && results[1] === "outer");
+}
+
+// Assignments to closure variables
+function sum (array) {
+  var total = 0;
+  array.forEach (function (value) {
+    total += value;
+  });
+  return total;
+}
+
+assert (sum ([1, 2, 3, 4]) === 10);
+assert (sum ([5, 6]) === 11);
+
+// Read-only bindings
+var named = function name () {
+  "use strict";
+  return function () {
+    name = 1;
+  };
+};
+
+try {
+  named () ();
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
+
+var sloppyNamed = function name () {
+  return function () {
+    name = 1;
+    return name;
+  };
+};
+assert (typeof sloppyNamed () () === "function");
+
+// Arguments are mapped to their bindings
+function mapped (a) {
+  var read = function () {
+    return a;
+  };
+  arguments[0] = 7;
+  var first = read ();
+  a = 8;
+  return [first, read (), arguments[0]];
+}
+
+results = mapped (1);
+assert (results[0] === 7 && results[1] === 8 && results[2] === 8);
+
+// Recursive closures
+function fib (n) {
+  var self = function (k) {
+    return k < 2 ? k : self (k - 1) + self (k - 2);
+  };
+  return self (n);
+}
+
+assert (fib (15) === 610);
@@ -0,0 +1,62 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Negative integers */
+var a = 5;
+var b = -6;
+assert (~a === b);
+assert (~a == -6);
+assert (-a - 1 === b);
+assert ([1].indexOf (5) === -1);
+
+var c = -1;
+c--;
+assert (c === -2);
+c++;
+c++;
+assert (c === 0);
+
+/* NaN is never equal to itself */
+var nan = NaN;
+assert (nan !== nan);
+assert (!(nan == nan));
+assert (nan != nan);
+assert ([nan].indexOf (nan) === -1);
+assert (isNaN (0 / 0) && isNaN (nan * 2));
+
+/* Floating point numbers */
+var sum = 0;
+for (var i = 0; i < 1000; i++) {
+  sum += 0.5;
+}
+assert (sum === 500);
+
+var x = 0.1 + 0.2;
+assert (x !== 0.3 && Math.abs (x - 0.3) < 1e-15);
+assert (1 / -0 === -Infinity);
+assert (-0 === 0);
+assert (Infinity - Infinity !== Infinity - Infinity);
+assert (1e308 * 10 === Infinity);
+assert (5e-324 > 0 && 5e-324 / 2 === 0);
+
+/* Numbers stored in objects and arrays */
+var values = [1.5, -2.25, 1e100, -0, NaN, 2147483648, -1073741825];
+var o = { values: values };
+assert (o.values[0] + o.values[1] === -0.75);
+assert (o.values[2] === 1e100);
+assert (1 / o.values[3] === -Infinity);
+assert (isNaN (o.values[4]));
+assert (o.values[5] === 2147483648 && (o.values[5] | 0) === -2147483648);
+assert (o.values[6] === -1073741825);
@@ -0,0 +1,139 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function check_keys (o, expected) {
+  var keys = Object.keys (o);
+  assert (keys.length === expected.length);
+  for (var i = 0; i < keys.length; i++) {
+    assert (keys[i] === expected[i]);
+  }
+}
+
+/* Objects sharing the same layout */
+var a = { x: 1, y: 2 };
+var b = { x: 3, y: 4 };
+b.z = 5;
+assert (a.x === 1 && a.y === 2 && a.z === undefined);
+assert (b.x === 3 && b.y === 4 && b.z === 5);
+check_keys (a, ["x", "y"]);
+check_keys (b, ["x", "y", "z"]);
+
+/* Same names in a different order */
+var c = {};
+c.y = 6;
+c.x = 7;
+check_keys (c, ["y", "x"]);
+assert (c.x === 7 && c.y === 6);
+
+/* Deleting a property */
+var d = { p: 1, q: 2, r: 3 };
+assert (delete d.q);
+check_keys (d, ["p", "r"]);
+assert (d.q === undefined && d.p === 1 && d.r === 3);
+d.q = 4;
+check_keys (d, ["p", "r", "q"]);
+assert (JSON.stringify (d) === '{"p":1,"r":3,"q":4}');
+
+/* The layout of the other objects is not affected by the delete */
+var e = { p: 5, q: 6, r: 7 };
+check_keys (e, ["p", "q", "r"]);
+assert (e.q === 6);
+
+/* Many properties */
+var big = {};
+for (var i = 0; i < 100; i++) {
+  big["prop" + i] = i;
+}
+
+var big_keys = Object.keys (big);
+assert (big_keys.length === 100);
+for (i = 0; i < 100; i++) {
+  assert (big_keys[i] === "prop" + i);
+  assert (big["prop" + i] === i);
+}
+
+/* Numeric, string and symbol-like names */
+var mixed = {};
+mixed[5] = "five";
+mixed.name = "name";
+mixed["a long property name which is not a direct string"] = "long";
+mixed[1e10] = "number";
+assert (mixed[5] === "five");
+assert (mixed.name === "name");
+assert (mixed["a long property name which is not a direct string"] === "long");
+assert (mixed["10000000000"] === "number");
+
+/* Accessors and attributes */
+var acc = { v: 1 };
+Object.defineProperty (acc, "w", {
+  get: function () { return this.v * 2; },
+  set: function (value) { this.v = value; },
+  enumerable: true,
+  configurable: true
+});
+assert (acc.w === 2);
+acc.w = 5;
+assert (acc.v === 5 && acc.w === 10);
+check_keys (acc, ["v", "w"]);
+
+Object.defineProperty (acc, "hidden", { value: 3, enumerable: false });
+check_keys (acc, ["v", "w"]);
+assert (Object.getOwnPropertyNames (acc).length === 3);
+assert (acc.hidden === 3);
+
+var frozen = { f: 1, g: 2 };
+Object.freeze (frozen);
+frozen.f = 10;
+frozen.h = 3;
+assert (frozen.f === 1 && frozen.h === undefined);
+assert (Object.isFrozen (frozen));
+
+/* Objects used as dictionaries */
+for (i = 0; i < 50; i++) {
+  var dict = {};
+  dict["key" + i] = i;
+  dict.common = i;
+  assert (dict["key" + i] === i && dict.common === i);
+}
+
+/* Enumeration */
+var enumerated = [];
+var en = { one: 1, two: 2, three: 3 };
+for (var k in en) {
+  enumerated.push (k);
+}
+assert (enumerated.join () === "one,two,three");
+
+/* Objects with a prototype chain */
+var proto = { inherited: 1 };
+var child = Object.create (proto);
+child.own = 2;
+assert (child.inherited === 1 && child.own === 2);
+check_keys (child, ["own"]);
+
+/* Garbage collector */
+var kept = [];
+for (i = 0; i < 2000; i++) {
+  var o = { x: i, y: { nested: i } };
+  if (i % 100 === 0) {
+    o.extra = "value" + i;
+    kept.push (o);
+  }
+}
+
+for (i = 0; i < kept.length; i++) {
+  assert (kept[i].x === i * 100);
+  assert (kept[i].y.nested === i * 100);
+  assert (kept[i].extra === "value" + i * 100);
+}
@@ -0,0 +1,113 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function get_x (o) {
+  return o.x;
+}
+
+function set_x (o, v) {
+  o.x = v;
+}
+
+/* Deleted and re-added properties */
+var o = { x: 1, y: 2 };
+for (var i = 0; i < 3; i++) {
+  assert (get_x (o) === 1);
+}
+
+delete o.x;
+assert (get_x (o) === undefined);
+o.z = 3;
+assert (get_x (o) === undefined);
+o.x = 4;
+assert (get_x (o) === 4);
+assert (o.z === 3);
+
+/* Property turned into an accessor */
+o = { x: 1 };
+set_x (o, 2);
+set_x (o, 3);
+assert (get_x (o) === 3);
+
+Object.defineProperty (o, "x", { get: function () { return 10; }, set: function (v) { this.y = v; } });
+assert (get_x (o) === 10);
+set_x (o, 5);
+assert (o.y === 5);
+assert (get_x (o) === 10);
+
+/* Read-only properties */
+o = { x: 1 };
+set_x (o, 2);
+set_x (o, 3);
+Object.freeze (o);
+set_x (o, 4);
+assert (get_x (o) === 3);
+
+o = { x: 1 };
+set_x (o, 2);
+Object.defineProperty (o, "x", { writable: false });
+set_x (o, 6);
+assert (get_x (o) === 2);
+
+/* Several objects at the same site */
+var objects = [];
+for (i = 0; i < 8; i++) {
+  objects.push ({ x: i });
+}
+
+for (var round = 0; round < 3; round++) {
+  for (i = 0; i < objects.length; i++) {
+    assert (get_x (objects[i]) === i + round);
+    set_x (objects[i], i + round + 1);
+  }
+}
+
+/* Objects freed by the garbage collector */
+for (i = 0; i < 1000; i++) {
+  o = { x: i };
+  assert (get_x (o) === i);
+  set_x (o, i + 1);
+  assert (get_x (o) === i + 1);
+}
+
+/* Inherited and shadowing properties */
+var proto = { x: "proto" };
+o = Object.create (proto);
+assert (get_x (o) === "proto");
+assert (get_x (proto) === "proto");
+set_x (o, "own");
+assert (get_x (o) === "own");
+assert (get_x (proto) === "proto");
+delete o.x;
+assert (get_x (o) === "proto");
+
+/* Mapped arguments */
+function args (a) {
+  arguments[0] = 2;
+  arguments[0] = 3;
+  return a;
+}
+
+assert (args (1) === 3);
+assert (args (1) === 3);
+
+/* Computed property names */
+o = { a: 1, b: 2 };
+var names = ["a", "b", "a", "b"];
+var sum = 0;
+for (i = 0; i < names.length; i++) {
+  sum += o[names[i]];
+  o[names[i]] = 10;
+}
+assert (sum === 1 + 2 + 10 + 10);
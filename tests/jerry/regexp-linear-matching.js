@@ -0,0 +1,93 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function check (regexp, input, expected, index) {
+  var match = regexp.exec (input);
+
+  if (expected === null) {
+    assert (match === null);
+    return;
+  }
+
+  assert (match.length === expected.length);
+
+  for (var i = 0; i < expected.length; i++) {
+    assert (match[i] === expected[i]);
+  }
+
+  assert (match.index === index);
+}
+
+/* Patterns which take exponential time with a backtracking matcher */
+var long_input = "";
+for (var i = 0; i < 64; i++) {
+  long_input += "a";
+}
+
+check (/(a|aa)*b/, long_input, null);
+check (/(a|aa)*$/, long_input, [long_input, "a"], 0);
+check (/(?:a+)+b/, long_input, null);
+check (/(x+x+)+y/, long_input.replace (/a/g, "x"), null);
+check (/^(\w+\s?)*$/, long_input + "!", null);
+check (/(a|a)*c/, long_input + "c", [long_input + "c", "a"], 0);
+
+/* Priorities of alternatives and quantifiers */
+check (/a|ab/, "abc", ["a"], 0);
+check (/ab|a/, "abc", ["ab"], 0);
+check (/(a+)(a*)/, "aaa", ["aaa", "aaa", ""], 0);
+check (/(a+?)(a*)/, "aaa", ["aaa", "a", "aa"], 0);
+check (/(a*?)b/, "xaab", ["aab", "aa"], 1);
+check (/(a{1,2})(a{1,2}?)/, "aaaa", ["aaa", "aa", "a"], 0);
+check (/(?:(a)|b)+/, "ab", ["ab", "a"], 0);
+check (/(?:(a)|(b))+/, "ab", ["ab", "a", "b"], 0);
+check (/(a)??b/, "ab", ["ab", "a"], 0);
+check (/(a)?b/, "b", ["b", undefined], 0);
+check (/x(a|b|c){2}y/, "xbcy", ["xbcy", "c"], 0);
+
+/* Assertions */
+check (/^b/m, "a\nb", ["b"], 2);
+check (/a$/m, "a\nb", ["a"], 0);
+check (/a$/, "a\nb", null);
+check (/\bfoo\b/, "afoo foo", ["foo"], 5);
+check (/\Boo/, "foo", ["oo"], 1);
+
+/* Case insensitive matching and character classes */
+check (/[a-c]+X/i, "ddAbCx", ["AbCx"], 2);
+check (/[^a-c]+/, "abcdefa", ["def"], 3);
+check (/.+/, "ab\ncd", ["ab"], 0);
+check (/\d+\s\w+/, "no 12 ab", ["12 ab"], 3);
+
+/* Non-ASCII input */
+check (/é+b/, "aééb", ["ééb"], 1);
+check (/[Ā-Ȁ]c/i, "éāC", ["āC"], 1);
+
+/* Global matching continues from lastIndex */
+var r = /a(b|c)/g;
+check (r, "xabac", ["ab", "b"], 1);
+assert (r.lastIndex === 3);
+check (r, "xabac", ["ac", "c"], 3);
+assert (r.lastIndex === 5);
+check (r, "xabac", null);
+assert (r.lastIndex === 0);
+
+r = /é/g;
+check (r, "éaé", ["é"], 0);
+check (r, "éaé", ["é"], 2);
+assert (r.lastIndex === 3);
+
+/* Patterns matched by the backtracking matcher */
+check (/(a)\1/, "xaa", ["aa", "a"], 1);
+check (/a(?=b)/, "acab", ["a"], 2);
+check (/(a*)*b/, "aab", ["aab", "aa"], 0);
+check (/(a|)+b/, "aab", ["aab", "a"], 0);
@@ -0,0 +1,85 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function check (regexp, input, expected, index) {
+  var match = regexp.exec (input);
+
+  if (expected === null) {
+    assert (match === null);
+    return;
+  }
+
+  assert (match.length === expected.length);
+
+  for (var i = 0; i < expected.length; i++) {
+    assert (match[i] === expected[i]);
+  }
+
+  assert (match.index === index);
+}
+
+var text = "";
+for (var i = 0; i < 100; i++) {
+  text += "lorem ipsum dolor sit amet ";
+}
+
+/* Literal prefixes */
+check (/amet/, text, ["amet"], 22);
+check (/ametx/, text, null);
+check (/(am)(et) l/, text, ["amet l", "am", "et"], 22);
+check (/\bsit\b/, text, ["sit"], 18);
+check (/^lorem/m, "x\nlorem", ["lorem"], 2);
+check (/sit$/, text + "sit", ["sit"], text.length);
+check (/ab{2}c/, "abc abbc", ["abbc"], 4);
+check (/éa/, "aéaéa", ["éa"], 1);
+check (/あb/, "ぁbあb", ["あb"], 2);
+
+/* First character sets */
+check (/(?:dolor|ipsum) (\w+)/, text, ["ipsum dolor", "dolor"], 6);
+check (/[xyz]+/, text + "yx", ["yx"], text.length);
+check (/[^a-z ]/, text + "!", ["!"], text.length);
+check (/[à-ÿ]+/, "abcàé", ["àé"], 3);
+check (/a?m/, "xxmam", ["m"], 2);
+check (/(a|b)*c/, "xxabc", ["abc", "b"], 2);
+check (/\d+\.\d+/, "v 1.25", ["1.25"], 2);
+check (/.b/, "\nab", ["ab"], 1);
+
+/* Case insensitive matching */
+check (/AMET/i, text, ["amet"], 22);
+check (/[Q-S]IT/i, text, ["sit"], 18);
+check (/É/i, "aé", ["é"], 1);
+
+/* Patterns which can match an empty string */
+check (/x*/, "abc", [""], 0);
+check (/(?:ab|)c/, "xc", ["c"], 1);
+check (/\b/, "  a", [""], 2);
+
+/* Lookaheads and backreferences */
+check (/(?=s)\w+/, text, ["sum"], 8);
+check (/(o)\1/, "xoo", ["oo", "o"], 1);
+
+/* Global matching continues from lastIndex */
+var r = /m(e|o)/g;
+check (r, "lorem memo", ["me", "e"], 6);
+assert (r.lastIndex === 8);
+check (r, "lorem memo", ["mo", "o"], 8);
+assert (r.lastIndex === 10);
+check (r, "lorem memo", null);
+assert (r.lastIndex === 0);
+
+r = /é(\d)/g;
+check (r, "ééé1 é2", ["é1", "1"], 2);
+assert (r.lastIndex === 4);
+check (r, "ééé1 é2", ["é2", "2"], 5);
+assert (r.lastIndex === 7);
@@ -0,0 +1,76 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Long strings built by repeated concatenation
+var str = "";
+for (var i = 0; i < 2000; i++) {
+  str += "ab" + (i % 10);
+}
+
+assert(str.length === 6000);
+assert(str.charAt(5999) === "9");
+assert(str.substring(0, 6) === "ab0ab1");
+assert(str.indexOf("ab9ab0") === 27);
+
+var str1 = "";
+var str2 = "";
+for (var i = 0; i < 300; i++) {
+  str1 += "x";
+  str2 = str2 + "x";
+}
+assert(str1 === str2);
+assert(str1.length === 300);
+
+var obj = {};
+obj[str1] = 5;
+assert(obj[str2] === 5);
+
+var digits = "";
+for (var i = 0; i < 100; i++) {
+  digits += "0123456789";
+}
+assert(digits + digits === digits.concat(digits));
+assert((digits + "x") < (digits + "y"));
+assert(Number(digits + "5") > 0);
+
+// Intermediate values must not change when the string is extended
+var prefixes = [];
+var acc = "";
+for (var i = 0; i < 1000; i++) {
+  acc += "k" + i;
+  if (i % 100 === 0) {
+    prefixes.push(acc);
+  }
+}
+assert(prefixes[3].length < prefixes[4].length);
+assert(prefixes[4].substring(0, prefixes[3].length) === prefixes[3]);
+assert(prefixes[9].substring(0, 4) === "k0k1");
+
+// Non-ASCII characters
+var utf8 = "";
+for (var i = 0; i < 200; i++) {
+  utf8 += "éa";
+}
+assert(utf8.length === 400);
+assert(utf8.charCodeAt(398) === 0xe9);
+assert(JSON.stringify(utf8).length === 402);
+
+// Prepending
+var str3 = "tail";
+for (var i = 0; i < 100; i++) {
+  str3 = "ab" + str3;
+}
+assert(str3.length === 204);
+assert(str3.substring(198) === "abtail");
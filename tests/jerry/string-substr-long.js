@@ -0,0 +1,90 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var digits = "0123456789";
+var str = "";
+for (var i = 0; i < 100; i++) {
+  str += digits;
+}
+
+// Consuming a long string from its start
+var rest = str;
+var count = 0;
+while (rest.length > 0) {
+  assert (rest.charAt (0) === "0");
+  assert (rest.substring (0, 10) === digits);
+  rest = rest.substring (10);
+  count++;
+}
+assert (count === 100);
+
+// Substrings are equal to copied strings with the same characters
+var tail = str.slice (500);
+assert (tail.length === 500);
+assert (tail === str.substr (500));
+assert (tail === str.substring (200).substring (300));
+assert (tail === str.substring (500).slice (0, 300) + str.substring (800));
+assert (tail !== str.substring (501));
+assert (tail < str.substring (501));
+assert (tail.indexOf ("90") === 9);
+assert (tail.lastIndexOf ("0123") === 490);
+
+var copy = "";
+for (var i = 0; i < 50; i++) {
+  copy += digits;
+}
+assert (tail === copy);
+
+// Substrings as property names
+var obj = {};
+obj[copy] = 5;
+assert (obj[tail] === 5);
+assert (obj[str.slice (-500)] === 5);
+obj[str.substr (250, 500)] = 6;
+assert (obj[str.slice (250, 750)] === 6);
+
+// Nested substrings
+var nested = str;
+for (var i = 0; i < 10; i++) {
+  nested = nested.slice (5, -5);
+}
+assert (nested.length === 900);
+assert (nested === str.substring (50, 950));
+assert (Number (nested.substring (0, 4)) === 123);
+
+// Short substrings of long strings
+assert (str.substring (995) === "56789");
+assert (str.substring (10, 12) === "01");
+assert (str.substring (123, 126) === "345");
+
+// Splitting a long string
+var parts = (str + "|" + str).split ("|");
+assert (parts.length === 2);
+assert (parts[0] === str);
+assert (parts[1] === str);
+assert (parts[0].length === 1000);
+
+// Strings with multi byte characters
+var utf8 = "";
+for (var i = 0; i < 100; i++) {
+  utf8 += "árvíztűrő";
+}
+var utf8_tail = utf8.substring (450);
+assert (utf8_tail.length === 450);
+assert (utf8_tail.charAt (0) === "á");
+assert (utf8_tail.charCodeAt (3) === 0xed);
+assert (utf8_tail === utf8.slice (-450));
+assert (utf8_tail === utf8.substring (100).substring (350));
+assert (utf8_tail.substring (1, 9) === "rvíztűrő");
+assert (utf8_tail.toUpperCase ().substring (0, 9) === "ÁRVÍZTŰRŐ");
@@ -294,6 +294,21 @@ main (void)
 
   jerry_release_value (args[0]);
 
+  /* Long strings built by repeated concatenation */
+  const jerry_char_t concat_src[] = "var s = ''; for (var i = 0; i < 500; i++) { s += 'ab' + (i % 10) } s";
+  args[0] = jerry_eval (concat_src, sizeof (concat_src) - 1, JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_string (args[0]));
+  TEST_ASSERT (jerry_get_string_size (args[0]) == 1500);
+  TEST_ASSERT (jerry_get_string_length (args[0]) == 1500);
+
+  char concat_buffer[1500];
+  sz = jerry_string_to_char_buffer (args[0], (jerry_char_t *) concat_buffer, sizeof (concat_buffer));
+  TEST_ASSERT (sz == 1500);
+  TEST_ASSERT (!strncmp (concat_buffer, "ab0ab1ab2", 9));
+  TEST_ASSERT (!strncmp (concat_buffer + 1491, "ab7ab8ab9", 9));
+
+  jerry_release_value (args[0]);
+
   jerry_cleanup ();
 
   return 0;
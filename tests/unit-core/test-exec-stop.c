@@ -93,6 +93,28 @@ main (void)
   jerry_release_value (res);
   jerry_release_value (parsed_code_val);
 
+  /* Loops whose condition is a compare and branch instruction. */
+  countdown = 6;
+
+  const jerry_char_t inf_loop_code_src3[] = TEST_STRING_LITERAL (
+    "var o = { n: 0 };\n"
+    "for (var i = 0; i > -1; i++) { o.n++; }"
+  );
+
+  parsed_code_val = jerry_parse (NULL,
+                                 0,
+                                 inf_loop_code_src3,
+                                 sizeof (inf_loop_code_src3) - 1,
+                                 JERRY_PARSE_NO_OPTS);
+
+  TEST_ASSERT (!jerry_value_is_error (parsed_code_val));
+  res = jerry_run (parsed_code_val);
+  TEST_ASSERT (countdown == 0);
+  TEST_ASSERT (jerry_value_is_error (res));
+
+  jerry_release_value (res);
+  jerry_release_value (parsed_code_val);
+
   jerry_cleanup ();
   return 0;
 } /* main */
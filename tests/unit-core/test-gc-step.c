@@ -0,0 +1,100 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static const jerry_char_t setup_source[] = TEST_STRING_LITERAL (
+  "var holders = [];\n"
+  "for (var i = 0; i < 256; i++) {\n"
+  "  holders.push ({ child: { id: i } });\n"
+  "}\n"
+  "function shuffle (step) {\n"
+  "  var length = holders.length;\n"
+  "  for (var i = 0; i < length; i++) {\n"
+  "    var from = holders[(i + step) % length];\n"
+  "    var to = holders[i];\n"
+  "    var child = to.child;\n"
+  "    to.child = from.child;\n"
+  "    from.child = child;\n"
+  "    from.garbage = [{}, {}];\n"
+  "  }\n"
+  "}\n"
+  "function check () {\n"
+  "  var sum = 0;\n"
+  "  for (var i = 0; i < holders.length; i++) {\n"
+  "    sum += holders[i].child.id;\n"
+  "  }\n"
+  "  return sum === 256 * 255 / 2;\n"
+  "}\n"
+);
+
+static void
+run_source (const char *source_p) /**< source code */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  jerry_release_value (result);
+} /* run_source */
+
+static bool
+check_holders (void)
+{
+  const char *check_source_p = "check ()";
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) check_source_p,
+                                     strlen (check_source_p),
+                                     JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_boolean (result));
+
+  bool is_valid = jerry_get_boolean_value (result);
+  jerry_release_value (result);
+  return is_valid;
+} /* check_holders */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t result = jerry_eval (setup_source, sizeof (setup_source) - 1, JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  jerry_release_value (result);
+
+  /* Move the objects between their holders while the collector is running, so
+   * references are stored into objects which have already been marked. */
+  for (int i = 0; i < 256; i++)
+  {
+    jerry_gc_step (16);
+    run_source ((i & 0x1) ? "shuffle (7)" : "shuffle (101)");
+    TEST_ASSERT (check_holders ());
+  }
+
+  /* Running small steps must finish the cycle. */
+  int steps = 0;
+
+  while (jerry_gc_step (1))
+  {
+    steps++;
+    TEST_ASSERT (steps < 1000000);
+  }
+
+  TEST_ASSERT (check_holders ());
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -20,6 +20,42 @@
 
 #define BASIC_SIZE (64)
 
+#define STRESS_BLOCK_COUNT (1024)
+
+static uint8_t *stress_blocks_p[STRESS_BLOCK_COUNT];
+
+static size_t
+get_stress_block_size (uint32_t index, /**< index of the block */
+                       uint32_t step) /**< size step */
+{
+  return ((index * step) % 12 + 1) * JMEM_ALIGNMENT;
+} /* get_stress_block_size */
+
+static void
+fill_stress_block (uint32_t index, /**< index of the block */
+                   size_t size) /**< size of the block */
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    stress_blocks_p[index][i] = (uint8_t) (index + i);
+  }
+} /* fill_stress_block */
+
+static bool
+check_stress_block (uint32_t index, /**< index of the block */
+                    size_t size) /**< size of the block */
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    if (stress_blocks_p[index][i] != (uint8_t) (index + i))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* check_stress_block */
+
 int
 main (void)
 {
@@ -61,6 +97,9 @@ main (void)
 
     jmem_heap_free_block (block3_p, BASIC_SIZE);
 
+    /* Small regions are merged with their neighbours when the free bins are collected. */
+    jmem_heap_collect_bins ();
+
     /* [block1 64] [free 128] [block2 128] [block4 128] [...] */
 
     /* Realloc by extending front */
@@ -103,6 +142,74 @@ main (void)
     jmem_heap_free_block (block4_p, BASIC_SIZE * 2);
   }
 
+  {
+    /* Fragment the heap with blocks of various sizes. */
+    for (uint32_t i = 0; i < STRESS_BLOCK_COUNT; i++)
+    {
+      size_t size = get_stress_block_size (i, 7);
+      stress_blocks_p[i] = (uint8_t *) jmem_heap_alloc_block (size);
+      fill_stress_block (i, size);
+    }
+
+    for (uint32_t i = 1; i < STRESS_BLOCK_COUNT; i += 2)
+    {
+      jmem_heap_free_block (stress_blocks_p[i], get_stress_block_size (i, 7));
+    }
+
+    /* Fill the holes with blocks of different sizes. */
+    for (uint32_t i = 1; i < STRESS_BLOCK_COUNT; i += 2)
+    {
+      size_t size = get_stress_block_size (i, 5);
+      stress_blocks_p[i] = (uint8_t *) jmem_heap_alloc_block (size);
+      fill_stress_block (i, size);
+    }
+
+    for (uint32_t i = 0; i < STRESS_BLOCK_COUNT; i++)
+    {
+      TEST_ASSERT (check_stress_block (i, get_stress_block_size (i, (i & 0x1) ? 5 : 7)));
+    }
+
+    for (uint32_t i = 0; i < STRESS_BLOCK_COUNT; i++)
+    {
+      jmem_heap_free_block (stress_blocks_p[i], get_stress_block_size (i, (i & 0x1) ? 5 : 7));
+    }
+  }
+
+  {
+    /* Fill the whole heap with small blocks, which are chained together. */
+    const size_t block_size = 2 * JMEM_ALIGNMENT;
+    void **last_block_p = NULL;
+    size_t total_size = 0;
+
+    while (true)
+    {
+      void **block_p = (void **) jmem_heap_alloc_block_null_on_error (block_size);
+
+      if (block_p == NULL)
+      {
+        break;
+      }
+
+      *block_p = last_block_p;
+      last_block_p = block_p;
+      total_size += block_size;
+    }
+
+    TEST_ASSERT (total_size > 0);
+
+    while (last_block_p != NULL)
+    {
+      void **prev_block_p = (void **) *last_block_p;
+      jmem_heap_free_block (last_block_p, block_size);
+      last_block_p = prev_block_p;
+    }
+
+    /* The freed blocks must be merged into a large region. */
+    uint8_t *large_block_p = (uint8_t *) jmem_heap_alloc_block_null_on_error (total_size / 2);
+    TEST_ASSERT (large_block_p != NULL);
+    jmem_heap_free_block (large_block_p, total_size / 2);
+  }
+
   ecma_finalize ();
   jmem_finalize ();
 
@@ -0,0 +1,104 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static jerry_regexp_cache_stats_t
+get_stats (void)
+{
+  jerry_regexp_cache_stats_t stats;
+  TEST_ASSERT (jerry_get_regexp_cache_stats (&stats));
+  TEST_ASSERT (stats.used_entries <= stats.size);
+  return stats;
+} /* get_stats */
+
+static void
+create_regexp (const char *pattern_p, /**< pattern */
+               uint16_t flags) /**< flags */
+{
+  jerry_value_t regexp = jerry_create_regexp ((const jerry_char_t *) pattern_p, flags);
+  TEST_ASSERT (jerry_value_is_object (regexp));
+  jerry_release_value (regexp);
+} /* create_regexp */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_REGEXP))
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "RegExp support is disabled!\n");
+    return 0;
+  }
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  TEST_ASSERT (!jerry_get_regexp_cache_stats (NULL));
+
+  jerry_regexp_cache_stats_t start_stats = get_stats ();
+  TEST_ASSERT (start_stats.size > 0);
+
+  /* The same pattern and flags are compiled only once. The first RegExp is kept
+   * alive, so the garbage collector cannot remove its byte code from the cache. */
+  jerry_value_t regexp = jerry_create_regexp ((const jerry_char_t *) "a+b", 0);
+  TEST_ASSERT (jerry_value_is_object (regexp));
+  create_regexp ("a+b", 0);
+  create_regexp ("a+b", 0);
+
+  jerry_regexp_cache_stats_t stats = get_stats ();
+  TEST_ASSERT (stats.misses == start_stats.misses + 1);
+  TEST_ASSERT (stats.hits == start_stats.hits + 2);
+
+  /* Different flags need a different byte code. */
+  create_regexp ("a+b", JERRY_REGEXP_FLAG_IGNORE_CASE);
+
+  stats = get_stats ();
+  TEST_ASSERT (stats.misses == start_stats.misses + 2);
+  TEST_ASSERT (stats.hits == start_stats.hits + 2);
+
+  /* A recently used pattern is not evicted by a single insertion into its cache set. */
+  if (start_stats.size >= 2)
+  {
+    char pattern[32];
+
+    for (uint32_t i = 0; i < start_stats.size * 4; i++)
+    {
+      snprintf (pattern, sizeof (pattern), "x%uy", (unsigned int) i);
+
+      jerry_regexp_cache_stats_t prev_stats = get_stats ();
+
+      create_regexp ("a+b", 0);
+      create_regexp (pattern, JERRY_REGEXP_FLAG_GLOBAL);
+
+      stats = get_stats ();
+      TEST_ASSERT (stats.misses == prev_stats.misses + 1);
+      TEST_ASSERT (stats.hits == prev_stats.hits + 1);
+    }
+  }
+
+  jerry_release_value (regexp);
+
+  /* Byte codes which are only referenced by the cache are freed by the garbage collector. */
+  jerry_gc (JERRY_GC_PRESSURE_HIGH);
+
+  stats = get_stats ();
+  TEST_ASSERT (stats.used_entries <= start_stats.used_entries);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -220,24 +220,26 @@ main (void)
     size_t snapshot_size = (size_t) jerry_get_number_value (generate_result);
     jerry_release_value (generate_result);
 
+#if !ENABLED (JERRY_VALUE_NAN_BOXING)
     /* Check the snapshot data. Unused bytes should be filled with zeroes */
     const uint8_t expected_data[] =
     {
-      0x4A, 0x52, 0x52, 0x59, 0x18, 0x00, 0x00, 0x00,
+      0x4A, 0x52, 0x52, 0x59, 0x1A, 0x00, 0x00, 0x00,
       0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
       0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
       0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
       0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-      0x28, 0x00, 0xB8, 0x46, 0x00, 0x00, 0x00, 0x00,
+      0x40, 0x00, 0xCA, 0x58, 0x00, 0x00, 0x00, 0x00,
       0x03, 0x00, 0x01, 0x00, 0x21, 0x00, 0x00, 0x00,
       0x00, 0x00, 0x01, 0x01, 0x07, 0x00, 0x00, 0x00,
-      0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
       0x14, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
       0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x6E,
       0x61, 0x70, 0x73, 0x68, 0x6F, 0x74
     };
     TEST_ASSERT (sizeof (expected_data) == snapshot_size);
     TEST_ASSERT (0 == memcmp (expected_data, snapshot_buffer, sizeof (expected_data)));
+#endif /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
 
     jerry_cleanup ();
 
@@ -397,7 +399,11 @@ main (void)
 
     size_t snapshot_size = (size_t) jerry_get_number_value (generate_result);
     jerry_release_value (generate_result);
+#if ENABLED (JERRY_VALUE_NAN_BOXING)
+    TEST_ASSERT (snapshot_size == 152);
+#else /* !ENABLED (JERRY_VALUE_NAN_BOXING) */
     TEST_ASSERT (snapshot_size == 120);
+#endif /* ENABLED (JERRY_VALUE_NAN_BOXING) */
 
     const size_t lit_c_buf_sz = jerry_get_literals_from_snapshot (literal_snapshot_buffer,
                                                                   snapshot_size,
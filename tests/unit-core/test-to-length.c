@@ -39,7 +39,7 @@ main (void)
 
   ecma_value_t int_num = ecma_make_int32_value (123);
 
-  uint32_t result = ecma_op_to_length (int_num, &num);
+  ecma_value_t result = ecma_op_to_length (int_num, &num);
 
   ecma_free_value (int_num);
 
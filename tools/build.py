@@ -124,6 +124,8 @@ def get_arguments():
                          help='enable logging (%(choices)s)')
     coregrp.add_argument('--mem-heap', metavar='SIZE', type=int,
                          help='size of memory heap (in kilobytes)')
+    coregrp.add_argument('--gc-incremental', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable incremental garbage collection (%(choices)s)')
     coregrp.add_argument('--gc-limit', metavar='SIZE', type=int,
                          help='memory usage limit to trigger garbage collection (in bytes)')
     coregrp.add_argument('--stack-limit', metavar='SIZE', type=int,
@@ -134,6 +136,8 @@ def get_arguments():
                          help=devhelp('enable mem-stress test (%(choices)s)'))
     coregrp.add_argument('--profile', metavar='FILE',
                          help='specify profile file')
+    coregrp.add_argument('--regexp-cache-size', metavar='SIZE', type=int,
+                         help='number of cached regexp byte codes (power of two)')
     coregrp.add_argument('--regexp-strict-mode', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable regexp strict mode (%(choices)s)'))
     coregrp.add_argument('--show-opcodes', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -148,8 +152,12 @@ def get_arguments():
                          help='enable system allocator (%(choices)s)')
     coregrp.add_argument('--valgrind', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable Valgrind support (%(choices)s)'))
+    coregrp.add_argument('--value-nan-boxing', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable NaN-boxed 64 bit values (%(choices)s)')
     coregrp.add_argument('--vm-exec-stop', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable VM execution stopping (%(choices)s)')
+    coregrp.add_argument('--vm-threaded-dispatch', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable threaded opcode dispatch in the VM (%(choices)s)')
 
     maingrp = parser.add_argument_group('jerry-main options')
     maingrp.add_argument('--link-map', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -201,11 +209,13 @@ def generate_build_options(arguments):
     build_options_append('JERRY_LINE_INFO', arguments.line_info)
     build_options_append('JERRY_LOGGING', arguments.logging)
     build_options_append('JERRY_GLOBAL_HEAP_SIZE', arguments.mem_heap)
+    build_options_append('JERRY_GC_INCREMENTAL', arguments.gc_incremental)
     build_options_append('JERRY_GC_LIMIT', arguments.gc_limit)
     build_options_append('JERRY_STACK_LIMIT', arguments.stack_limit)
     build_options_append('JERRY_MEM_STATS', arguments.mem_stats)
     build_options_append('JERRY_MEM_GC_BEFORE_EACH_ALLOC', arguments.mem_stress_test)
     build_options_append('JERRY_PROFILE', arguments.profile)
+    build_options_append('JERRY_REGEXP_CACHE_SIZE', arguments.regexp_cache_size)
     build_options_append('JERRY_REGEXP_STRICT_MODE', arguments.regexp_strict_mode)
     build_options_append('JERRY_PARSER_DUMP_BYTE_CODE', arguments.show_opcodes)
     build_options_append('JERRY_REGEXP_DUMP_BYTE_CODE', arguments.show_regexp_opcodes)
@@ -213,7 +223,9 @@ def generate_build_options(arguments):
     build_options_append('JERRY_SNAPSHOT_SAVE', arguments.snapshot_save)
     build_options_append('JERRY_SYSTEM_ALLOCATOR', arguments.system_allocator)
     build_options_append('JERRY_VALGRIND', arguments.valgrind)
+    build_options_append('JERRY_VALUE_NAN_BOXING', arguments.value_nan_boxing)
     build_options_append('JERRY_VM_EXEC_STOP', arguments.vm_exec_stop)
+    build_options_append('JERRY_VM_THREADED_DISPATCH', arguments.vm_threaded_dispatch)
 
     # jerry-main options
     build_options_append('ENABLE_LINK_MAP', arguments.link_map)
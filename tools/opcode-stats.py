@@ -0,0 +1,189 @@
+#!/usr/bin/env python
+
+# Copyright JS Foundation and other contributors, http://js.foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from __future__ import print_function
+
+import argparse
+import collections
+import os
+import re
+import subprocess
+import sys
+
+INSTRUCTION_RE = re.compile(r'^\s+\d+ : (CBC_\w+)')
+BYTE_CODE_SIZE_RE = re.compile(r'^Byte code size: (\d+) bytes')
+FINAL_DUMP_MARK = 'Final byte code dump:'
+
+
+def get_arguments():
+    """ Parse input arguments. """
+    desc = ('Count the byte code instructions generated for a set of JavaScript files. '
+            'The engines must be built with --jerry-cmdline=on and --show-opcodes=on.')
+    parser = argparse.ArgumentParser(description=desc)
+    parser.add_argument('engine', metavar='ENGINE',
+                        help='path to the jerry binary')
+    parser.add_argument('paths', metavar='PATH', nargs='+',
+                        help='JavaScript file or directory (searched recursively)')
+    parser.add_argument('--base', metavar='ENGINE',
+                        help='path to a base jerry binary, prints the difference of the two engines')
+    parser.add_argument('--top', metavar='N', type=int, default=20,
+                        help='number of opcodes and opcode pairs listed (default: %(default)d)')
+    parser.add_argument('--pairs', action='store_true',
+                        help='list the most frequent adjacent opcode pairs')
+
+    return parser.parse_args()
+
+
+class OpcodeStats(object):
+    """ Opcode statistics of an engine. """
+    def __init__(self):
+        self.files = 0
+        self.failed = 0
+        self.instructions = 0
+        self.byte_code_size = 0
+        self.opcodes = collections.Counter()
+        self.pairs = collections.Counter()
+
+    def add_dump(self, output):
+        """ Process the --show-opcodes output of a file. """
+        in_final_dump = False
+        previous = None
+
+        for line in output.splitlines():
+            if line.startswith(FINAL_DUMP_MARK):
+                in_final_dump = True
+                previous = None
+                continue
+
+            if not in_final_dump:
+                continue
+
+            match = INSTRUCTION_RE.match(line)
+            if match:
+                opcode = match.group(1)
+                self.instructions += 1
+                self.opcodes[opcode] += 1
+                if previous is not None:
+                    self.pairs[(previous, opcode)] += 1
+                previous = opcode
+                continue
+
+            match = BYTE_CODE_SIZE_RE.match(line)
+            if match:
+                self.byte_code_size += int(match.group(1))
+                in_final_dump = False
+
+        self.files += 1
+
+
+def collect_files(paths):
+    """ Collect the JavaScript files from the paths. """
+    files = []
+
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, names in os.walk(path):
+                files.extend(os.path.join(root, name) for name in names if name.endswith('.js'))
+        else:
+            files.append(path)
+
+    return sorted(files)
+
+
+def collect_stats(engine, files):
+    """ Run the engine on every file and collect the opcode statistics. """
+    stats = OpcodeStats()
+
+    for js_file in files:
+        proc = subprocess.Popen([engine, '--show-opcodes', '--parse-only', js_file],
+                                stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        output = proc.communicate()[0].decode('utf-8', 'replace')
+
+        if proc.returncode != 0:
+            # Files with syntax errors are counted but their partial dumps are ignored.
+            stats.failed += 1
+            continue
+
+        stats.add_dump(output)
+
+    return stats
+
+
+def print_stats(stats, top, show_pairs):
+    """ Print the statistics of a single engine. """
+    print('Files: %d (failed to parse: %d)' % (stats.files + stats.failed, stats.failed))
+    print('Instructions: %d' % stats.instructions)
+    print('Byte code size: %d bytes' % stats.byte_code_size)
+    print('\nMost frequent opcodes:')
+
+    for opcode, count in stats.opcodes.most_common(top):
+        print('  %8d  %s' % (count, opcode))
+
+    if show_pairs:
+        print('\nMost frequent opcode pairs:')
+
+        for (first, second), count in stats.pairs.most_common(top):
+            print('  %8d  %s + %s' % (count, first, second))
+
+
+def percent(value, base):
+    """ Relative change in percent. """
+    if base == 0:
+        return 0.0
+    return (value - base) * 100.0 / base
+
+
+def print_diff(stats, base_stats, top):
+    """ Print the difference of two engines. """
+    print('Files: %d / %d' % (stats.files, base_stats.files))
+    print('Instructions: %d -> %d (%+.2f%%)' % (base_stats.instructions, stats.instructions,
+                                               percent(stats.instructions, base_stats.instructions)))
+    print('Byte code size: %d -> %d bytes (%+.2f%%)' % (base_stats.byte_code_size, stats.byte_code_size,
+                                                       percent(stats.byte_code_size, base_stats.byte_code_size)))
+
+    delta = collections.Counter(stats.opcodes)
+    delta.subtract(base_stats.opcodes)
+    changes = sorted((item for item in delta.items() if item[1] != 0), key=lambda item: -abs(item[1]))
+
+    print('\nLargest changes:')
+
+    for opcode, count in changes[:top]:
+        print('  %+8d  %s' % (count, opcode))
+
+
+def main():
+    args = get_arguments()
+    files = collect_files(args.paths)
+
+    if not files:
+        sys.exit('No JavaScript files found.')
+
+    stats = collect_stats(args.engine, files)
+
+    if args.base is None:
+        print_stats(stats, args.top, args.pairs)
+        return
+
+    base_stats = collect_stats(args.base, files)
+
+    if stats.failed != base_stats.failed:
+        print('Warning: the number of files failed to parse differs (%d / %d)' % (stats.failed, base_stats.failed))
+
+    print_diff(stats, base_stats, args.top)
+
+
+if __name__ == '__main__':
+    main()
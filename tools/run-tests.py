@@ -91,6 +91,9 @@ JERRY_TESTS_OPTIONS = [
             + ['--cpointer-32bit=on', '--mem-heap=1024']),
     Options('jerry_tests-es5.1-debug-external_context',
             OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT + ['--external-context=on']),
+    Options('jerry_tests-es5.1-debug-gc_incremental',
+            OPTIONS_COMMON + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_STACK_LIMIT
+            + ['--gc-incremental=on', '--gc-limit=8192']),
 ]
 
 # Test options for jerry-test-suite
@@ -156,7 +159,8 @@ JERRY_BUILDOPTIONS = [
             ['--jerry-libm=off', '--link-lib=m'],
             skip=skip_if((sys.platform == 'win32'), 'There is no separated libm on Windows')),
     Options('buildoption_test-no_lcache_prophashmap',
-            ['--compile-flag=-DJERRY_LCACHE=0', '--compile-flag=-DJERRY_PROPRETY_HASHMAP=0']),
+            ['--compile-flag=-DJERRY_LCACHE=0', '--compile-flag=-DJERRY_ICACHE=0',
+             '--compile-flag=-DJERRY_PROPRETY_HASHMAP=0', '--compile-flag=-DJERRY_PROPERTY_SHAPES=0']),
     Options('buildoption_test-external_context',
             ['--external-context=on']),
     Options('buildoption_test-shared_libs',